@@ -51,6 +51,12 @@ if(NOT CONAN_OPENSTUDIO_ALREADY_RUN)
     set(CONAN_GTEST "")
   endif()
 
+  if (BUILD_BENCHMARK)
+    set(CONAN_BENCHMARK "benchmark/1.5.0")
+  else()
+    set(CONAN_BENCHMARK "")
+  endif()
+
   # DLM: add option for shared libs if we are building shared?
 
   # This will create the conanbuildinfo.cmake in the current binary dir, not the cmake_binary_dir
@@ -82,6 +88,7 @@ if(NOT CONAN_OPENSTUDIO_ALREADY_RUN)
     geographiclib/1.49@bincrafters/stable
     swig_installer/4.0.1@bincrafters/stable
     ${CONAN_GTEST}
+    ${CONAN_BENCHMARK}
 
     # Override to avoid dependency mismatches
     bzip2/1.0.8
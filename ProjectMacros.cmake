@@ -75,6 +75,23 @@ macro(CREATE_TEST_TARGETS BASE_NAME SRC DEPENDENCIES)
   endif()
 endmacro()
 
+# Create a google benchmark executable, not registered with ctest since timings need a quiet machine
+macro(CREATE_BENCHMARK_TARGETS BASE_NAME SRC DEPENDENCIES)
+  if(BUILD_BENCHMARK)
+    add_executable(${BASE_NAME}_benchmark ${SRC})
+
+    CREATE_SRC_GROUPS("${SRC}")
+
+    target_link_libraries(${BASE_NAME}_benchmark
+      CONAN_PKG::benchmark
+      ${DEPENDENCIES}
+    )
+
+    if(TARGET "${BASE_NAME}_resources")
+      add_dependencies("${BASE_NAME}_benchmark" "${BASE_NAME}_resources")
+    endif()
+  endif()
+endmacro()
 
 macro(MAKE_LITE_SQL_TARGET IN_FILE BASE_FILE)
   set(cmake_script "
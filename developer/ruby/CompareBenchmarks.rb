@@ -0,0 +1,101 @@
+# Compares the results of two runs of the OpenStudio benchmark executables.
+#
+# Run each build's *_benchmark executable through RunBenchmarks.rb, which runs every
+# benchmark in its own process, or directly with
+#   --benchmark_out=<file>.json --benchmark_out_format=json
+# then compare the two outputs with
+#   ruby CompareBenchmarks.rb baseline.json contender.json [threshold_percent]
+#
+# Benchmarks are matched by name. Real time, cpu time and peak memory are reported
+# along with the percent change from baseline to contender. The script exits with a
+# nonzero status if any real time or peak memory regression exceeds the threshold
+# (10 percent by default). Peak memory is the high-water mark of the benchmark process,
+# so memory regressions are only checked when both files come from RunBenchmarks.rb.
+
+require 'json'
+
+if ARGV.size < 2
+  puts "Usage: ruby CompareBenchmarks.rb baseline.json contender.json [threshold_percent]"
+  exit(1)
+end
+
+baseline_path = ARGV[0]
+contender_path = ARGV[1]
+threshold = ARGV[2] ? ARGV[2].to_f : 10.0
+
+def load_benchmarks(path)
+  result = {}
+  JSON.parse(File.read(path))['benchmarks'].each do |benchmark|
+    # skip mean/median/stddev rows when run with repetitions
+    next if benchmark['run_type'] == 'aggregate'
+    result[benchmark['name']] = benchmark
+  end
+  return result
+end
+
+def peak_memory_per_process(path)
+  context = JSON.parse(File.read(path))['context']
+  return (context && context['peak_memory_per_process']) ? true : false
+end
+
+def percent_change(baseline, contender)
+  return nil if baseline.nil? || contender.nil? || baseline == 0
+  return 100.0 * (contender - baseline) / baseline
+end
+
+def format_change(change)
+  return 'n/a' if change.nil?
+  return format('%+.1f%%', change)
+end
+
+baseline = load_benchmarks(baseline_path)
+contender = load_benchmarks(contender_path)
+
+check_memory = peak_memory_per_process(baseline_path) && peak_memory_per_process(contender_path)
+if !check_memory
+  puts "Peak memory depends on the order benchmarks ran in, use RunBenchmarks.rb to check memory regressions"
+end
+
+regressions = []
+
+puts format('%-60s %14s %14s %9s %14s %9s %12s %9s', 'Benchmark', 'Base Time', 'New Time', 'Time', 'New CPU', 'CPU', 'New Mem (MB)', 'Mem')
+baseline.each do |name, base|
+  contend = contender[name]
+  if contend.nil?
+    puts "#{name} is missing from #{contender_path}"
+    next
+  end
+
+  unit = base['time_unit']
+  time_change = percent_change(base['real_time'], contend['real_time'])
+  cpu_change = percent_change(base['cpu_time'], contend['cpu_time'])
+  memory_change = percent_change(base['peak_memory_MB'], contend['peak_memory_MB'])
+
+  puts format('%-60s %11.3f %-2s %11.3f %-2s %9s %11.3f %-2s %9s %12s %9s', name,
+              base['real_time'], unit, contend['real_time'], contend['time_unit'], format_change(time_change),
+              contend['cpu_time'], contend['time_unit'], format_change(cpu_change),
+              contend['peak_memory_MB'] ? format('%.1f', contend['peak_memory_MB']) : 'n/a', format_change(memory_change))
+
+  if unit != contend['time_unit']
+    puts "  time units differ for #{name}, not checking for regression"
+    next
+  end
+
+  if time_change && time_change > threshold
+    regressions << "#{name} real time #{format_change(time_change)}"
+  end
+  if check_memory && memory_change && memory_change > threshold
+    regressions << "#{name} peak memory #{format_change(memory_change)}"
+  end
+end
+
+contender.each_key do |name|
+  puts "#{name} is new in #{contender_path}" if !baseline.has_key?(name)
+end
+
+if !regressions.empty?
+  puts
+  puts "Regressions over #{threshold}%:"
+  regressions.each { |regression| puts "  #{regression}" }
+  exit(1)
+end
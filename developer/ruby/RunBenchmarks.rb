@@ -0,0 +1,61 @@
+# Runs the benchmarks of an OpenStudio *_benchmark executable, each in its own process, and merges
+# the results into a single google benchmark json file.
+#
+# The peak_memory_MB counter is the peak resident memory of the whole process, so it only describes
+# a benchmark when that benchmark is the only one the process has run. Running the executable
+# directly reports memory that depends on which benchmarks ran before; use this script to get
+# memory numbers that CompareBenchmarks.rb can check for regressions.
+#
+# Usage:
+#   ruby RunBenchmarks.rb path/to/openstudio_model_benchmark output.json [benchmark_filter] [other benchmark args]
+
+require 'json'
+require 'open3'
+require 'tmpdir'
+
+if ARGV.size < 2
+  puts "Usage: ruby RunBenchmarks.rb benchmark_executable output.json [benchmark_filter] [other benchmark args]"
+  exit(1)
+end
+
+exe = ARGV[0]
+out_path = ARGV[1]
+filter = ARGV[2] ? ARGV[2] : '.'
+extra_args = ARGV[3..-1] || []
+
+list, status = Open3.capture2(exe, '--benchmark_list_tests=true', "--benchmark_filter=#{filter}")
+if !status.success?
+  puts "Could not list benchmarks of #{exe}"
+  exit(1)
+end
+names = list.split("\n").map(&:strip).reject(&:empty?)
+
+merged = nil
+Dir.mktmpdir do |dir|
+  names.each_with_index do |name, i|
+    puts "#{i + 1}/#{names.size} #{name}"
+    path = File.join(dir, "#{i}.json")
+    ok = system(exe, "--benchmark_filter=^#{Regexp.escape(name)}$", "--benchmark_out=#{path}", '--benchmark_out_format=json',
+                *extra_args, out: File::NULL, err: File::NULL)
+    if !ok || !File.exist?(path)
+      puts "  failed, skipping"
+      next
+    end
+
+    result = JSON.parse(File.read(path))
+    if merged.nil?
+      merged = result
+    else
+      merged['benchmarks'].concat(result['benchmarks'])
+    end
+  end
+end
+
+if merged.nil?
+  puts "No benchmarks were run"
+  exit(1)
+end
+
+# tells CompareBenchmarks.rb that peak memory was measured for each benchmark on its own
+merged['context']['peak_memory_per_process'] = true
+File.write(out_path, JSON.pretty_generate(merged))
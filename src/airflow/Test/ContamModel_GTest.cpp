@@ -56,6 +56,55 @@ TEST_F(AirflowFixture, ContamModel_AirflowElements) {
   EXPECT_EQ(afe2, model.getPlrLeak2()[0]);
 }
 
+// Test replacing airflow elements
+TEST_F(AirflowFixture, ContamModel_ReplaceAirflowElements) {
+  openstudio::contam::IndexModel model;
+  openstudio::contam::PlrTest1 afe0(OPNG, "external", "This is the average leakage element for exterior walls",
+    "6.13696e-008", "0.000499082", "0.65", "75", "0.00906345");
+  openstudio::contam::PlrTest1 afe1(OPNG, "internal", "This is the average leakage element for interior walls",
+    1.47921e-007, 0.000998165, 0.65, 75, 0.0181269);
+  openstudio::contam::PlrLeak2 afe2(OPNG, "WNOO6C_CMX", "Operable window, Building C, maximum (from C&IMisc.lb3)",
+    "4.98716e-008", "0.00039745", "0.65", "1", "4", "0.000346");
+  model.addAirflowElement(afe0);
+  model.addAirflowElement(afe1);
+  model.addAirflowElement(afe2);
+  EXPECT_EQ(2, model.airflowElementNrByName("internal"));
+  EXPECT_EQ(3, model.airflowElementNrByName("WNOO6C_CMX"));
+  EXPECT_EQ(0, model.airflowElementNrByName("missing"));
+
+  openstudio::contam::PlrTest1 afe3(OPNG, "replaced", "This replaces the interior wall element",
+    1.47921e-007, 0.000998165, 0.65, 75, 0.0181269);
+  EXPECT_TRUE(model.replaceAirflowElement(2, afe3));
+  EXPECT_EQ(2, afe3.nr());
+  ASSERT_EQ(2, model.getPlrTest1().size());
+  EXPECT_EQ(afe3, model.getPlrTest1()[1]);
+  EXPECT_EQ(2, model.airflowElementNrByName("replaced"));
+  EXPECT_EQ(0, model.airflowElementNrByName("internal"));
+
+  // Replacing an element with one of a different type
+  openstudio::contam::PlrTest1 afe4(OPNG, "window", "This replaces the window element",
+    1.47921e-007, 0.000998165, 0.65, 75, 0.0181269);
+  EXPECT_TRUE(model.replaceAirflowElement(3, afe4));
+  EXPECT_EQ(3, model.getPlrTest1().size());
+  EXPECT_EQ(0, model.getPlrLeak2().size());
+  EXPECT_FALSE(model.replaceAirflowElement(4, afe4));
+}
+
+// Test the tokenizer used to read PRJ files
+TEST_F(AirflowFixture, ContamModel_Reader) {
+  openstudio::contam::Reader input(std::string("! comment line\n1 -2 +3 ! trailing comment\n  4.5e1\t7\r\nword 0.25\n-999\n"));
+  EXPECT_EQ(1, input.readInt());
+  EXPECT_EQ(-2, input.readInt());
+  EXPECT_EQ(3, input.readInt());
+  EXPECT_DOUBLE_EQ(45.0, input.readDouble());
+  EXPECT_EQ(7u, input.readUInt());
+  EXPECT_EQ(3, input.lineNumber());
+  EXPECT_THROW(input.readDouble(), std::exception);
+  EXPECT_EQ("0.25", input.readNumber<std::string>());
+  EXPECT_NO_THROW(input.read999());
+  EXPECT_THROW(input.readString(), std::exception);
+}
+
 // Verify that the species/contaminant stuff works
 TEST_F(AirflowFixture, ContamModel_Species) {
   openstudio::contam::IndexModel model;
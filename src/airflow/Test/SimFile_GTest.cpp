@@ -0,0 +1,166 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/PrjModel.hpp"
+#include "../contam/SimFile.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <fstream>
+
+static openstudio::path writeResults()
+{
+  // Three time steps of results for three paths, plus the ambient and two zone nodes
+  openstudio::path simPath = openstudio::toPath("./SimFileReader.sim");
+  std::ofstream lfr(openstudio::toString(openstudio::toPath("./SimFileReader.lfr")));
+  lfr << "day\ttime\tP#\tdP\tF0\tF1\n";
+  double flows[3][3] = {{0.5, -0.25, 1.0}, {-0.75, 0.5, 0.25}, {1.5, -1.0, -0.5}};
+  const char* times[3] = {"00:00:00", "01:00:00", "02:00:00"};
+  for(int i=0; i<3; i++)
+  {
+    for(int j=0; j<3; j++)
+    {
+      lfr << "1/2\t" << times[i] << "\t" << j+1 << "\t" << 0.1*(j+1) << "\t" << flows[i][j] << "\t" << 0.125*flows[i][j] << "\n";
+    }
+  }
+  std::ofstream nfr(openstudio::toString(openstudio::toPath("./SimFileReader.nfr")));
+  nfr << "day\ttime\tZ#\tT\tP\tD\n";
+  for(int i=0; i<3; i++)
+  {
+    nfr << "1/2\t" << times[i] << "\t0\t293.15\t0\t-\n";
+    for(int j=1; j<3; j++)
+    {
+      nfr << "1/2\t" << times[i] << "\t" << j << "\t" << 290.0 + i + j << "\t" << -0.5*j << "\t1.2\n";
+    }
+  }
+  return simPath;
+}
+
+TEST_F(AirflowFixture, SimFileReader_Paths) {
+  openstudio::path simPath = writeResults();
+  openstudio::contam::SimFile sim(simPath);
+  ASSERT_EQ(3u, sim.fileDateTimes().size());
+  ASSERT_EQ(3u, sim.F0().size());
+
+  openstudio::contam::SimFileReader reader(simPath, openstudio::contam::SimFileReader::Paths);
+  EXPECT_FALSE(reader.failed());
+  unsigned step = 0;
+  while(reader.next())
+  {
+    ASSERT_EQ(3u, reader.numbers().size());
+    EXPECT_EQ(sim.fileDateTimes()[step], reader.dateTime());
+    for(int nr=1; nr<=3; nr++)
+    {
+      int index = reader.index(nr);
+      ASSERT_EQ(nr-1, index);
+      EXPECT_DOUBLE_EQ(sim.dP()[index][step], reader.deltaP()[index]);
+      EXPECT_DOUBLE_EQ(sim.F0()[index][step], reader.flow0()[index]);
+      EXPECT_DOUBLE_EQ(sim.F1()[index][step], reader.flow1()[index]);
+    }
+    ++step;
+  }
+  EXPECT_FALSE(reader.failed());
+  EXPECT_EQ(3u, step);
+  EXPECT_EQ(3u, reader.steps());
+
+  // Only keep the selected paths
+  openstudio::contam::SimFileReader selected(simPath, openstudio::contam::SimFileReader::Paths, {3, 1});
+  ASSERT_EQ(2u, selected.numbers().size());
+  EXPECT_EQ(-1, selected.index(2));
+  ASSERT_TRUE(selected.next());
+  EXPECT_EQ(0, selected.index(3));
+  EXPECT_DOUBLE_EQ(1.0, selected.flow0()[0]);
+  EXPECT_DOUBLE_EQ(0.5, selected.flow0()[1]);
+}
+
+TEST_F(AirflowFixture, SimFileReader_Nodes) {
+  openstudio::path simPath = writeResults();
+  openstudio::contam::SimFile sim(simPath);
+  ASSERT_EQ(3u, sim.T().size());
+
+  openstudio::contam::SimFileReader reader(simPath, openstudio::contam::SimFileReader::Nodes);
+  unsigned step = 0;
+  while(reader.next())
+  {
+    ASSERT_EQ(3u, reader.numbers().size());
+    EXPECT_EQ(0, reader.numbers()[0]);
+    EXPECT_DOUBLE_EQ(0.0, reader.density()[0]);
+    for(unsigned index=0; index<3; index++)
+    {
+      EXPECT_DOUBLE_EQ(sim.T()[index][step], reader.temperature()[index]);
+      EXPECT_DOUBLE_EQ(sim.P()[index][step], reader.pressure()[index]);
+      EXPECT_DOUBLE_EQ(sim.D()[index][step], reader.density()[index]);
+    }
+    ++step;
+  }
+  EXPECT_FALSE(reader.failed());
+  EXPECT_EQ(3u, step);
+
+  openstudio::contam::SimFileReader missing(openstudio::toPath("./NoSuchFile.sim"), openstudio::contam::SimFileReader::Nodes);
+  EXPECT_TRUE(missing.failed());
+  EXPECT_FALSE(missing.next());
+}
+
+TEST_F(AirflowFixture, SimFileReader_ZoneInfiltration) {
+  openstudio::path simPath = writeResults();
+
+  openstudio::contam::IndexModel model;
+  openstudio::contam::Zone zone0(openstudio::contam::ZoneFlags::VAR_P, 400, 293.15, "Zone_0");
+  openstudio::contam::Zone zone1(openstudio::contam::ZoneFlags::VAR_P, 400, 293.15, "Zone_1");
+  model.addZone(zone0);
+  model.addZone(zone1);
+  // Paths 1 and 3 are negative for flow into zones 1 and 2, path 2 is positive for flow into zone 1
+  openstudio::contam::AirflowPath path1(0, -1, 1, 1, 1, 0.0, 1.0, 0u);
+  openstudio::contam::AirflowPath path2(0, 1, -1, 1, 1, 0.0, 1.0, 0u);
+  openstudio::contam::AirflowPath path3(0, -1, 2, 1, 1, 0.0, 1.0, 0u);
+  model.addAirflowPath(path1);
+  model.addAirflowPath(path2);
+  model.addAirflowPath(path3);
+
+  openstudio::contam::SimFile sim(simPath);
+  std::vector<openstudio::TimeSeries> expected = model.zoneInfiltration(&sim);
+  std::vector<openstudio::TimeSeries> streamed = model.zoneInfiltration(simPath);
+  ASSERT_EQ(2u, expected.size());
+  ASSERT_EQ(2u, streamed.size());
+  for(unsigned i=0; i<2; i++)
+  {
+    ASSERT_EQ(2u, streamed[i].dateTimes().size());
+    EXPECT_EQ(expected[i].dateTimes(), streamed[i].dateTimes());
+    for(unsigned k=0; k<2; k++)
+    {
+      EXPECT_DOUBLE_EQ(expected[i].values()[k], streamed[i].values()[k]);
+    }
+  }
+  // In the first interval, both paths 1 and 2 average 0.140625 kg/s into zone 1
+  EXPECT_DOUBLE_EQ(0.28125, streamed[0].values()[0]);
+}
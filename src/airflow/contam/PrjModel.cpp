@@ -856,6 +856,11 @@ std::vector<TimeSeries> IndexModel::zoneInfiltration(SimFile *sim)
   return m_impl->zoneInfiltration(sim);
 }
 
+std::vector<TimeSeries> IndexModel::zoneInfiltration(const openstudio::path &simPath)
+{
+  return m_impl->zoneInfiltration(simPath);
+}
+
 std::vector<TimeSeries> IndexModel::pathInfiltration(std::vector<int> pathNrs, SimFile *sim)
 {
   return m_impl->pathInfiltration(pathNrs, sim);
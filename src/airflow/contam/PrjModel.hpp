@@ -436,6 +436,9 @@ public:
   std::vector<std::vector<int> > zoneExteriorFlowPaths();
   /** Compute the infiltration on a per zone basis from simulation results. */
   std::vector<TimeSeries> zoneInfiltration(SimFile *sim);
+  /** Compute the infiltration on a per zone basis by streaming the path results that go with the SIM file
+   *  at simPath. Only the exterior flow paths are read, so the full results are never held in memory. */
+  std::vector<TimeSeries> zoneInfiltration(const openstudio::path &simPath);
   /** Compute the infiltration on a per path basis from simulation results. */
   std::vector<TimeSeries> pathInfiltration(std::vector<int> pathNrs, SimFile *sim);
   //@}
@@ -31,6 +31,7 @@
 #include "PrjReader.hpp"
 #include "SimFile.hpp"
 #include <algorithm>
+#include <cstdlib>
 
 #include "../../utilities/core/StringHelpers.hpp"
 
@@ -201,6 +202,8 @@ bool IndexModelImpl::read(Reader &input)
   m_unsupported["SourceSink"] = cse;
   // Section 10: Airflow Elements
   m_airflowElements = input.readElementVector<AirflowElement>("airflow element");
+  m_airflowElementTypes.clear();
+  m_airflowElementNames.clear();
   // Section 11: Duct Elements
   std::string dfe = input.readSection(); // Skip it
   m_unsupported["DuctElement"] = dfe;
@@ -211,6 +214,7 @@ bool IndexModelImpl::read(Reader &input)
   //std::string ctrl = input.readSection(); // Skip it
   //m_unsupported["ControlNode"] = ctrl;
   m_controlNodes = input.readElementVector<ControlNode>("control node");
+  m_controlNodeTypes.clear();
   // Section 13: Simple Air Handling System (AHS)
   m_ahs = input.readSectionVector<Ahs>("ahs");
   // Section 14: Zones
@@ -1144,12 +1148,37 @@ std::string IndexModelImpl::writeZoneIc(int start)
 
 int IndexModelImpl::airflowElementNrByName(std::string name) const
 {
+  // Elements share their data with the copies handed out, so names can change behind our back
+  // and a cached position is only trusted if the element there still has the requested name
+  auto iter = m_airflowElementNames.find(name);
+  if(iter != m_airflowElementNames.end() && iter->second < m_airflowElements.size()
+    && m_airflowElements[iter->second]->name() == name) {
+    return m_airflowElements[iter->second]->nr();
+  }
+  m_airflowElementNames.clear();
+  int nr = 0;
+  for(unsigned i=m_airflowElements.size();i-->0;) {
+    std::string elementName = m_airflowElements[i]->name();
+    m_airflowElementNames[elementName] = i;
+    if(elementName == name) {
+      nr = m_airflowElements[i]->nr();
+    }
+  }
+  return nr;
+}
+
+int IndexModelImpl::airflowElementIndex(int nr) const
+{
+  // Elements are numbered sequentially, so the position is almost always nr - 1
+  if(nr > 0 && (unsigned)nr <= m_airflowElements.size() && m_airflowElements[nr-1]->nr() == nr) {
+    return nr - 1;
+  }
   for(unsigned i=0;i<m_airflowElements.size();i++) {
-    if(m_airflowElements[i]->name() == name) {
-      return m_airflowElements[i]->nr();
+    if(m_airflowElements[i]->nr() == nr) {
+      return i;
     }
   }
-  return 0;
+  return -1;
 }
 
 std::vector<std::vector<int> > IndexModelImpl::zoneExteriorFlowPaths()
@@ -1215,7 +1244,7 @@ std::vector<TimeSeries> IndexModelImpl::zoneInfiltration(SimFile *sim)
       }
       else // Negative values are infiltration
       {
-        boost::optional<openstudio::TimeSeries> optFlow = sim->pathFlow(paths[i][j]);
+        boost::optional<openstudio::TimeSeries> optFlow = sim->pathFlow(-paths[i][j]);
         if(optFlow)
         {
           Vector flow = optFlow.get().values();
@@ -1238,6 +1267,88 @@ std::vector<TimeSeries> IndexModelImpl::zoneInfiltration(SimFile *sim)
   return results;
 }
 
+std::vector<TimeSeries> IndexModelImpl::zoneInfiltration(const openstudio::path &simPath)
+{
+  // Only read the exterior paths, and accumulate one time step at a time using the same
+  // trapezoidal approximation that SimFile uses to produce interval data
+  std::vector<std::vector<int> > paths = zoneExteriorFlowPaths();
+  std::vector<int> nrs;
+  for(const std::vector<int> &zonePaths : paths)
+  {
+    for(int nr : zonePaths)
+    {
+      nrs.push_back(std::abs(nr));
+    }
+  }
+  SimFileReader reader(simPath, SimFileReader::Paths, nrs);
+  std::vector<DateTime> dateTimes;
+  std::vector<std::vector<double> > inf(m_zones.size());
+  std::vector<double> previous(reader.numbers().size());
+  std::vector<double> flow(reader.numbers().size());
+  while(reader.next())
+  {
+    for(unsigned int k=0; k<flow.size(); k++)
+    {
+      flow[k] = reader.flow0()[k] + reader.flow1()[k];
+    }
+    if(reader.steps() > 1)
+    {
+      dateTimes.push_back(reader.dateTime());
+      for(unsigned int i=0; i<m_zones.size(); i++)
+      {
+        double value = 0.0;
+        for(int nr : paths[i])
+        {
+          int index = reader.index(std::abs(nr));
+          double average = 0.5*(previous[index] + flow[index]);
+          if(nr > 0 && average > 0) // Positive values are infiltration
+          {
+            value += average;
+          }
+          else if(nr < 0 && average < 0) // Negative values are infiltration
+          {
+            value -= average;
+          }
+        }
+        inf[i].push_back(value);
+      }
+    }
+    previous.swap(flow);
+  }
+  std::vector<TimeSeries> results;
+  if(reader.failed() || reader.steps() == 0)
+  {
+    return results;
+  }
+  if(reader.steps() == 1)
+  {
+    // Steady simulation results, use the values as is
+    dateTimes.push_back(reader.dateTime());
+    for(unsigned int i=0; i<m_zones.size(); i++)
+    {
+      double value = 0.0;
+      for(int nr : paths[i])
+      {
+        double current = previous[reader.index(std::abs(nr))];
+        if(nr > 0 && current > 0)
+        {
+          value += current;
+        }
+        else if(nr < 0 && current < 0)
+        {
+          value -= current;
+        }
+      }
+      inf[i].push_back(value);
+    }
+  }
+  for(unsigned int i=0; i<m_zones.size(); i++)
+  {
+    results.push_back(openstudio::TimeSeries(dateTimes,createVector(inf[i]),"kg/s"));
+  }
+  return results;
+}
+
 std::vector<TimeSeries> IndexModelImpl::pathInfiltration(std::vector<int> pathNrs, SimFile *sim)
 {
   // This should probably include a lot more checks of things and is written in
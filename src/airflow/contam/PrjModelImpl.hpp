@@ -40,6 +40,8 @@
 
 #include "../AirflowAPI.hpp"
 
+#include <typeindex>
+
 namespace openstudio {
 namespace contam {
 
@@ -318,13 +320,10 @@ public:
   template <class T> std::vector<T> getAirflowElements()
   {
     std::vector<T> afe;
-    for(std::shared_ptr<AirflowElement> el : m_airflowElements) {
-      if(el.get()){
-        T* derived = dynamic_cast<T*>(el.get());
-        if(derived) {
-          afe.push_back(*derived);
-        }
-      }
+    const std::vector<std::size_t> &positions = typeIndex<T>(m_airflowElements, m_airflowElementTypes);
+    afe.reserve(positions.size());
+    for(std::size_t i : positions) {
+      afe.push_back(*static_cast<T*>(m_airflowElements[i].get()));
     }
     return afe;
   }
@@ -337,8 +336,11 @@ public:
     if(pointer) {
       copy->setNr(m_airflowElements.size() + 1);
       m_airflowElements.push_back(std::shared_ptr<AirflowElement>(pointer));
+      m_airflowElementTypes.clear();
+      m_airflowElementNames.clear();
       return true;
     }
+    delete copy;
     return false;
   }
 
@@ -346,15 +348,22 @@ public:
 
   template <class T> bool replaceAirflowElement(int nr, T element)
   {
-    if(nr>0 && (unsigned)nr<=m_airflowElements.size()) {
+    int index = airflowElementIndex(nr);
+    if(index >= 0) {
       auto copy = new T;
       *copy = element;
       AirflowElement *pointer = dynamic_cast<AirflowElement*>(copy);
       if(pointer) {
         copy->setNr(nr);
-        //m_airflowElements.replace(nr - 1, std::shared_ptr<AirflowElement>(pointer));
+        // The type index only needs to be rebuilt if the element changes type
+        if(!m_airflowElements[index] || typeid(*m_airflowElements[index]) != typeid(*pointer)) {
+          m_airflowElementTypes.clear();
+        }
+        m_airflowElements[index] = std::shared_ptr<AirflowElement>(pointer);
+        m_airflowElementNames.clear();
         return true;
       }
+      delete copy;
     }
     return false;
   }
@@ -362,13 +371,10 @@ public:
   template <class T> std::vector<T> getControlNodes()
   {
     std::vector<T> nodes;
-    for(std::shared_ptr<ControlNode> el : m_controlNodes) {
-      if(el.get()){
-        T* derived = dynamic_cast<T*>(el.get());
-        if(derived) {
-          nodes.push_back(*derived);
-        }
-      }
+    const std::vector<std::size_t> &positions = typeIndex<T>(m_controlNodes, m_controlNodeTypes);
+    nodes.reserve(positions.size());
+    for(std::size_t i : positions) {
+      nodes.push_back(*static_cast<T*>(m_controlNodes[i].get()));
     }
     return nodes;
   }
@@ -384,8 +390,10 @@ public:
         copy->setSeqnr(copy->nr());
       }
       m_controlNodes.push_back(std::shared_ptr<ControlNode>(pointer));
+      m_controlNodeTypes.clear();
       return true;
     }
+    delete copy;
     return false;
   }
 
@@ -405,6 +413,7 @@ public:
 
   std::vector<std::vector<int> > zoneExteriorFlowPaths();
   std::vector<TimeSeries> zoneInfiltration(SimFile *sim);
+  std::vector<TimeSeries> zoneInfiltration(const openstudio::path &simPath);
   std::vector<TimeSeries> pathInfiltration(std::vector<int> pathNrs, SimFile *sim);
 
 
@@ -416,6 +425,24 @@ private:
   template <class T> std::string writeSectionVector(std::vector<std::shared_ptr<T> > vector, std::string label = std::string(), int start = 0);
   template <class T> std::string writeArray(std::vector<T> vector, std::string label=std::string(), int start=0);
   template <class T> void renumberVector(std::vector<T> &vector);
+  int airflowElementIndex(int nr) const;
+
+  // Return the positions of the elements that are a T, scanning only the first time a type is requested
+  template <class T, class B> static const std::vector<std::size_t> &typeIndex(const std::vector<std::shared_ptr<B> > &elements,
+    std::map<std::type_index, std::vector<std::size_t> > &index)
+  {
+    auto iter = index.find(std::type_index(typeid(T)));
+    if(iter == index.end()) {
+      std::vector<std::size_t> positions;
+      for(std::size_t i = 0; i < elements.size(); ++i) {
+        if(dynamic_cast<T*>(elements[i].get())) {
+          positions.push_back(i);
+        }
+      }
+      iter = index.insert(std::make_pair(std::type_index(typeid(T)), positions)).first;
+    }
+    return iter->second;
+  }
 
   bool m_valid;
 
@@ -481,6 +508,11 @@ private:
   std::vector<WindPressureProfile> m_windPressureProfiles;
   std::vector<std::shared_ptr<AirflowElement> > m_airflowElements;
   std::vector<std::shared_ptr<ControlNode> > m_controlNodes;
+  // Cached positions of each requested element type, cleared whenever the element lists change
+  std::map<std::type_index, std::vector<std::size_t> > m_airflowElementTypes;
+  std::map<std::type_index, std::vector<std::size_t> > m_controlNodeTypes;
+  // Cached positions of the airflow elements by name, checked against the element before use
+  mutable std::map<std::string, std::size_t> m_airflowElementNames;
   std::vector<Ahs> m_ahs;
   std::vector<Zone> m_zones;
   std::vector<AirflowPath> m_paths;
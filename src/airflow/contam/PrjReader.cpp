@@ -30,6 +30,7 @@
 #include "PrjReader.hpp"
 #include <iostream>
 #include <stdlib.h>
+#include <charconv>
 
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/FilesystemHelpers.hpp"
@@ -39,69 +40,119 @@ namespace openstudio {
 namespace contam {
 
 Reader::Reader( openstudio::filesystem::ifstream &file )
-  : m_stream(openstudio::filesystem::read_as_string(file)), m_lineNumber(0)
+  : m_buffer(openstudio::filesystem::read_as_string(file)), m_position(0), m_lineNumber(0), m_nextEntry(0)
 {
 }
 
-Reader::Reader(const std::string& string, int starting) : m_lineNumber(starting)
+Reader::Reader(const std::string& string, int starting)
+  : m_buffer(string), m_position(0), m_lineNumber(starting), m_nextEntry(0)
 {
-  m_stream.str(string);
 }
 
 Reader::~Reader()
 {
 }
 
+// Parse a complete token as a double, returns false if any of the token is not part of the number
+static bool parseDouble(std::string_view string, double &value)
+{
+  if(!string.empty() && string[0] == '+') {
+    string.remove_prefix(1);
+  }
+  if(string.empty()) {
+    return false;
+  }
+#if defined(__cpp_lib_to_chars)
+  const char *end = string.data() + string.size();
+  auto result = std::from_chars(string.data(), end, value);
+  return result.ec == std::errc() && result.ptr == end;
+#else
+  auto result = openstudio::string_conversions::to_no_throw<double>(std::string(string));
+  if(result) {
+    value = result.get();
+  }
+  return result.is_initialized();
+#endif
+}
+
+// Parse the leading integer in a token, matching the leniency of std::stoi
+template <class T> static bool parseInteger(std::string_view string, T &value)
+{
+  if(string.size() > 1 && string[0] == '+' && string[1] != '-') {
+    string.remove_prefix(1);
+  }
+  auto result = std::from_chars(string.data(), string.data() + string.size(), value);
+  return result.ec == std::errc();
+}
+
 double Reader::readDouble()
 {
-  const auto string = readString();
-  try {
-    return openstudio::string_conversions::to<double>(string);
-  } catch (const std::bad_cast &) {
+  std::string_view string = readToken();
+  double value = 0.0;
+  if(!parseDouble(string, value)) {
     LOG_AND_THROW("Floating point (double) conversion error at line " << m_lineNumber << " for \"" << string << "\"");
   }
+  return value;
 }
 
 std::string Reader::readString()
 {
-  while(1) {
-    while(m_entries.size() == 0) {
-      std::string input;
-      std::getline(m_stream, input);
-      LOG(Debug, "Line read: " << input);
-      if(!m_stream) {
-        LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-      }
-      m_lineNumber++;
-      while(input[0]=='!') {
-        std::getline(m_stream, input);
-        LOG(Debug, "Line read: " << input);
-        if(!m_stream) {
-          LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-        }
-        m_lineNumber++;
-      }
+  return std::string(readToken());
+}
+
+bool Reader::nextLine(std::string_view &line)
+{
+  if(m_position >= m_buffer.size()) {
+    return false;
+  }
+  std::size_t end = m_buffer.find('\n', m_position);
+  if(end == std::string::npos) {
+    end = m_buffer.size();
+  }
+  line = std::string_view(m_buffer.data() + m_position, end - m_position);
+  m_position = end + 1;
+  m_lineNumber++;
+  return true;
+}
 
-      std::vector<std::string> strs;
-      boost::split(strs,input,boost::is_any_of(" "));
+std::string_view Reader::nextNonCommentLine()
+{
+  std::string_view line;
+  do {
+    if(!nextLine(line)) {
+      LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
+    }
+  } while(!line.empty() && line[0] == '!');
+  return line;
+}
 
+std::string_view Reader::readToken()
+{
+  while(1) {
+    while(m_nextEntry == m_entries.size()) {
+      std::string_view input = nextNonCommentLine();
       m_entries.clear();
-      for (const auto &s : strs) {
-        std::string s2 = boost::replace_all_copy(s, " ", "");
-        boost::replace_all(s2, "\r", "");
-        boost::replace_all(s2, "\n", "");
-        boost::replace_all(s2, "\t", "");
-        if (!s2.empty()) {
-          m_entries.push_back(s2);
+      m_nextEntry = 0;
+      std::size_t i = 0;
+      while(i < input.size()) {
+        while(i < input.size() && (input[i] == ' ' || input[i] == '\t' || input[i] == '\r')) {
+          ++i;
+        }
+        std::size_t begin = i;
+        while(i < input.size() && input[i] != ' ' && input[i] != '\t' && input[i] != '\r') {
+          ++i;
+        }
+        if(i > begin) {
+          m_entries.push_back(input.substr(begin, i - begin));
         }
       }
     }
-    std::string out = m_entries.front();
-    m_entries.pop_front();
+    std::string_view out = m_entries[m_nextEntry++];
     if(out[0] == '!') {
+      // The rest of the line is a comment
       m_entries.clear();
+      m_nextEntry = 0;
     } else {
-      LOG(Debug, "String return: " << out);
       return out;
     }
   }
@@ -109,11 +160,9 @@ std::string Reader::readString()
 
 int Reader::readInt()
 {
-  std::string string = readString();
+  std::string_view string = readToken();
   int value = 0;
-  try {
-    value = std::stoi(string);
-  }catch(const std::exception&){
+  if(!parseInteger(string, value)) {
     LOG_AND_THROW("Integer conversion error at line " << m_lineNumber << " for \"" << string << "\"");
   }
   return value;
@@ -121,38 +170,20 @@ int Reader::readInt()
 
 unsigned int Reader::readUInt()
 {
-  std::string string = readString();
-  int value = 0;
-  try {
-    value = std::stoul(string);
-  } catch (const std::exception&) {
+  std::string_view string = readToken();
+  long long value = 0;
+  if(!parseInteger(string, value)) {
     LOG_AND_THROW("Unsigned Integer conversion error at line " << m_lineNumber << " for \"" << string << "\"");
   }
-  return value;
+  return (unsigned int)value;
 }
 
 std::string Reader::readLine()
 {
   /* Dump any other input */
-  if(m_entries.size()) {
-    m_entries.clear();
-  }
-  std::string input;
-  std::getline(m_stream, input);
-  LOG(Debug, "Line read: " << input);
-  if(!m_stream) {
-    LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-  }
-  m_lineNumber++;
-  while(input[0]=='!') {
-    std::getline(m_stream, input);
-    LOG(Debug, "Line read: " << input);
-    if(!m_stream) {
-      LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-    }
-    m_lineNumber++;
-  }
-  return input;
+  m_entries.clear();
+  m_nextEntry = 0;
+  return std::string(nextNonCommentLine());
 }
 
 void Reader::read999()
@@ -188,14 +219,13 @@ std::string Reader::readSection()
 {
   std::string section;
   while(1) {
-    std::string input;
-    std::getline(m_stream, input);
-    if(!m_stream) {
+    std::string_view input;
+    if(!nextLine(input)) {
       LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
     }
-    m_lineNumber++;
-    section += std::string(input + '\n');
-    if(input.find("-999") == 0) {
+    section.append(input.data(), input.size());
+    section += '\n';
+    if(input.substr(0, 4) == "-999") {
       break;
     }
   }
@@ -243,7 +273,8 @@ template <> double Reader::readNumber<double>()
 template <> std::string Reader::readNumber<std::string>()
 {
   std::string string = readString();
-  if(!openstudio::contam::is_valid<double>(string)) {
+  double value = 0.0;
+  if(!parseDouble(string, value)) {
     LOG_AND_THROW("Invalid number \"" << string << "\" on line " << m_lineNumber);
   }
   return string;
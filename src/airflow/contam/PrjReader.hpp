@@ -31,6 +31,7 @@
 #define AIRFLOW_CONTAM_PRJREADER_HPP
 
 #include <sstream>
+#include <string_view>
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/Filesystem.hpp"
 
@@ -74,12 +75,16 @@ public:
   template <class T> T readNumber();
 
 private:
-  std::string readStdString();
-  std::string readLineString();
+  bool nextLine(std::string_view &line);
+  std::string_view nextNonCommentLine();
+  std::string_view readToken();
 
-  std::stringstream m_stream;
+  // The whole input is held in one buffer and tokenized in place, one line at a time
+  std::string m_buffer;
+  std::size_t m_position;
   int m_lineNumber;
-  std::list<std::string> m_entries;
+  std::vector<std::string_view> m_entries;
+  std::size_t m_nextEntry;
 
   REGISTER_LOGGER("openstudio.contam.Reader");
 };
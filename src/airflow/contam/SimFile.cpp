@@ -32,6 +32,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/classification.hpp>
 
+#include <cstdlib>
+
 namespace openstudio {
 namespace contam {
 
@@ -130,6 +132,10 @@ bool SimFile::readLfr(const std::string& fileName)
     std::string linestr;
     std::getline(file, linestr);
     std::string line = linestr;
+    if(line.empty())
+    {
+      continue;
+    }
     std::vector<std::string> row;
     boost::split(row, line, boost::is_any_of("\t"));
     if(row.size() != ncols)
@@ -235,7 +241,7 @@ bool SimFile::readNfr(const std::string& fileName)
   std::vector<std::string> day;
   std::vector<std::string> time;
   openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-  if(file.is_open())
+  if(!file.is_open())
   {
     LOG(Error,"Failed to open NFR file '" << fileName << "'");
     return false;
@@ -265,6 +271,10 @@ bool SimFile::readNfr(const std::string& fileName)
     std::string linestr;
     std::getline(file, linestr);
     std::string line = linestr;
+    if(line.empty())
+    {
+      continue;
+    }
 
     std::vector<std::string> row;
     boost::split(row, line, boost::is_any_of("\t"));
@@ -479,6 +489,248 @@ std::vector<openstudio::DateTime> SimFile::dateTimes() const
   }
 }
 
+// Split a tab delimited line in place, returning the number of fields found (up to max + 1)
+static int splitFields(const std::string& line, const char** fields, int max)
+{
+  const char* p = line.c_str();
+  int n = 0;
+  fields[n++] = p;
+  for(; *p; ++p)
+  {
+    if(*p == '\t')
+    {
+      if(n == max)
+      {
+        return max + 1;
+      }
+      fields[n++] = p + 1;
+    }
+  }
+  return n;
+}
+
+static bool toInt(const char* begin, int* value)
+{
+  char* end;
+  long result = std::strtol(begin, &end, 10);
+  *value = (int)result;
+  return end != begin && (*end == '\t' || *end == '\0');
+}
+
+static bool toDouble(const char* begin, double* value)
+{
+  char* end;
+  *value = std::strtod(begin, &end);
+  return end != begin && (*end == '\t' || *end == '\0');
+}
+
+static std::string toField(const char* begin)
+{
+  const char* end = begin;
+  while(*end && *end != '\t')
+  {
+    ++end;
+  }
+  return std::string(begin, end);
+}
+
+SimFileReader::SimFileReader(openstudio::path path, Type type, const std::vector<int>& nrs)
+  : m_type(type), m_pending(false), m_failed(false), m_select(!nrs.empty()), m_warned(false), m_steps(0)
+{
+  for(int nr : nrs)
+  {
+    if(nr >= 0 && index(nr) == -1)
+    {
+      addNumber(nr);
+    }
+  }
+  const char* label = m_type == Paths ? "LFR" : "NFR";
+  openstudio::path filePath = path.replace_extension(openstudio::toPath(m_type == Paths ? "lfr" : "nfr").string());
+  m_fileName = openstudio::toString(filePath);
+  m_file.open(filePath);
+  if(!m_file.is_open())
+  {
+    LOG(Error,"Failed to open " << label << " file '" << m_fileName << "'");
+    m_failed = true;
+    return;
+  }
+  // Read the header
+  if(!readLine())
+  {
+    LOG(Error,"No data in " << label << " file '" << m_fileName << "'");
+    fail();
+    return;
+  }
+  const char* fields[8];
+  int ncols = splitFields(m_line, fields, 8);
+  if(ncols != 6 && (m_type == Paths || ncols != 8))
+  {
+    LOG(Error,label << " file has " << ncols << " columns, not the expected 6");
+    fail();
+  }
+}
+
+int SimFileReader::index(int nr) const
+{
+  if(nr < 0 || (unsigned)nr >= m_slots.size())
+  {
+    return -1;
+  }
+  return m_slots[nr];
+}
+
+bool SimFileReader::next()
+{
+  if(m_failed || !m_file.is_open())
+  {
+    return false;
+  }
+  const char* label = m_type == Paths ? "LFR" : "NFR";
+  for(std::vector<double>& values : m_values)
+  {
+    std::fill(values.begin(), values.end(), 0.0);
+  }
+  bool started = false;
+  while(m_pending || readLine())
+  {
+    m_pending = false;
+    const char* fields[8];
+    int ncols = splitFields(m_line, fields, 8);
+    if(ncols != 6 && (m_type == Paths || ncols != 8))
+    {
+      LOG(Error,label << " data line has " << ncols << " columns, not the expected 6");
+      fail();
+      return false;
+    }
+    // A change in the day or time starts the next time step
+    std::size_t dayLength = fields[1] - fields[0] - 1;
+    std::size_t timeLength = fields[2] - fields[1] - 1;
+    if(!started)
+    {
+      m_day.assign(fields[0], dayLength);
+      m_time.assign(fields[1], timeLength);
+      started = true;
+    }
+    else if(m_day.compare(0, std::string::npos, fields[0], dayLength) != 0
+      || m_time.compare(0, std::string::npos, fields[1], timeLength) != 0)
+    {
+      m_pending = true;
+      break;
+    }
+
+    int nr = 0;
+    if(!toInt(fields[2], &nr) || nr < 0)
+    {
+      LOG(Error,"Invalid " << (m_type == Paths ? "link" : "node") << " number '" << toField(fields[2]) << "'");
+      fail();
+      return false;
+    }
+    double values[3];
+    for(int i=0; i<3; i++)
+    {
+      if(!toDouble(fields[3+i], &values[i]))
+      {
+        // The ambient node does not have a meaningful density
+        if(m_type == Nodes && i == 2 && nr == 0)
+        {
+          values[i] = 0.0;
+        }
+        else
+        {
+          LOG(Error,"Invalid value '" << toField(fields[3+i]) << "' in " << label << " file '" << m_fileName << "'");
+          fail();
+          return false;
+        }
+      }
+    }
+
+    int slot = index(nr);
+    if(slot == -1 && !m_select)
+    {
+      if(m_steps == 0)
+      {
+        slot = addNumber(nr);
+      }
+      else if(!m_warned)
+      {
+        LOG(Warn,"Number " << nr << " in " << label << " file '" << m_fileName << "' is not in the first time step and will be skipped");
+        m_warned = true;
+      }
+    }
+    if(slot != -1)
+    {
+      m_values[0][slot] = values[0];
+      m_values[1][slot] = values[1];
+      m_values[2][slot] = values[2];
+    }
+  }
+  if(!started)
+  {
+    return false;
+  }
+
+  std::vector<std::string> split;
+  boost::split(split, m_day, boost::is_any_of("/"));
+  try {
+    if(split.size() != 2)
+    {
+      throw std::runtime_error("Invalid day");
+    }
+    unsigned month = std::stoul(split[0]);
+    unsigned dayOfMonth = std::stoul(split[1]);
+    if(month > 12)
+    {
+      throw std::runtime_error("Invalid month");
+    }
+    m_dateTime = DateTime(Date(monthOfYear(month), dayOfMonth), Time(m_time));
+  } catch(const std::exception&) {
+    LOG(Error,"Failed to compute date and time from '" << m_day << "' and '" << m_time << "' in " << label << " file");
+    fail();
+    return false;
+  }
+  ++m_steps;
+  return true;
+}
+
+bool SimFileReader::readLine()
+{
+  while(std::getline(m_file, m_line))
+  {
+    if(!m_line.empty() && m_line.back() == '\r')
+    {
+      m_line.pop_back();
+    }
+    if(!m_line.empty())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+int SimFileReader::addNumber(int nr)
+{
+  if((unsigned)nr >= m_slots.size())
+  {
+    m_slots.resize(nr + 1, -1);
+  }
+  int slot = m_nrs.size();
+  m_slots[nr] = slot;
+  m_nrs.push_back(nr);
+  for(std::vector<double>& values : m_values)
+  {
+    values.push_back(0.0);
+  }
+  return slot;
+}
+
+void SimFileReader::fail()
+{
+  m_failed = true;
+  m_pending = false;
+  m_file.close();
+}
+
 /*
 
 This code is a holdover from earlier versions that also read in contaminants. Hopefully, this text-based
@@ -115,6 +115,102 @@ private:
   REGISTER_LOGGER("openstudio.contam.SimFile");
 };
 
+/** SimFileReader streams the path (LFR) or node (NFR) results that accompany a CONTAM
+ *  SIM file one time step at a time, so that large transient results can be processed
+ *  without holding the whole file in memory. After each successful call to next(), the
+ *  values for the current time step are available in flat buffers with one entry per
+ *  path or node number in numbers(). */
+class AIRFLOW_API SimFileReader {
+public:
+  enum Type {Paths, Nodes};
+
+  /** Open the LFR (for paths) or NFR (for nodes) file that goes with the SIM file at path.
+   *  If nrs is not empty, only those path or node numbers are kept, in the order given.
+   *  Otherwise, every path or node in the first time step is kept, in file order. */
+  SimFileReader(openstudio::path path, Type type, const std::vector<int>& nrs = std::vector<int>());
+
+  /** Read the next time step. Returns false at the end of the file or on error. */
+  bool next();
+  /** Returns true if the file could not be opened or contained invalid data. */
+  bool failed() const
+  {
+    return m_failed;
+  }
+
+  Type type() const
+  {
+    return m_type;
+  }
+  /** Returns the CONTAM path or node numbers that the value buffers are indexed by. */
+  const std::vector<int>& numbers() const
+  {
+    return m_nrs;
+  }
+  /** Returns the buffer index of a CONTAM path or node number, or -1 if it is not kept. */
+  int index(int nr) const;
+  /** Returns the number of time steps read so far. */
+  unsigned steps() const
+  {
+    return m_steps;
+  }
+  /** Returns the time of the current time step as given in the file. */
+  openstudio::DateTime dateTime() const
+  {
+    return m_dateTime;
+  }
+
+  // Path results at the current time step
+  const std::vector<double>& deltaP() const
+  {
+    return m_values[0];
+  }
+  const std::vector<double>& flow0() const
+  {
+    return m_values[1];
+  }
+  const std::vector<double>& flow1() const
+  {
+    return m_values[2];
+  }
+
+  // Node results at the current time step
+  const std::vector<double>& temperature() const
+  {
+    return m_values[0];
+  }
+  const std::vector<double>& pressure() const
+  {
+    return m_values[1];
+  }
+  const std::vector<double>& density() const
+  {
+    return m_values[2];
+  }
+
+private:
+  bool readLine();
+  int addNumber(int nr);
+  void fail();
+
+  Type m_type;
+  openstudio::filesystem::ifstream m_file;
+  std::string m_fileName;
+  std::string m_line;
+  bool m_pending;
+  bool m_failed;
+  bool m_select;
+  bool m_warned;
+  unsigned m_steps;
+  std::string m_day;
+  std::string m_time;
+  openstudio::DateTime m_dateTime;
+  std::vector<int> m_nrs;
+  std::vector<int> m_slots;  // buffer index by CONTAM number, -1 if not kept
+  std::vector<double> m_values[3];
+
+  REGISTER_LOGGER("openstudio.contam.SimFileReader");
+};
+
 } // contam
 } // openstudio
 
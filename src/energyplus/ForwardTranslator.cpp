@@ -63,12 +63,14 @@
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
 #include "../utilities/idf/IdfFile.hpp"
 #include "../utilities/idf/WorkspaceObjectOrder.hpp"
+#include "../utilities/idf/WorkspaceChangeTracker.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/time/Time.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
+#include "../utilities/core/Tracing.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
@@ -110,10 +112,38 @@ ForwardTranslator::ForwardTranslator()
   m_excludeSQliteOutputReport = false;
   m_excludeHTMLOutputReport = false;
   m_excludeVariableDictionary = false;
+
+  m_translationProfiling = false;
+
+  m_lastTranslationWasIncremental = false;
 }
 
+struct ForwardTranslator::IncrementalTranslationState
+{
+  IncrementalTranslationState(const Model& t_model)
+    : model(t_model), tracker(t_model)
+  {}
+
+  // the model passed to translateModelIncremental, and the copy that was translated
+  Model model;
+  boost::optional<Model> modelCopy;
+
+  // records changes to model since the last translation
+  WorkspaceChangeTracker tracker;
+
+  boost::optional<Workspace> workspace;
+
+  // handle of each IdfObject in m_idfObjects to its index there and to the handle of the object made from it in workspace
+  std::unordered_map<Handle, std::pair<size_t, Handle>, boost::hash<boost::uuids::uuid> > idfObjectLocations;
+};
+
 Workspace ForwardTranslator::translateModel( const Model & model, ProgressBar* progressBar )
 {
+  OS_TRACE_SCOPE("energyplus", "ForwardTranslator::translateModel");
+
+  m_incrementalState.reset();
+  m_lastTranslationWasIncremental = false;
+
   Model modelCopy = model.clone(true).cast<Model>();
 
   m_progressBar = progressBar;
@@ -127,6 +157,9 @@ Workspace ForwardTranslator::translateModel( const Model & model, ProgressBar* p
 
 Workspace ForwardTranslator::translateModelObject( ModelObject & modelObject )
 {
+  m_incrementalState.reset();
+  m_lastTranslationWasIncremental = false;
+
   Model modelCopy;
   modelObject.clone(modelCopy);
 
@@ -135,6 +168,189 @@ Workspace ForwardTranslator::translateModelObject( ModelObject & modelObject )
   return translateModelPrivate(modelCopy, false);
 }
 
+Workspace ForwardTranslator::translateModelIncremental( const Model & model, ProgressBar* progressBar )
+{
+  OS_TRACE_SCOPE("energyplus", "ForwardTranslator::translateModelIncremental");
+
+  if (m_incrementalState && (m_incrementalState->model == model) && m_incrementalState->workspace){
+    m_progressBar = nullptr;
+    if (retranslateChangedObjects()){
+      m_incrementalState->tracker.clearState();
+      m_lastTranslationWasIncremental = true;
+      return *m_incrementalState->workspace;
+    }
+    LOG(Info, "Model changes cannot be translated incrementally, translating the full model.");
+  }
+
+  m_incrementalState.reset();
+  m_lastTranslationWasIncremental = false;
+
+  std::shared_ptr<IncrementalTranslationState> state = std::make_shared<IncrementalTranslationState>(model);
+  state->modelCopy = model.clone(true).cast<Model>();
+
+  m_progressBar = progressBar;
+  if (m_progressBar){
+    m_progressBar->setMinimum(0);
+    m_progressBar->setMaximum(model.numObjects());
+  }
+
+  // translateModelPrivate records where each IdfObject ends up in the workspace
+  m_incrementalState = state;
+  state->workspace = translateModelPrivate(*state->modelCopy, true);
+  state->tracker.clearState();
+
+  return *state->workspace;
+}
+
+bool ForwardTranslator::lastTranslationWasIncremental() const
+{
+  return m_lastTranslationWasIncremental;
+}
+
+bool ForwardTranslator::isIncrementallyTranslatable(const IddObjectType& iddObjectType)
+{
+  // these translate one to one from their own fields, other translators only use their names
+  // coils translated with a CoilSystem wrapper produce two objects, and coils inside a unitary or zone HVAC
+  // component get their nodes from the parent translator, both fall back to a full translation
+  switch (iddObjectType.value())
+  {
+  case openstudio::IddObjectType::OS_Material :
+  case openstudio::IddObjectType::OS_Material_NoMass :
+  case openstudio::IddObjectType::OS_WindowMaterial_Glazing :
+  case openstudio::IddObjectType::OS_WindowMaterial_SimpleGlazingSystem :
+  case openstudio::IddObjectType::OS_Curve_Bicubic :
+  case openstudio::IddObjectType::OS_Curve_Biquadratic :
+  case openstudio::IddObjectType::OS_Curve_Cubic :
+  case openstudio::IddObjectType::OS_Curve_Exponent :
+  case openstudio::IddObjectType::OS_Curve_Linear :
+  case openstudio::IddObjectType::OS_Curve_Quadratic :
+  case openstudio::IddObjectType::OS_Curve_QuadraticLinear :
+  case openstudio::IddObjectType::OS_Curve_Quartic :
+  case openstudio::IddObjectType::OS_Curve_Triquadratic :
+  case openstudio::IddObjectType::OS_Schedule_Constant :
+  case openstudio::IddObjectType::OS_Schedule_Day :
+  case openstudio::IddObjectType::OS_Coil_Cooling_DX_SingleSpeed :
+  case openstudio::IddObjectType::OS_Coil_Heating_DX_SingleSpeed :
+  case openstudio::IddObjectType::OS_Coil_Heating_Electric :
+  case openstudio::IddObjectType::OS_Coil_Heating_Gas :
+    return true;
+  default:
+    return false;
+  }
+}
+
+bool ForwardTranslator::retranslateChangedObjects()
+{
+  IncrementalTranslationState& state = *m_incrementalState;
+
+  if (!state.tracker.removedHandles().empty()){
+    return false;
+  }
+
+  // copy data field changes to the translated model copy, other objects' translations may use names and pointers
+  std::vector<ModelObject> changedObjects;
+  for (const Handle& handle : state.tracker.changedHandles()){
+    boost::optional<WorkspaceObject> object = state.model.getObject(handle);
+    boost::optional<WorkspaceObject> copy = state.modelCopy->getObject(handle);
+    if (!object || !copy || !isIncrementallyTranslatable(object->iddObject().type()) || (m_map.find(handle) == m_map.end())){
+      return false;
+    }
+
+    if ((object->nameString() != copy->nameString()) || (object->numFields() < copy->numFields())){
+      return false;
+    }
+
+    // parent translators fill in the node names of components they contain, which a translation of the component alone leaves empty
+    boost::optional<HVACComponent> hvacComponent = copy->optionalCast<HVACComponent>();
+    if (hvacComponent && isHVACComponentWithinUnitary(*hvacComponent)){
+      return false;
+    }
+
+    bool changed = false;
+    for (unsigned i = 0, n = object->numFields(); i < n; ++i){
+      if (object->isObjectListField(i)){
+        boost::optional<WorkspaceObject> target = object->getTarget(i);
+        boost::optional<WorkspaceObject> copyTarget = copy->getTarget(i);
+        if ((bool(target) != bool(copyTarget)) || (target && (target->handle() != copyTarget->handle()))){
+          return false;
+        }
+        continue;
+      }
+      boost::optional<std::string> value = object->getString(i);
+      if (value != copy->getString(i)){
+        if (!copy->setString(i, value.get_value_or(std::string()))){
+          return false;
+        }
+        changed = true;
+      }
+    }
+
+    if (changed){
+      changedObjects.push_back(copy->cast<ModelObject>());
+    }
+  }
+
+  // each changed object must translate to exactly one new IdfObject, which replaces the previous one
+  std::vector<std::pair<IdfObject, IdfObject> > replacements;
+  for (ModelObject& modelObject : changedObjects){
+    auto it = m_map.find(modelObject.handle());
+    IdfObject oldIdfObject = it->second;
+    m_map.erase(it);
+
+    size_t numIdfObjects = m_idfObjects.size();
+    boost::optional<IdfObject> newIdfObject = translateAndMapModelObject(modelObject);
+    if (!newIdfObject || (m_idfObjects.size() != numIdfObjects + 1) || (m_idfObjects.back() != *newIdfObject)){
+      return false;
+    }
+    m_idfObjects.pop_back();
+
+    auto location = state.idfObjectLocations.find(oldIdfObject.handle());
+    if (location == state.idfObjectLocations.end()){
+      return false;
+    }
+    boost::optional<WorkspaceObject> workspaceObject = state.workspace->getObject(location->second.second);
+    if (!workspaceObject || (workspaceObject->numFields() > newIdfObject->numFields())){
+      return false;
+    }
+
+    // the workspace is only patched once every replacement is known to apply, so it is never left half updated;
+    // names and pointers are resolved against other objects, only plain data fields can be patched in place
+    const IddObject& iddObject = workspaceObject->iddObject();
+    for (unsigned i = 0, n = newIdfObject->numFields(); i < n; ++i){
+      if (newIdfObject->getString(i) == workspaceObject->getString(i)){
+        continue;
+      }
+      if (((i == 0) && iddObject.hasNameField()) || workspaceObject->isObjectListField(i) ||
+          !(iddObject.isNonextensibleField(i) || iddObject.isExtensibleField(i))){
+        return false;
+      }
+    }
+
+    replacements.push_back(std::make_pair(oldIdfObject, *newIdfObject));
+  }
+
+  // the workspace has no strictness checks, so setting the data fields checked above cannot fail
+  OS_ASSERT(state.workspace->strictnessLevel() == StrictnessLevel::None);
+  for (const auto& replacement : replacements){
+    auto location = state.idfObjectLocations.find(replacement.first.handle());
+    std::pair<size_t, Handle> indexAndHandle = location->second;
+    state.idfObjectLocations.erase(location);
+    state.idfObjectLocations.insert(std::make_pair(replacement.second.handle(), indexAndHandle));
+    m_idfObjects[indexAndHandle.first] = replacement.second;
+
+    WorkspaceObject workspaceObject = state.workspace->getObject(indexAndHandle.second).get();
+    for (unsigned i = 0, n = replacement.second.numFields(); i < n; ++i){
+      boost::optional<std::string> value = replacement.second.getString(i);
+      if (value != workspaceObject.getString(i)){
+        bool ok = workspaceObject.setString(i, value.get_value_or(std::string()));
+        OS_ASSERT(ok);
+      }
+    }
+  }
+
+  return true;
+}
+
 std::vector<LogMessage> ForwardTranslator::warnings() const
 {
   std::vector<LogMessage> result;
@@ -165,34 +381,121 @@ std::vector<LogMessage> ForwardTranslator::errors() const
 void ForwardTranslator::setKeepRunControlSpecialDays(bool keepRunControlSpecialDays)
 {
   m_keepRunControlSpecialDays = keepRunControlSpecialDays;
+  m_incrementalState.reset();
 }
 
 void ForwardTranslator::setIPTabularOutput(bool isIP)
 {
   m_ipTabularOutput = isIP;
+  m_incrementalState.reset();
 }
 
 void ForwardTranslator::setExcludeLCCObjects(bool excludeLCCObjects)
 {
   m_excludeLCCObjects = excludeLCCObjects;
+  m_incrementalState.reset();
 }
 
 void ForwardTranslator::setExcludeSQliteOutputReport(bool excludeSQliteOutputReport) {
   m_excludeSQliteOutputReport = excludeSQliteOutputReport;
+  m_incrementalState.reset();
 }
 
 void ForwardTranslator::setExcludeHTMLOutputReport(bool excludeHTMLOutputReport) {
   m_excludeHTMLOutputReport = excludeHTMLOutputReport;
+  m_incrementalState.reset();
 }
 
 void ForwardTranslator::setExcludeVariableDictionary(bool excludeVariableDictionary) {
   m_excludeVariableDictionary = excludeVariableDictionary;
+  m_incrementalState.reset();
+}
+
+void ForwardTranslator::setTranslationProfiling(bool translationProfiling) {
+  m_translationProfiling = translationProfiling;
+}
+
+std::vector<IddObjectType> ForwardTranslator::profiledIddObjectTypes() const
+{
+  std::vector<std::pair<double, IddObjectType> > sorted;
+  for (const auto& profile : m_translationProfile){
+    sorted.push_back(std::make_pair(profile.second.second, profile.first));
+  }
+  std::stable_sort(sorted.begin(), sorted.end(), [](const std::pair<double, IddObjectType>& a, const std::pair<double, IddObjectType>& b){
+    return a.first > b.first;
+  });
+
+  std::vector<IddObjectType> result;
+  for (const auto& entry : sorted){
+    result.push_back(entry.second);
+  }
+  return result;
+}
+
+unsigned ForwardTranslator::profiledTranslationCount(const IddObjectType& iddObjectType) const
+{
+  auto it = m_translationProfile.find(iddObjectType);
+  if (it != m_translationProfile.end()){
+    return it->second.first;
+  }
+  return 0;
+}
+
+double ForwardTranslator::profiledTranslationTime(const IddObjectType& iddObjectType) const
+{
+  auto it = m_translationProfile.find(iddObjectType);
+  if (it != m_translationProfile.end()){
+    return it->second.second;
+  }
+  return 0.0;
+}
+
+void ForwardTranslator::startTranslationProfile()
+{
+  if (m_translationProfiling){
+    m_translationProfileStack.push_back(std::make_pair(std::chrono::steady_clock::now(), 0.0));
+  }
+}
+
+void ForwardTranslator::stopTranslationProfile(const IddObjectType& iddObjectType)
+{
+  if (!m_translationProfiling || m_translationProfileStack.empty()){
+    return;
+  }
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_translationProfileStack.back().first;
+  double exclusive = elapsed.count() - m_translationProfileStack.back().second;
+  m_translationProfileStack.pop_back();
+
+  // do not count this time again for the object that triggered this translation
+  if (!m_translationProfileStack.empty()){
+    m_translationProfileStack.back().second += elapsed.count();
+  }
+
+  std::pair<unsigned, double>& profile = m_translationProfile[iddObjectType];
+  profile.first += 1;
+  profile.second += exclusive;
+}
+
+ForwardTranslator::TranslationProfileScope::TranslationProfileScope(ForwardTranslator& translator, const IddObjectType& iddObjectType)
+  : m_translator(translator), m_iddObjectType(iddObjectType)
+{
+  m_translator.startTranslationProfile();
+}
+
+ForwardTranslator::TranslationProfileScope::~TranslationProfileScope()
+{
+  m_translator.stopTranslationProfile(m_iddObjectType);
 }
 
 Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool fullModelTranslation )
 {
   reset();
 
+  // most model objects map to at least one IdfObject
+  m_map.reserve(model.numObjects());
+  m_idfObjects.reserve(model.numObjects());
+
   // translate Version first
   model::Version version = model.getUniqueModelObject<model::Version>();
   translateAndMapModelObject(version);
@@ -635,14 +938,23 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     this->createStandardOutputRequests();
   }
 
+  OS_TRACE_SCOPE("energyplus", "ForwardTranslator::createWorkspace");
   Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
   OptionalWorkspaceObject vo = workspace.versionObject();
   OS_ASSERT(vo);
   workspace.removeObject(vo->handle());
 
   workspace.setFastNaming(true);
-  workspace.addObjects(m_idfObjects);
+  std::vector<WorkspaceObject> workspaceObjects = workspace.addObjects(m_idfObjects);
   workspace.setFastNaming(false);
+
+  if (m_incrementalState && (workspaceObjects.size() == m_idfObjects.size())){
+    m_incrementalState->idfObjectLocations.reserve(m_idfObjects.size());
+    for (size_t i = 0; i < m_idfObjects.size(); ++i){
+      m_incrementalState->idfObjectLocations.insert(std::make_pair(m_idfObjects[i].handle(), std::make_pair(i, workspaceObjects[i].handle())));
+    }
+  }
+
   OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1u);
 
   return workspace;
@@ -650,19 +962,29 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
 
 // struct for sorting children in forward translator
 struct ChildSorter {
-  ChildSorter(std::vector<IddObjectType>& iddObjectTypes)
-    : m_iddObjectTypes(iddObjectTypes)
+  ChildSorter(const std::unordered_map<int, size_t>& iddObjectTypeOrder)
+    : m_iddObjectTypeOrder(iddObjectTypeOrder)
   {}
 
+  // position in iddObjectTypes, types not translated sort last
+  size_t position(const model::ModelObject& modelObject) const
+  {
+    auto it = m_iddObjectTypeOrder.find(modelObject.iddObject().type().value());
+    if (it == m_iddObjectTypeOrder.end()){
+      return m_iddObjectTypeOrder.size();
+    }
+    return it->second;
+  }
+
   // sort first by position in iddObjectTypes and then by name
   bool operator()(const model::ModelObject& a, const model::ModelObject& b) const
   {
-    auto ita = std::find(m_iddObjectTypes.begin(), m_iddObjectTypes.end(), a.iddObject().type());
-    auto itb = std::find(m_iddObjectTypes.begin(), m_iddObjectTypes.end(), b.iddObject().type());
+    size_t pa = position(a);
+    size_t pb = position(b);
 
-    if (ita < itb){
+    if (pa < pb){
       return true;
-    }else if (ita > itb){
+    }else if (pa > pb){
       return false;
     }
 
@@ -679,7 +1001,7 @@ struct ChildSorter {
     return istringLess(aname, bname);
   }
 
-  std::vector<IddObjectType> m_iddObjectTypes;
+  const std::unordered_map<int, size_t>& m_iddObjectTypeOrder;
 };
 
 boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelObject & modelObject)
@@ -695,6 +1017,10 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
 
   LOG(Trace,"Translating " << modelObject.briefDescription() << ".");
 
+  // one event per object, named by type so time can be aggregated by type in the trace viewer
+  OS_TRACE_SCOPE_DETAIL("energyplus", modelObject.iddObject().type().valueName(), modelObject.nameString());
+  TranslationProfileScope profileScope(*this, modelObject.iddObjectType());
+
   switch(modelObject.iddObject().type().value())
   {
   case openstudio::IddObjectType::OS_AdditionalProperties :
@@ -3434,14 +3760,14 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
   if(opo)
   {
     ModelObjectVector children = opo->children();
-    IddObjectTypeVector types = iddObjectsToTranslate();
+    const std::unordered_map<int, size_t>& order = iddObjectsToTranslateOrder();
 
     // sort these objects as well
-    std::sort(children.begin(), children.end(), ChildSorter(types));
+    std::sort(children.begin(), children.end(), ChildSorter(order));
 
     for(auto & elem : children)
     {
-      if (std::find(types.begin(),types.end(),elem.iddObject().type()) != types.end()) {
+      if (order.find(elem.iddObject().type().value()) != order.end()) {
         translateAndMapModelObject(elem);
       }
     }
@@ -3464,12 +3790,26 @@ std::string ForwardTranslator::stripOS2(const string& s)
   return result;
 }
 
-std::vector<IddObjectType> ForwardTranslator::iddObjectsToTranslate()
+const std::vector<IddObjectType>& ForwardTranslator::iddObjectsToTranslate()
 {
   static const std::vector<IddObjectType> result = iddObjectsToTranslateInitializer();
   return result;
 }
 
+const std::unordered_map<int, size_t>& ForwardTranslator::iddObjectsToTranslateOrder()
+{
+  static const std::unordered_map<int, size_t> result = [](){
+    std::unordered_map<int, size_t> order;
+    const std::vector<IddObjectType>& types = iddObjectsToTranslate();
+    for (size_t i = 0; i < types.size(); ++i){
+      // keep the first position if a type is listed twice, as std::find did
+      order.insert(std::make_pair(types[i].value(), i));
+    }
+    return order;
+  }();
+  return result;
+}
+
 std::vector<IddObjectType> ForwardTranslator::iddObjectsToTranslateInitializer()
 {
   std::vector<IddObjectType> result;
@@ -3714,6 +4054,8 @@ std::vector<IddObjectType> ForwardTranslator::iddObjectsToTranslateInitializer()
 
 void ForwardTranslator::translateConstructions(const model::Model & model)
 {
+  OS_TRACE_SCOPE("energyplus", "ForwardTranslator::translateConstructions");
+
   std::vector<IddObjectType> iddObjectTypes;
   iddObjectTypes.push_back(IddObjectType::OS_MaterialProperty_GlazingSpectralData);
   iddObjectTypes.push_back(IddObjectType::OS_MaterialProperty_MoisturePenetrationDepth_Settings);
@@ -3782,6 +4124,7 @@ void ForwardTranslator::translateConstructions(const model::Model & model)
 
 void ForwardTranslator::translateSchedules(const model::Model & model)
 {
+  OS_TRACE_SCOPE("energyplus", "ForwardTranslator::translateSchedules");
 
   // loop over schedule type limits
   std::vector<WorkspaceObject> objects = model.getObjectsByType(IddObjectType::OS_ScheduleTypeLimits);
@@ -3843,6 +4186,8 @@ void ForwardTranslator::translateSchedules(const model::Model & model)
 
 void ForwardTranslator::translateAirflowNetwork(const model::Model & model)
 {
+  OS_TRACE_SCOPE("energyplus", "ForwardTranslator::translateAirflowNetwork");
+
   // translate AFN if there is a simulation control object
   boost::optional<model::AirflowNetworkSimulationControl> afnSimulationControl = model.getOptionalUniqueModelObject<model::AirflowNetworkSimulationControl>();
   if (afnSimulationControl) {
@@ -4117,6 +4462,12 @@ void ForwardTranslator::reset()
 
   m_constructionHandleToReversedConstructions.clear();
 
+  m_translationProfileStack.clear();
+
+  if (m_translationProfiling){
+    m_translationProfile.clear();
+  }
+
   m_logSink.setThreadId(std::this_thread::get_id());
 
   m_logSink.resetStringStream();
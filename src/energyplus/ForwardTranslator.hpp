@@ -39,6 +39,12 @@
 #include "../utilities/core/StringStreamLogSink.hpp"
 #include "../utilities/time/Time.hpp"
 
+#include <boost/functional/hash.hpp>
+
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+
 namespace openstudio {
 
 class ProgressBar;
@@ -475,6 +481,20 @@ class ENERGYPLUS_API ForwardTranslator {
    */
   Workspace translateModelObject( model::ModelObject & modelObject );
 
+  /** Translates the given Model like translateModel, but keeps the resulting Workspace and the mapping from model
+   *  objects to IdfObjects between calls. When called again with the same Model, only the objects changed since the
+   *  previous call are re-translated and the kept Workspace is updated in place. This applies when all changes are
+   *  data field changes to materials, glazings, performance curves or constant schedules, whose translations do not
+   *  depend on other objects' data. Any other change (adding or removing objects, renaming, changing pointers, or
+   *  changing other object types) falls back to a full translation. Either way the result is the same as that of
+   *  translateModel. The returned Workspace is modified by later calls, clone it to keep a snapshot.
+   */
+  Workspace translateModelIncremental( const model::Model & model, ProgressBar* progressBar=nullptr );
+
+  /** Returns true if the last call to translateModelIncremental only re-translated changed objects.
+   */
+  bool lastTranslationWasIncremental() const;
+
   /** Get warning messages generated by the last translation.
    */
   std::vector<LogMessage> warnings() const;
@@ -511,6 +531,20 @@ class ENERGYPLUS_API ForwardTranslator {
    *  Use this at your own risks */
   void setExcludeVariableDictionary(bool excludeVariableDictionary);
 
+  /** If translationProfiling, record the number of objects translated and the time spent translating them
+   *  for each IddObjectType during subsequent translations. Times exclude nested translation of other objects.
+   *  Off by default. */
+  void setTranslationProfiling(bool translationProfiling);
+
+  /** IddObjectTypes translated by the last profiled translation, sorted by decreasing translation time. */
+  std::vector<IddObjectType> profiledIddObjectTypes() const;
+
+  /** Number of objects of iddObjectType translated by the last profiled translation. */
+  unsigned profiledTranslationCount(const IddObjectType& iddObjectType) const;
+
+  /** Time in seconds spent translating objects of iddObjectType in the last profiled translation. */
+  double profiledTranslationTime(const IddObjectType& iddObjectType) const;
+
  private:
 
   REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
@@ -534,6 +568,15 @@ class ENERGYPLUS_API ForwardTranslator {
 
   boost::optional<IdfObject> translateAndMapModelObject( model::ModelObject & modelObject );
 
+  struct IncrementalTranslationState;
+
+  // true if objects of iddObjectType can be re-translated on their own after data field changes
+  static bool isIncrementallyTranslatable(const IddObjectType& iddObjectType);
+
+  // re-translates the objects changed since the last incremental translation and updates the kept Workspace,
+  // returns false if the changes require a full translation
+  bool retranslateChangedObjects();
+
   boost::optional<IdfObject> translateAirConditionerVariableRefrigerantFlow( model::AirConditionerVariableRefrigerantFlow & modelObject );
 
   boost::optional<IdfObject> translateAirflowNetworkSimulationControl( model::AirflowNetworkSimulationControl & modelObject );
@@ -1386,7 +1429,7 @@ class ENERGYPLUS_API ForwardTranslator {
 
   // reverse a construction if needed
   model::ConstructionBase reverseConstruction(const model::ConstructionBase& construction);
-  std::map<Handle, model::ConstructionBase> m_constructionHandleToReversedConstructions;
+  std::unordered_map<Handle, model::ConstructionBase, boost::hash<boost::uuids::uuid> > m_constructionHandleToReversedConstructions;
 
   // resolve conflicts about constructions in matched surfaces
   void resolveMatchedSurfaceConstructionConflicts(model::Model& model);
@@ -1406,9 +1449,31 @@ class ENERGYPLUS_API ForwardTranslator {
   IdfObject createRegisterAndNameIdfObject(const IddObjectType& idfObjectType,
                                            const model::ModelObject& modelObject);
 
-  static std::vector<IddObjectType> iddObjectsToTranslate();
+  static const std::vector<IddObjectType>& iddObjectsToTranslate();
   static std::vector<IddObjectType> iddObjectsToTranslateInitializer();
 
+  /** Position of each IddObjectType in iddObjectsToTranslate, types which are not translated are not in the map. */
+  static const std::unordered_map<int, size_t>& iddObjectsToTranslateOrder();
+
+  // start and stop timing a call to translateAndMapModelObject if profiling is enabled
+  void startTranslationProfile();
+  void stopTranslationProfile(const IddObjectType& iddObjectType);
+
+  // times a call to translateAndMapModelObject until the end of the scope, whichever way the call returns
+  class TranslationProfileScope
+  {
+   public:
+    TranslationProfileScope(ForwardTranslator& translator, const IddObjectType& iddObjectType);
+    ~TranslationProfileScope();
+
+    TranslationProfileScope(const TranslationProfileScope& other) = delete;
+    TranslationProfileScope& operator=(const TranslationProfileScope& other) = delete;
+
+   private:
+    ForwardTranslator& m_translator;
+    IddObjectType m_iddObjectType;
+  };
+
   /** Determines whether or not the HVACComponent is part of a unitary system or on an
    *  AirLoopHVAC */
   bool isHVACComponentWithinUnitary(const model::HVACComponent& hvacComponent) const;
@@ -1449,7 +1514,7 @@ class ENERGYPLUS_API ForwardTranslator {
    *  Valid refrigerants are: R11, R12, R22, R123, R134a, R404a, R407a, R410a, NH3, R507a, R744 */
   void createFluidPropertiesMap();
 
-  typedef std::map<const openstudio::Handle, const IdfObject> ModelObjectMap;
+  typedef std::unordered_map<openstudio::Handle, IdfObject, boost::hash<boost::uuids::uuid> > ModelObjectMap;
 
   typedef std::map<const std::string, const std::string> FluidPropertiesMap;
 
@@ -1472,6 +1537,16 @@ class ENERGYPLUS_API ForwardTranslator {
   bool m_excludeSQliteOutputReport; // exclude Output:Sqlite
   bool m_excludeHTMLOutputReport;   // exclude Output:Table:SummaryReports
   bool m_excludeVariableDictionary; // exclude Output:VariableDictionary
+
+  bool m_translationProfiling;
+  // start time and time spent in nested translations for each translateAndMapModelObject call on the stack
+  std::vector<std::pair<std::chrono::steady_clock::time_point, double> > m_translationProfileStack;
+  // count and seconds by IddObjectType
+  std::map<IddObjectType, std::pair<unsigned, double> > m_translationProfile;
+
+  // state kept between calls to translateModelIncremental
+  std::shared_ptr<IncrementalTranslationState> m_incrementalState;
+  bool m_lastTranslationWasIncremental;
 };
 
 
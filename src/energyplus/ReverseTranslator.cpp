@@ -72,6 +72,8 @@ boost::optional<model::Model> ReverseTranslator::loadModel(const openstudio::pat
 
   m_untranslatedIdfObjects.clear();
 
+  m_untranslatedHandles.clear();
+
   m_logSink.resetStringStream();
 
   m_logSink.setThreadId(std::this_thread::get_id());
@@ -160,9 +162,12 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
   m_workspace = workspace.clone();
 
   m_workspaceToModelMap.clear();
+  m_workspaceToModelMap.reserve(m_workspace.numObjects());
 
   m_untranslatedIdfObjects.clear();
 
+  m_untranslatedHandles.clear();
+
   // if multiple runperiod objects in idf, remove them all
   vector<WorkspaceObject> runPeriods = m_workspace.getObjectsByType(IddObjectType::RunPeriod);
   if (runPeriods.size() > 1){
@@ -258,19 +263,6 @@ std::vector<IdfObject> ReverseTranslator::untranslatedIdfObjects() const
   return m_untranslatedIdfObjects;
 }
 
-struct IdfObjectEqual {
-  explicit IdfObjectEqual(const IdfObject& target)
-    : m_target(target)
-  {}
-
-  bool operator()(const IdfObject& other) const
-  {
-    return (m_target == other);
-  }
-
-  IdfObject m_target;
-};
-
 boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(const WorkspaceObject & workspaceObject)
 {
   auto i = m_workspaceToModelMap.find(workspaceObject.handle());
@@ -1116,7 +1108,7 @@ boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(c
     m_workspaceToModelMap.insert(make_pair(workspaceObject.handle(), modelObject.get()));
   }else{
     if (addToUntranslated){
-      if (std::find_if(m_untranslatedIdfObjects.begin(), m_untranslatedIdfObjects.end(), IdfObjectEqual(workspaceObject.idfObject())) == m_untranslatedIdfObjects.end()){
+      if (m_untranslatedHandles.insert(workspaceObject.handle()).second){
         LOG(Trace,"Ignoring " << workspaceObject.briefDescription() << ".");
         m_untranslatedIdfObjects.push_back(workspaceObject.idfObject());
       }
@@ -35,6 +35,11 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <boost/functional/hash.hpp>
+
+#include <unordered_map>
+#include <unordered_set>
+
 namespace openstudio {
 
 class ProgressBar;
@@ -359,7 +364,7 @@ class ENERGYPLUS_API ReverseTranslator {
 
   boost::optional<model::ModelObject> translateZoneVentilationWindandStackOpenArea(const WorkspaceObject & workspaceObject);
 
-  std::map<openstudio::Handle,model::ModelObject> m_workspaceToModelMap;
+  std::unordered_map<openstudio::Handle, model::ModelObject, boost::hash<boost::uuids::uuid> > m_workspaceToModelMap;
 
   Workspace m_workspace;
 
@@ -367,6 +372,9 @@ class ENERGYPLUS_API ReverseTranslator {
 
   std::vector<IdfObject> m_untranslatedIdfObjects;
 
+  // handles of the objects in m_untranslatedIdfObjects
+  std::unordered_set<openstudio::Handle, boost::hash<boost::uuids::uuid> > m_untranslatedHandles;
+
   StringStreamLogSink m_logSink;
 
   ProgressBar* m_progressBar;
@@ -50,10 +50,17 @@
 #include "../../model/SiteWaterMainsTemperature.hpp"
 #include "../../model/SiteWaterMainsTemperature_Impl.hpp"
 #include "../../model/Building.hpp"
+#include "../../model/BuildingStory.hpp"
+#include "../../model/BuildingStory_Impl.hpp"
 #include "../../model/ThermalZone.hpp"
+#include "../../model/ThermalZone_Impl.hpp"
 #include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
+#include "../../model/ShadingSurfaceGroup.hpp"
+#include "../../model/ShadingSurfaceGroup_Impl.hpp"
 #include "../../model/Lights.hpp"
 #include "../../model/AirLoopHVAC.hpp"
+#include "../../model/AirLoopHVAC_Impl.hpp"
 #include "../../model/Schedule.hpp"
 #include "../../model/ScheduleCompact.hpp"
 #include "../../model/CurveBiquadratic.hpp"
@@ -62,7 +69,19 @@
 #include "../../model/CurveQuadratic_Impl.hpp"
 #include "../../model/CoilCoolingDXSingleSpeed.hpp"
 #include "../../model/CoilCoolingDXSingleSpeed_Impl.hpp"
+#include "../../model/AirLoopHVACUnitarySystem.hpp"
+#include "../../model/AirLoopHVACUnitarySystem_Impl.hpp"
+#include "../../model/CoilHeatingElectric.hpp"
+#include "../../model/CoilHeatingElectric_Impl.hpp"
+#include "../../model/CoilHeatingGas.hpp"
+#include "../../model/CoilHeatingGas_Impl.hpp"
+#include "../../model/Node.hpp"
+#include "../../model/Node_Impl.hpp"
+#include "../../model/ScheduleDay.hpp"
+#include "../../model/ScheduleRuleset.hpp"
+#include "../../model/ScheduleRuleset_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
+#include "../../model/StandardOpaqueMaterial_Impl.hpp"
 #include "../../model/Construction.hpp"
 #include "../../model/OutputVariable.hpp"
 #include "../../model/OutputVariable_Impl.hpp"
@@ -775,3 +794,189 @@ TEST_F(EnergyPlusFixture, BadVariableName)
     EXPECT_TRUE(s == "Good Name" || s == "Bad, !Name") << s;
   }
 }
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_TranslationProfiling)
+{
+  Model model = exampleModel();
+
+  ForwardTranslator trans;
+  Workspace workspace = trans.translateModel(model);
+  EXPECT_TRUE(trans.profiledIddObjectTypes().empty());
+  EXPECT_EQ(0u, trans.profiledTranslationCount(IddObjectType::OS_ThermalZone));
+
+  trans.setTranslationProfiling(true);
+  Workspace workspace2 = trans.translateModel(model);
+  EXPECT_EQ(workspace.objects().size(), workspace2.objects().size());
+
+  std::vector<IddObjectType> types = trans.profiledIddObjectTypes();
+  ASSERT_FALSE(types.empty());
+  // spaces are combined per thermal zone before translation, zones are translated once each
+  EXPECT_EQ(model.getConcreteModelObjects<ThermalZone>().size(), trans.profiledTranslationCount(IddObjectType::OS_ThermalZone));
+  EXPECT_LE(0.0, trans.profiledTranslationTime(IddObjectType::OS_ThermalZone));
+
+  // stories produce no object and return early from each call, those calls are profiled too
+  EXPECT_LE(model.getConcreteModelObjects<BuildingStory>().size(), trans.profiledTranslationCount(IddObjectType::OS_BuildingStory));
+
+  // sorted by decreasing time
+  for (unsigned i = 1; i < types.size(); ++i){
+    EXPECT_GE(trans.profiledTranslationTime(types[i-1]), trans.profiledTranslationTime(types[i]));
+  }
+
+  // profile is reset for each translation
+  unsigned spaceCount = trans.profiledTranslationCount(IddObjectType::OS_Space);
+  trans.translateModel(model);
+  EXPECT_EQ(spaceCount, trans.profiledTranslationCount(IddObjectType::OS_Space));
+}
+
+// the example model without space shading, whose base surface is picked among equally distant surfaces in object
+// order and so can differ between two full translations of the same model
+Model incrementalTranslationModel()
+{
+  Model model = exampleModel();
+  for (ShadingSurfaceGroup group : model.getConcreteModelObjects<ShadingSurfaceGroup>()){
+    if (group.space()){
+      group.remove();
+    }
+  }
+  return model;
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_TranslateModelIncremental)
+{
+  Model model = incrementalTranslationModel();
+  std::vector<StandardOpaqueMaterial> materials = model.getConcreteModelObjects<StandardOpaqueMaterial>();
+  ASSERT_FALSE(materials.empty());
+  StandardOpaqueMaterial material = materials[0];
+
+  ForwardTranslator trans;
+  Workspace workspace = trans.translateModelIncremental(model);
+  EXPECT_FALSE(trans.lastTranslationWasIncremental());
+
+  // nothing changed
+  trans.translateModelIncremental(model);
+  EXPECT_TRUE(trans.lastTranslationWasIncremental());
+
+  // data field change is applied to the previous workspace
+  EXPECT_TRUE(material.setThickness(material.thickness() * 2.0));
+  Workspace incremental = trans.translateModelIncremental(model);
+  EXPECT_TRUE(trans.lastTranslationWasIncremental());
+  EXPECT_EQ(workspace, incremental);
+
+  ForwardTranslator fullTrans;
+  std::stringstream expected;
+  expected << fullTrans.translateModel(model).toIdfFile();
+  std::stringstream actual;
+  actual << incremental.toIdfFile();
+  EXPECT_EQ(expected.str(), actual.str());
+
+  // renames are referenced by other objects and require a full translation
+  EXPECT_TRUE(material.setName("Renamed Material"));
+  incremental = trans.translateModelIncremental(model);
+  EXPECT_FALSE(trans.lastTranslationWasIncremental());
+
+  expected.str("");
+  expected << fullTrans.translateModel(model).toIdfFile();
+  actual.str("");
+  actual << incremental.toIdfFile();
+  EXPECT_EQ(expected.str(), actual.str());
+
+  // other translations reset the incremental state
+  trans.translateModel(model);
+  trans.translateModelIncremental(model);
+  EXPECT_FALSE(trans.lastTranslationWasIncremental());
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_TranslateModelIncremental_SchedulesAndCoils)
+{
+  Model model = incrementalTranslationModel();
+
+  ForwardTranslator trans;
+  Workspace workspace = trans.translateModelIncremental(model);
+  EXPECT_FALSE(trans.lastTranslationWasIncremental());
+
+  ForwardTranslator fullTrans;
+  std::stringstream expected;
+  std::stringstream actual;
+
+  // day schedule values
+  std::vector<ScheduleRuleset> schedules = model.getConcreteModelObjects<ScheduleRuleset>();
+  ASSERT_FALSE(schedules.empty());
+  ScheduleDay day = schedules[0].defaultDaySchedule();
+  std::vector<double> values = day.values();
+  ASSERT_FALSE(values.empty());
+  for (double& value : values){
+    value *= 0.5;
+  }
+  EXPECT_TRUE(day.setValues(day.times(), values));
+  EXPECT_EQ(workspace, trans.translateModelIncremental(model));
+  EXPECT_TRUE(trans.lastTranslationWasIncremental());
+
+  // rated field of a coil on an air loop
+  std::vector<CoilHeatingGas> heatingCoils = model.getConcreteModelObjects<CoilHeatingGas>();
+  ASSERT_FALSE(heatingCoils.empty());
+  EXPECT_TRUE(heatingCoils[0].setGasBurnerEfficiency(0.9));
+  EXPECT_EQ(workspace, trans.translateModelIncremental(model));
+  EXPECT_TRUE(trans.lastTranslationWasIncremental());
+
+  expected << fullTrans.translateModel(model).toIdfFile();
+  actual << workspace.toIdfFile();
+  EXPECT_EQ(expected.str(), actual.str());
+
+  // a DX coil outside of a unitary is translated with its CoilSystem wrapper and needs a full translation,
+  // the other change must not be applied to the previously returned workspace either
+  std::stringstream before;
+  before << workspace.toIdfFile();
+  EXPECT_TRUE(heatingCoils[0].setGasBurnerEfficiency(0.85));
+  std::vector<CoilCoolingDXSingleSpeed> coolingCoils = model.getConcreteModelObjects<CoilCoolingDXSingleSpeed>();
+  ASSERT_FALSE(coolingCoils.empty());
+  EXPECT_TRUE(coolingCoils[0].setRatedCOP(3.5));
+  Workspace full = trans.translateModelIncremental(model);
+  EXPECT_FALSE(trans.lastTranslationWasIncremental());
+  EXPECT_NE(workspace, full);
+
+  actual.str("");
+  actual << workspace.toIdfFile();
+  EXPECT_EQ(before.str(), actual.str());
+
+  expected.str("");
+  expected << fullTrans.translateModel(model).toIdfFile();
+  actual.str("");
+  actual << full.toIdfFile();
+  EXPECT_EQ(expected.str(), actual.str());
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_TranslateModelIncremental_CoilInUnitary)
+{
+  Model model = incrementalTranslationModel();
+  std::vector<AirLoopHVAC> airLoops = model.getConcreteModelObjects<AirLoopHVAC>();
+  ASSERT_FALSE(airLoops.empty());
+
+  AirLoopHVACUnitarySystem unitary(model);
+  Schedule schedule = model.alwaysOnDiscreteSchedule();
+  CoilHeatingElectric coil(model, schedule);
+  EXPECT_TRUE(unitary.setHeatingCoil(coil));
+  Node supplyOutletNode = airLoops[0].supplyOutletNode();
+  EXPECT_TRUE(unitary.addToNode(supplyOutletNode));
+
+  ForwardTranslator trans;
+  Workspace workspace = trans.translateModelIncremental(model);
+  EXPECT_FALSE(trans.lastTranslationWasIncremental());
+
+  // the unitary translator sets the coil's air nodes, a translation of the coil alone would leave them empty
+  std::stringstream before;
+  before << workspace.toIdfFile();
+  EXPECT_TRUE(coil.setEfficiency(0.9));
+  Workspace result = trans.translateModelIncremental(model);
+  EXPECT_FALSE(trans.lastTranslationWasIncremental());
+
+  std::stringstream actual;
+  actual << workspace.toIdfFile();
+  EXPECT_EQ(before.str(), actual.str());
+
+  ForwardTranslator fullTrans;
+  std::stringstream expected;
+  expected << fullTrans.translateModel(model).toIdfFile();
+  actual.str("");
+  actual << result.toIdfFile();
+  EXPECT_EQ(expected.str(), actual.str());
+}
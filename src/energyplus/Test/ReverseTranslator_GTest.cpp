@@ -1205,3 +1205,17 @@ TEST_F(EnergyPlusFixture, ReverseTranslator_SurfaceControlMovableInsulation) {
   std::vector<Schedule> schedules = model.getModelObjects<Schedule>();
   ASSERT_EQ(2u, schedules.size()); // Schedule Constant 1 and Schedule 1
 }
+
+TEST_F(EnergyPlusFixture, ReverseTranslator_UntranslatedIdfObjectsAreUnique) {
+  Workspace ws(StrictnessLevel::None, IddFileType::EnergyPlus);
+  OptionalWorkspaceObject owo = ws.addObject(IdfObject(IddObjectType::AirLoopHVAC));
+  ASSERT_TRUE(owo);
+  EXPECT_TRUE(owo->setName("Air Loop"));
+
+  // the air loop is visited once on its own and again with the remaining objects
+  ReverseTranslator translator;
+  Model model = translator.translateWorkspace(ws);
+  std::vector<IdfObject> untranslated = translator.untranslatedIdfObjects();
+  ASSERT_EQ(1u, untranslated.size());
+  EXPECT_EQ(owo->handle(), untranslated[0].handle());
+}
@@ -0,0 +1,96 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include "../../utilities/benchmark/BenchmarkHelpers.hpp"
+#include "../../model/benchmark/BenchmarkModels.hpp"
+
+#include "../ForwardTranslator.hpp"
+#include "../ReverseTranslator.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../utilities/core/Path.hpp"
+#include "../../utilities/idf/Workspace.hpp"
+
+#include <resources.hxx>
+
+#include <string>
+#include <vector>
+
+using namespace openstudio;
+using namespace openstudio::energyplus;
+
+namespace {
+
+  // large IDF inputs from the test resources
+  const std::vector<std::string>& largeIdfFiles() {
+    static const std::vector<std::string> files{
+      "energyplus/5ZoneAirCooled/in.idf",
+      "energyplus/RefLargeOffice/RefBldgLargeOfficeNew2004_Chicago.idf",
+      "energyplus/HospitalBaseline/in.idf",
+    };
+    return files;
+  }
+
+}
+
+static void BM_ReverseTranslatorLoadModel(benchmark::State& state) {
+  const std::string& file = largeIdfFiles()[state.range(0)];
+  openstudio::path p = resourcesPath() / toPath(file);
+  state.SetLabel(file);
+  for (auto _ : state) {
+    ReverseTranslator reverseTranslator;
+    boost::optional<model::Model> model = reverseTranslator.loadModel(p);
+    if (!model) {
+      state.SkipWithError("Unable to load and translate IDF");
+      break;
+    }
+    benchmark::DoNotOptimize(model);
+  }
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_ReverseTranslatorLoadModel)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
+
+static void BM_ReverseTranslatorTranslateWorkspace(benchmark::State& state) {
+  model::Model model = model::makeBenchmarkModel(static_cast<unsigned>(state.range(0)), static_cast<unsigned>(state.range(1)));
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  for (auto _ : state) {
+    ReverseTranslator reverseTranslator;
+    model::Model result = reverseTranslator.translateWorkspace(workspace);
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["objects"] = static_cast<double>(workspace.numObjects());
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_ReverseTranslatorTranslateWorkspace)
+  ->Args({10, 1})
+  ->Args({100, 10})
+  ->Args({1000, 100})
+  ->Unit(benchmark::kMillisecond);
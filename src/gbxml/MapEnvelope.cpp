@@ -58,7 +58,7 @@
 namespace openstudio {
 namespace gbxml {
 
-  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateConstruction(const pugi::xml_node& element, const std::unordered_map<std::string, pugi::xml_node> &layerElements, openstudio::model::Model& model)
+  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateConstruction(const pugi::xml_node& element, openstudio::model::Model& model)
   {
     // Krishnan, this constructor should only be used for unique objects like Building and Site
     //openstudio::model::Construction construction = model.getUniqueModelObject<openstudio::model::Construction>();
@@ -70,16 +70,15 @@ namespace gbxml {
     std::string constructionName = element.child("Name").text().as_string();
     construction.setName(escapeName(constructionId, constructionName));
 
-    // auto layerIdList = element.children("LayerId");
-    // Construction::LayerId (layerIdList) -> Layer (layerElements), Layer::MaterialId -> Material
+    // Construction::LayerId -> Layer, Layer::MaterialId -> Material
     std::vector<openstudio::model::Material> materials;
     for (auto &layerIdEl : element.children("LayerId")) {
       std::string layerId = layerIdEl.attribute("layerIdRef").value();
 
       // find this layerId in all the layers
-      auto result = layerElements.find(layerId);
-      if (result != layerElements.end()) {
-        for (auto &materialIdElement : result->second.children("MaterialId")) {
+      pugi::xml_node layerElement = findElement(layerId, "Layer");
+      if (layerElement) {
+        for (auto &materialIdElement : layerElement.children("MaterialId")) {
           std::string materialId = materialIdElement.attribute("materialIdRef").value();
           auto materialIt = m_idToObjectMap.find(materialId);
           if (materialIt != m_idToObjectMap.end()) {
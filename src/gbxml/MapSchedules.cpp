@@ -109,7 +109,7 @@ namespace gbxml {
     return result;
   }
 
-  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateScheduleWeek(const pugi::xml_node& element, const pugi::xml_node& root, openstudio::model::Model& model)
+  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateScheduleWeek(const pugi::xml_node& element, openstudio::model::Model& model)
   {
     std::string id = element.attribute("id").value();
     std::string type = element.attribute("type").value();
@@ -128,52 +128,46 @@ namespace gbxml {
       std::string dayType = dayElement.attribute("dayType").value();
       std::string dayScheduleIdRef = dayElement.attribute("dayScheduleIdRef").value();
 
-      // this can be made more efficient using QXPath in QXmlPatterns later
-      for(auto &dayScheduleElement : root.children("DaySchedule")) {
-        std::string thisId = dayScheduleElement.attribute("id").value();
-        if (thisId == dayScheduleIdRef) {
-
-          boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleDay(dayScheduleElement, model);
-          if (modelObject) {
-
-            boost::optional<openstudio::model::ScheduleDay> scheduleDay = modelObject->cast<openstudio::model::ScheduleDay>();
-            if (scheduleDay) {
-
-              if (dayType == "Weekday") {
-                result.setWeekdaySchedule(*scheduleDay);
-              } else if (dayType == "Weekend") {
-                result.setWeekendSchedule(*scheduleDay);
-              } else if (dayType == "Holiday") {
-                result.setHolidaySchedule(*scheduleDay);
-              } else if (dayType == "WeekendOrHoliday") {
-                result.setWeekendSchedule(*scheduleDay);
-                result.setHolidaySchedule(*scheduleDay);
-              } else if (dayType == "HeatingDesignDay") {
-                result.setWinterDesignDaySchedule(*scheduleDay);
-              } else if (dayType == "CoolingDesignDay") {
-                result.setSummerDesignDaySchedule(*scheduleDay);
-              } else if (dayType == "Sun") {
-                result.setSundaySchedule(*scheduleDay);
-              } else if (dayType == "Mon") {
-                result.setMondaySchedule(*scheduleDay);
-              } else if (dayType == "Tue") {
-                result.setTuesdaySchedule(*scheduleDay);
-              } else if (dayType == "Wed") {
-                result.setWednesdaySchedule(*scheduleDay);
-              } else if (dayType == "Thu") {
-                result.setThursdaySchedule(*scheduleDay);
-              } else if (dayType == "Fri") {
-                result.setFridaySchedule(*scheduleDay);
-              } else if (dayType == "Sat") {
-                result.setSaturdaySchedule(*scheduleDay);
-              } else {
-                // dayType can be "All"
-                result.setAllSchedules(*scheduleDay);
-              }
+      pugi::xml_node dayScheduleElement = findElement(dayScheduleIdRef, "DaySchedule");
+      if (dayScheduleElement) {
+        boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleDay(dayScheduleElement, model);
+        if (modelObject) {
+
+          boost::optional<openstudio::model::ScheduleDay> scheduleDay = modelObject->cast<openstudio::model::ScheduleDay>();
+          if (scheduleDay) {
+
+            if (dayType == "Weekday") {
+              result.setWeekdaySchedule(*scheduleDay);
+            } else if (dayType == "Weekend") {
+              result.setWeekendSchedule(*scheduleDay);
+            } else if (dayType == "Holiday") {
+              result.setHolidaySchedule(*scheduleDay);
+            } else if (dayType == "WeekendOrHoliday") {
+              result.setWeekendSchedule(*scheduleDay);
+              result.setHolidaySchedule(*scheduleDay);
+            } else if (dayType == "HeatingDesignDay") {
+              result.setWinterDesignDaySchedule(*scheduleDay);
+            } else if (dayType == "CoolingDesignDay") {
+              result.setSummerDesignDaySchedule(*scheduleDay);
+            } else if (dayType == "Sun") {
+              result.setSundaySchedule(*scheduleDay);
+            } else if (dayType == "Mon") {
+              result.setMondaySchedule(*scheduleDay);
+            } else if (dayType == "Tue") {
+              result.setTuesdaySchedule(*scheduleDay);
+            } else if (dayType == "Wed") {
+              result.setWednesdaySchedule(*scheduleDay);
+            } else if (dayType == "Thu") {
+              result.setThursdaySchedule(*scheduleDay);
+            } else if (dayType == "Fri") {
+              result.setFridaySchedule(*scheduleDay);
+            } else if (dayType == "Sat") {
+              result.setSaturdaySchedule(*scheduleDay);
+            } else {
+              // dayType can be "All"
+              result.setAllSchedules(*scheduleDay);
             }
           }
-
-          break;
         }
       }
     }
@@ -181,7 +175,7 @@ namespace gbxml {
     return result;
   }
 
-  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateSchedule(const pugi::xml_node& element, const pugi::xml_node& root, openstudio::model::Model& model)
+  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateSchedule(const pugi::xml_node& element, openstudio::model::Model& model)
   {
     std::string id = element.attribute("id").value();
     std::string type = element.attribute("type").value();
@@ -221,21 +215,15 @@ namespace gbxml {
 
       std::string weekScheduleId = element.child("WeekScheduleId").attribute("weekScheduleIdRef").value();
 
-      // this can be made more efficient using QXPath in QXmlPatterns later
-      for (auto &scheduleWeekElement : root.children("WeekSchedule")) {
-        std::string thisId = scheduleWeekElement.attribute("id").value();
-        if (thisId == weekScheduleId) {
-
-          boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleWeek(scheduleWeekElement, root, model);
-          if (modelObject) {
+      pugi::xml_node scheduleWeekElement = findElement(weekScheduleId, "WeekSchedule");
+      if (scheduleWeekElement) {
+        boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleWeek(scheduleWeekElement, model);
+        if (modelObject) {
 
-            boost::optional<openstudio::model::ScheduleWeek> scheduleWeek = modelObject->cast<openstudio::model::ScheduleWeek>();
-            if (scheduleWeek) {
-              result.addScheduleWeek(endDate, *scheduleWeek);
-            }
+          boost::optional<openstudio::model::ScheduleWeek> scheduleWeek = modelObject->cast<openstudio::model::ScheduleWeek>();
+          if (scheduleWeek) {
+            result.addScheduleWeek(endDate, *scheduleWeek);
           }
-
-          break;
         }
       }
     }
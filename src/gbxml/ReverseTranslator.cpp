@@ -64,6 +64,8 @@
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
+#include "../utilities/core/ParallelFor.hpp"
+#include "../utilities/core/System.hpp"
 #include "../utilities/units/Quantity.hpp"
 #include "../utilities/units/UnitFactory.hpp"
 #include "../utilities/units/QuantityConverter.hpp"
@@ -109,6 +111,8 @@ namespace gbxml {
     m_logSink.resetStringStream();
 
     m_idToObjectMap.clear();
+    m_idToElementMap.clear();
+    m_elementVertices.clear();
 
     boost::optional<openstudio::model::Model> result;
 
@@ -123,6 +127,10 @@ namespace gbxml {
         }
         file.close();
 
+        // these refer to nodes in doc
+        m_idToElementMap.clear();
+        m_elementVertices.clear();
+
       }
       // JWD: Would be nice to add some error handling here
     }
@@ -173,6 +181,131 @@ namespace gbxml {
     return translateGBXML(root);
   }
 
+  void ReverseTranslator::indexElements(const pugi::xml_node& root)
+  {
+    m_idToElementMap.clear();
+
+    // depth first in document order so the first element found for an id matches a child() scan
+    std::vector<pugi::xml_node> stack;
+    stack.push_back(root);
+    while (!stack.empty()) {
+      pugi::xml_node element = stack.back();
+      stack.pop_back();
+
+      pugi::xml_attribute idAttribute = element.attribute("id");
+      if (idAttribute) {
+        m_idToElementMap[idAttribute.value()].push_back(element);
+      }
+
+      for (pugi::xml_node child = element.last_child(); child; child = child.previous_sibling()) {
+        if (child.type() == pugi::node_element) {
+          stack.push_back(child);
+        }
+      }
+    }
+  }
+
+  pugi::xml_node ReverseTranslator::findElement(const std::string& id, const std::string& elementName) const
+  {
+    auto it = m_idToElementMap.find(id);
+    if (it != m_idToElementMap.end()) {
+      for (const auto& element : it->second) {
+        if (elementName == element.name()) {
+          return element;
+        }
+      }
+    }
+    return pugi::xml_node();
+  }
+
+  std::vector<openstudio::Point3d> ReverseTranslator::readVertices(const pugi::xml_node& element, std::vector<std::string>& errors) const
+  {
+    std::vector<openstudio::Point3d> vertices;
+
+    auto planarGeometryElement = element.child("PlanarGeometry");
+    auto polyLoopElement = planarGeometryElement.child("PolyLoop");
+    auto cartesianPointElements = polyLoopElement.children("CartesianPoint");
+
+    for (auto &cart_el : cartesianPointElements) {
+      auto coordinateElements = cart_el.children("Coordinate");
+      auto numCoordinates = std::distance(coordinateElements.begin(), coordinateElements.end());
+      if (numCoordinates != 3) {
+        // may be called from a worker thread, the caller logs the errors
+        std::stringstream ss;
+        ss << "CartesianPoint of " << element.name() << " '" << element.attribute("id").value() << "' has "
+           << numCoordinates << " Coordinate elements, expected 3";
+        errors.push_back(ss.str());
+      }
+
+      /* Calling these conversions every time is unnecessarily slow
+
+      Unit targetUnit = UnitFactory::instance().createUnit("m").get();
+      Quantity xQuantity(coordinateElements.at(0).toElement().text().toDouble(), m_lengthUnit);
+      Quantity yQuantity(coordinateElements.at(1).toElement().text().toDouble(), m_lengthUnit);
+      Quantity zQuantity(coordinateElements.at(2).toElement().text().toDouble(), m_lengthUnit);
+
+      double x = QuantityConverter::instance().convert(xQuantity, targetUnit)->value();
+      double y = QuantityConverter::instance().convert(yQuantity, targetUnit)->value();
+      double z = QuantityConverter::instance().convert(zQuantity, targetUnit)->value();
+      */
+
+      std::array<double, 3> coords{ {0.0, 0.0, 0.0} };
+      size_t i{ 0 };
+      for (auto &el : coordinateElements) {
+        coords[i] = m_lengthMultiplier * el.text().as_double();
+        ++i;
+        if (i == 3) {
+          break;
+        }
+      }
+
+      vertices.push_back(openstudio::Point3d(coords[0], coords[1], coords[2]));
+    }
+
+    return vertices;
+  }
+
+  std::vector<openstudio::Point3d> ReverseTranslator::readVertices(const pugi::xml_node& element) const
+  {
+    std::vector<std::string> errors;
+    std::vector<openstudio::Point3d> result = readVertices(element, errors);
+    for (const auto& error : errors) {
+      LOG(Error, error);
+    }
+    return result;
+  }
+
+  void ReverseTranslator::readAllVertices(const std::vector<pugi::xml_node>& elements)
+  {
+    // reading the document is thread safe, the model is only modified on this thread
+    // log messages from worker threads would be dropped by the thread filtered log sink, so errors are
+    // collected per element and logged on this thread after the join
+    std::vector<std::vector<openstudio::Point3d> > vertices(elements.size());
+    std::vector<std::vector<std::string> > errors(elements.size());
+
+    // small documents are not worth starting threads for
+    unsigned numThreads = static_cast<unsigned>(std::min<size_t>(System::numberOfProcessors(), elements.size() / 64 + 1));
+    parallelFor(elements.size(), [this, &elements, &vertices, &errors](size_t i) {
+      vertices[i] = readVertices(elements[i], errors[i]);
+    }, numThreads);
+
+    for (size_t i = 0; i < elements.size(); ++i) {
+      for (const auto& error : errors[i]) {
+        LOG(Error, error);
+      }
+      m_elementVertices[elements[i].internal_object()] = std::move(vertices[i]);
+    }
+  }
+
+  std::vector<openstudio::Point3d> ReverseTranslator::vertices(const pugi::xml_node& element) const
+  {
+    auto it = m_elementVertices.find(element.internal_object());
+    if (it != m_elementVertices.end()) {
+      return it->second;
+    }
+    return readVertices(element);
+  }
+
   boost::optional<model::Model> ReverseTranslator::translateGBXML(const pugi::xml_node& root)
   {
     openstudio::model::Model model;
@@ -243,6 +376,8 @@ namespace gbxml {
       m_useSIUnitsForResults = false;
     }
 
+    indexElements(root);
+
     // do materials before constructions
     auto materialElements = root.children("Material");
     if (m_progressBar) {
@@ -262,13 +397,6 @@ namespace gbxml {
     }
 
     // do constructions before surfaces
-    std::unordered_map<std::string, pugi::xml_node> layerElements;
-    for (auto &layerEl : root.children("Layer")) {
-      std::string layerId = layerEl.attribute("id").value();
-      // Could maybe use some error checking here for empty IDs
-      layerElements[layerId] = layerEl;
-    }
-
     auto constructionElements = root.children("Construction");
     if (m_progressBar) {
       m_progressBar->setWindowTitle(toString("Translating Constructions"));
@@ -278,7 +406,7 @@ namespace gbxml {
     }
 
     for (auto &constructionElement : constructionElements) {
-      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, layerElements, model);
+      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, model);
       OS_ASSERT(construction); // Krishnan, what type of error handling do you want?
 
       if (m_progressBar) {
@@ -314,7 +442,7 @@ namespace gbxml {
     }
 
     for (auto &scheduleElement : scheduleElements) {
-      boost::optional<model::ModelObject> schedule = translateSchedule(scheduleElement, root, model);
+      boost::optional<model::ModelObject> schedule = translateSchedule(scheduleElement, model);
       OS_ASSERT(schedule); // Krishnan, what type of error handling do you want?
 
       if (m_progressBar) {
@@ -361,6 +489,17 @@ namespace gbxml {
     OS_ASSERT(building);
 
     auto surfaceElements = element.children("Surface");
+
+    // read geometry for all surfaces and openings up front, in parallel
+    std::vector<pugi::xml_node> geometryElements;
+    for (auto &surfEl : surfaceElements) {
+      geometryElements.push_back(surfEl);
+      for (auto &subsurf : surfEl.children("Opening")) {
+        geometryElements.push_back(subsurf);
+      }
+    }
+    readAllVertices(geometryElements);
+
     if (m_progressBar) {
       m_progressBar->setWindowTitle(toString("Translating Surfaces"));
       m_progressBar->setMinimum(0);
@@ -548,40 +687,7 @@ namespace gbxml {
   boost::optional<model::ModelObject> ReverseTranslator::translateSurface(const pugi::xml_node& element, openstudio::model::Model& model)
   {
     boost::optional<model::ModelObject> result;
-    std::vector<openstudio::Point3d> vertices;
-
-    auto planarGeometryElement = element.child("PlanarGeometry");
-    auto polyLoopElement = planarGeometryElement.child("PolyLoop");
-    auto cartesianPointElements = polyLoopElement.children("CartesianPoint");
-
-    for (auto &cart_el : cartesianPointElements) {
-      auto coordinateElements = cart_el.children("Coordinate");
-      OS_ASSERT(std::distance(coordinateElements.begin(), coordinateElements.end()) == 3);
-
-      /* Calling these conversions every time is unnecessarily slow
-
-      Unit targetUnit = UnitFactory::instance().createUnit("m").get();
-      Quantity xQuantity(coordinateElements.at(0).toElement().text().toDouble(), m_lengthUnit);
-      Quantity yQuantity(coordinateElements.at(1).toElement().text().toDouble(), m_lengthUnit);
-      Quantity zQuantity(coordinateElements.at(2).toElement().text().toDouble(), m_lengthUnit);
-
-      double x = QuantityConverter::instance().convert(xQuantity, targetUnit)->value();
-      double y = QuantityConverter::instance().convert(yQuantity, targetUnit)->value();
-      double z = QuantityConverter::instance().convert(zQuantity, targetUnit)->value();
-      */
-
-      std::array<double, 3> coords{ {0.0, 0.0, 0.0} };
-      size_t i{ 0 };
-      for (auto &el : coordinateElements) {
-        coords[i] = m_lengthMultiplier * el.text().as_double();
-        ++i;
-        if (i == 3) {
-          break;
-        }
-      }
-
-      vertices.push_back(openstudio::Point3d(coords[0], coords[1], coords[2]));
-    }
+    std::vector<openstudio::Point3d> vertices = this->vertices(element);
 
     std::string surfaceType = element.attribute("surfaceType").value();
     if (surfaceType.find("Shade") != std::string::npos) {
@@ -963,39 +1069,7 @@ namespace gbxml {
 
     boost::optional<model::ModelObject> result;
 
-    std::vector<openstudio::Point3d> vertices;
-
-    auto planarGeometryElement = element.child("PlanarGeometry");
-    auto polyLoopElement = planarGeometryElement.child("PolyLoop");
-    auto cartesianPointElements = polyLoopElement.children("CartesianPoint");
-
-    for (auto &cart_el : cartesianPointElements) {
-      auto coordinateElements = cart_el.children("Coordinate");
-      OS_ASSERT(std::distance(coordinateElements.begin(), coordinateElements.end()) == 3);
-
-      /* Calling these conversions every time is unnecessarily slow
-
-      Unit targetUnit = UnitFactory::instance().createUnit("m").get();
-      Quantity xQuantity(coordinateElements.at(0).toElement().text().toDouble(), m_lengthUnit);
-      Quantity yQuantity(coordinateElements.at(1).toElement().text().toDouble(), m_lengthUnit);
-      Quantity zQuantity(coordinateElements.at(2).toElement().text().toDouble(), m_lengthUnit);
-
-      double x = QuantityConverter::instance().convert(xQuantity, targetUnit)->value();
-      double y = QuantityConverter::instance().convert(yQuantity, targetUnit)->value();
-      double z = QuantityConverter::instance().convert(zQuantity, targetUnit)->value();
-      */
-      std::array<double, 3> coords{ {0.0, 0.0, 0.0} };
-      size_t i{ 0 };
-      for (auto &el : coordinateElements) {
-        coords[i] = m_lengthMultiplier * el.text().as_double();
-        ++i;
-        if (i == 3) {
-          break;
-        }
-      }
-
-      vertices.push_back(openstudio::Point3d(coords[0], coords[1], coords[2]));
-    }
+    std::vector<openstudio::Point3d> vertices = this->vertices(element);
 
     openstudio::model::SubSurface subSurface(vertices, model);
     subSurface.setSurface(surface);
@@ -40,10 +40,12 @@
 #include "../utilities/core/StringStreamLogSink.hpp"
 
 #include "../utilities/units/Unit.hpp"
+#include "../utilities/geometry/Point3d.hpp"
 #include <unordered_map>
 
 namespace pugi {
   class xml_node;
+  struct xml_node_struct;
 }
 
 namespace openstudio {
@@ -87,7 +89,21 @@ namespace gbxml {
     // given id and name from XML (name may be empty) return an OS name
     std::string escapeName(const std::string& id, const std::string& name);
 
-    std::map<std::string, openstudio::model::ModelObject> m_idToObjectMap;
+    std::unordered_map<std::string, openstudio::model::ModelObject> m_idToObjectMap;
+
+    // all elements in the document with an id attribute, built once per translation
+    std::unordered_map<std::string, std::vector<pugi::xml_node> > m_idToElementMap;
+    void indexElements(const pugi::xml_node& root);
+    // first element named elementName with id, empty node if not found
+    pugi::xml_node findElement(const std::string& id, const std::string& elementName) const;
+
+    // vertices of Surface and Opening elements, read in parallel before surfaces are translated
+    std::unordered_map<const pugi::xml_node_struct*, std::vector<openstudio::Point3d> > m_elementVertices;
+    void readAllVertices(const std::vector<pugi::xml_node>& elements);
+    // appends geometry errors to errors instead of logging them, safe to call from worker threads
+    std::vector<openstudio::Point3d> readVertices(const pugi::xml_node& element, std::vector<std::string>& errors) const;
+    std::vector<openstudio::Point3d> readVertices(const pugi::xml_node& element) const;
+    std::vector<openstudio::Point3d> vertices(const pugi::xml_node& element) const;
 
     // In ReverseTranslator.cpp
     boost::optional<openstudio::model::Model> convert(const pugi::xml_node& root);
@@ -103,11 +119,11 @@ namespace gbxml {
 
     // In MapSchedules.cpp
     boost::optional<openstudio::model::ModelObject> translateScheduleDay(const pugi::xml_node& element, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateScheduleWeek(const pugi::xml_node& element, const pugi::xml_node& root, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateSchedule(const pugi::xml_node& element, const pugi::xml_node& root, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateScheduleWeek(const pugi::xml_node& element, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateSchedule(const pugi::xml_node& element, openstudio::model::Model& model);
 
     // In MapEnvelope.cpp
-    boost::optional<openstudio::model::ModelObject> translateConstruction(const pugi::xml_node& element, const std::unordered_map<std::string, pugi::xml_node> &layerElements, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateConstruction(const pugi::xml_node& element, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateWindowType(const pugi::xml_node& element, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateMaterial(const pugi::xml_node& element, openstudio::model::Model& model);
 
@@ -56,6 +56,12 @@
 #include "../../model/SubSurface_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
 #include "../../model/StandardOpaqueMaterial_Impl.hpp"
+#include "../../model/ScheduleYear.hpp"
+#include "../../model/ScheduleYear_Impl.hpp"
+#include "../../model/ScheduleDay.hpp"
+#include "../../model/ScheduleDay_Impl.hpp"
+#include "../../model/ScheduleWeek.hpp"
+#include "../../model/ScheduleWeek_Impl.hpp"
 
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/core/Optional.hpp"
@@ -66,6 +72,8 @@
 
 #include <resources.hxx>
 
+#include <pugixml.hpp>
+
 #include <sstream>
 
 using namespace openstudio::energyplus;
@@ -173,6 +181,67 @@ TEST_F(gbXMLFixture, ReverseTranslator_Constructions)
 
 }
 
+TEST_F(gbXMLFixture, ReverseTranslator_IndexedElements)
+{
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/TestCube.xml");
+
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(inputPath);
+  ASSERT_TRUE(model);
+
+  // week and day schedules are found by id
+  std::vector<ScheduleYear> scheduleYears = model->getConcreteModelObjects<ScheduleYear>();
+  EXPECT_EQ(2u, scheduleYears.size());
+  for (const auto& scheduleYear : scheduleYears) {
+    EXPECT_EQ(1u, scheduleYear.scheduleWeeks().size());
+  }
+  for (const auto& scheduleWeek : model->getConcreteModelObjects<ScheduleWeek>()) {
+    EXPECT_TRUE(scheduleWeek.sundaySchedule());
+  }
+
+  // geometry read in parallel is committed in document order, translating again gives the same model
+  boost::optional<openstudio::model::Model> model2 = reverseTranslator.loadModel(inputPath);
+  ASSERT_TRUE(model2);
+  std::vector<Surface> surfaces = model->getConcreteModelObjects<Surface>();
+  ASSERT_EQ(surfaces.size(), model2->getConcreteModelObjects<Surface>().size());
+  for (const auto& surface : surfaces) {
+    boost::optional<Surface> surface2 = model2->getModelObjectByName<Surface>(surface.nameString());
+    ASSERT_TRUE(surface2);
+    EXPECT_EQ(surface.vertices(), surface2->vertices());
+    EXPECT_EQ(surface.subSurfaces().size(), surface2->subSurfaces().size());
+  }
+}
+
+TEST_F(gbXMLFixture, ReverseTranslator_GeometryErrorsLogged)
+{
+  // drop a coordinate from the first point of the first surface
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/TestCube.xml");
+  pugi::xml_document doc;
+  ASSERT_TRUE(doc.load_file(inputPath.string().c_str()));
+  pugi::xml_node surface = doc.child("gbXML").child("Campus").child("Surface");
+  ASSERT_TRUE(surface);
+  pugi::xml_node point = surface.child("PlanarGeometry").child("PolyLoop").child("CartesianPoint");
+  ASSERT_TRUE(point);
+  ASSERT_TRUE(point.remove_child(point.child("Coordinate")));
+
+  openstudio::path outputPath = resourcesPath() / openstudio::toPath("gbxml/TestCube_BadCoordinate.xml");
+  ASSERT_TRUE(doc.save_file(outputPath.string().c_str()));
+
+  // the geometry is read on worker threads, the error must still reach the translator's log
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(outputPath);
+  ASSERT_TRUE(model);
+
+  std::string surfaceId = surface.attribute("id").value();
+  bool found = false;
+  for (const auto& error : reverseTranslator.errors()) {
+    if (error.logMessage().find("'" + surfaceId + "' has 2 Coordinate elements") != std::string::npos) {
+      found = true;
+    }
+  }
+  EXPECT_TRUE(found);
+}
+
 TEST_F(gbXMLFixture, ReverseTranslator_SubSurfaceConstructions)
 {
 
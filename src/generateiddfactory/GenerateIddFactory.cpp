@@ -102,6 +102,7 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
     << "#include <utilities/core/Logger.hpp>" << std::endl
     << std::endl
     << "#include <map>" << std::endl
+    << "#include <mutex>" << std::endl
     << std::endl
     << "namespace openstudio{" << std::endl
     << std::endl
@@ -220,7 +221,9 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
     << "  typedef std::multimap<IddObjectType,IddFileType> IddObjectSourceFileMap;" << std::endl
     << "  IddObjectSourceFileMap m_sourceFileMap;" << std::endl
     << std::endl
+    << "  // previous version IddFiles are loaded on first request, possibly from several threads" << std::endl
     << "  mutable std::map<VersionString,IddFile> m_osIddFiles;" << std::endl
+    << "  mutable std::mutex m_osIddFilesMutex;" << std::endl
     << "};" << std::endl
     << std::endl
     << "#if _WIN32 || _MSC_VER" << std::endl
@@ -773,6 +776,7 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
     << "    return getIddFile(fileType);" << std::endl
     << "  }" << std::endl
     << "  else {" << std::endl
+    << "    std::lock_guard<std::mutex> lock(m_osIddFilesMutex);" << std::endl
     << "    std::map<VersionString, IddFile>::const_iterator it = m_osIddFiles.find(version);" << std::endl
     << "    if (it != m_osIddFiles.end()) {" << std::endl
     << "      return it->second;" << std::endl
@@ -17,6 +17,8 @@
   #include <isomodel/ForwardTranslator.hpp>
   #include <isomodel/UserModel.hpp>
   #include <isomodel/SimModel.hpp>
+  #include <isomodel/SimModelBatch.hpp>
+  #include <isomodel/WeatherCache.hpp>
 
   using namespace openstudio::isomodel;
   using namespace openstudio;
@@ -31,6 +33,7 @@
 // #endif
 
 %ignore openstudio::isomodel::mult;
+%ignore openstudio::isomodel::ISOBatchResults::values;
 
 %rename("terrainClass=") openstudio::isomodel::UserModel::setTerrainClass(double value);
 %rename("floorArea=") openstudio::isomodel::UserModel::setFloorArea(double value);
@@ -166,6 +169,8 @@
 %rename("weatherFilePath=") openstudio::isomodel::UserModel::setWeatherFilePath(std::string value);
 
 %include <isomodel/SimModel.hpp>
+%include <isomodel/SimModelBatch.hpp>
 %include <isomodel/UserModel.hpp>
+%include <isomodel/WeatherCache.hpp>
 %include <isomodel/ForwardTranslator.hpp>
 #endif //ISOMODEL_I
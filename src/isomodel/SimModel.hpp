@@ -80,6 +80,8 @@ namespace isomodel {
     double totalEnergyUse() const;
   };
 
+  class SimModelBatch;
+
   class ISOMODEL_API SimModel {
   public:
     void setPop(std::shared_ptr<Population> value){pop=value;}
@@ -99,6 +101,8 @@ namespace isomodel {
     REGISTER_LOGGER("openstudio.isomodel.SimModel");
 
   private:
+    friend class SimModelBatch;
+
     std::shared_ptr<Population> pop;
     std::shared_ptr<Location> location;
     std::shared_ptr<Lighting> lights;
@@ -0,0 +1,726 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "SimModelBatch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace openstudio {
+namespace isomodel {
+
+  namespace {
+
+    // must match the constants used by SimModel::simulate
+    constexpr double hoursInMonth[] = {744, 672, 744, 720, 744, 720, 744, 744, 720, 744, 720, 744};
+    constexpr double megasecondsInMonth[] = {2.6784, 2.4192, 2.6784, 2.592, 2.6784, 2.592, 2.6784, 2.6784, 2.592, 2.6784, 2.592, 2.6784};
+    constexpr double daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    constexpr double monthFractionOfYear[] = {0.0849315068493151, 0.0767123287671233, 0.0849315068493151, 0.0821917808219178, 0.0849315068493151, 0.0821917808219178, 0.0849315068493151, 0.0849315068493151, 0.0821917808219178, 0.0849315068493151, 0.0821917808219178, 0.0849315068493151};
+    constexpr double hoursInWeek = 168;
+    constexpr double hoursInYear = 8760;
+    constexpr double daysInYear = 365;
+    constexpr double kWh2MJ = 3.6f;
+    constexpr double minDouble = std::numeric_limits<double>::min();
+
+    constexpr size_t blockSize = 256;
+
+    // number of per parameter set scratch values, see simulateBlock
+    constexpr size_t numScratchScalars = 11;
+    constexpr size_t numScratchMonthly = 5;
+
+    // same semantics as the Vector div helpers in SimModel.cpp
+    inline double safeDiv(double numerator, double denominator)
+    {
+      return denominator == 0 ? std::numeric_limits<double>::max() : numerator / denominator;
+    }
+
+  }
+
+  ISOBatchResults::ISOBatchResults()
+    : m_size(0)
+  {}
+
+  ISOBatchResults::ISOBatchResults(size_t size)
+    : m_size(size), m_values(size * 12 * NumEndUses, 0.0)
+  {}
+
+  size_t ISOBatchResults::size() const
+  {
+    return m_size;
+  }
+
+  double ISOBatchResults::value(size_t index, unsigned month, EndUse endUse) const
+  {
+    return values(endUse, month)[index];
+  }
+
+  const double* ISOBatchResults::values(EndUse endUse, unsigned month) const
+  {
+    return m_values.data() + (static_cast<size_t>(endUse) * 12 + month) * m_size;
+  }
+
+  double* ISOBatchResults::values(EndUse endUse, unsigned month)
+  {
+    return m_values.data() + (static_cast<size_t>(endUse) * 12 + month) * m_size;
+  }
+
+  double ISOBatchResults::totalEnergyUse(size_t index) const
+  {
+    double result = 0;
+    for (int endUse = 0; endUse < NumEndUses; ++endUse) {
+      for (unsigned month = 0; month < 12; ++month) {
+        result += value(index, month, static_cast<EndUse>(endUse));
+      }
+    }
+    return result;
+  }
+
+  ISOResults ISOBatchResults::toISOResults(size_t index) const
+  {
+    ISOResults allResults;
+    allResults.monthlyResults.reserve(12);
+    for (unsigned i = 0; i < 12; ++i) {
+      EndUses results;
+      results.addEndUse(value(index, i, ElectricHeating), EndUseFuelType::Electricity, EndUseCategoryType::Heating);
+      results.addEndUse(value(index, i, ElectricCooling), EndUseFuelType::Electricity, EndUseCategoryType::Cooling);
+      results.addEndUse(value(index, i, ElectricInteriorLights), EndUseFuelType::Electricity, EndUseCategoryType::InteriorLights);
+      results.addEndUse(value(index, i, ElectricExteriorLights), EndUseFuelType::Electricity, EndUseCategoryType::ExteriorLights);
+      results.addEndUse(value(index, i, ElectricFans), EndUseFuelType::Electricity, EndUseCategoryType::Fans);
+      results.addEndUse(value(index, i, ElectricPumps), EndUseFuelType::Electricity, EndUseCategoryType::Pumps);
+      results.addEndUse(value(index, i, ElectricInteriorEquipment), EndUseFuelType::Electricity, EndUseCategoryType::InteriorEquipment);
+      results.addEndUse(value(index, i, ElectricWaterSystems), EndUseFuelType::Electricity, EndUseCategoryType::WaterSystems);
+      results.addEndUse(value(index, i, GasHeating), EndUseFuelType::Gas, EndUseCategoryType::Heating);
+      results.addEndUse(value(index, i, GasCooling), EndUseFuelType::Gas, EndUseCategoryType::Cooling);
+      results.addEndUse(value(index, i, GasInteriorEquipment), EndUseFuelType::Gas, EndUseCategoryType::InteriorEquipment);
+      results.addEndUse(value(index, i, GasWaterSystems), EndUseFuelType::Gas, EndUseCategoryType::WaterSystems);
+      allResults.monthlyResults.push_back(results);
+    }
+    return allResults;
+  }
+
+  SimModelBatch::SimModelBatch(std::shared_ptr<Location> location)
+    : m_location(location)
+  {
+    precomputeWeather();
+  }
+
+  SimModelBatch::SimModelBatch(const SimModel& model)
+    : m_location(model.location)
+  {
+    precomputeWeather();
+  }
+
+  void SimModelBatch::precomputeWeather()
+  {
+    if (!m_location || !m_location->weather()) {
+      throw std::runtime_error("SimModelBatch requires a location with weather data");
+    }
+
+    const WeatherData& weather = *m_location->weather();
+    const Matrix& mhEgh = weather.mhEgh();
+
+    // see SimModel::solarRadiationBreakdown, SimModel::solarHeatGain and SimModel::ventilationCalc
+    double n_dCp = 0.75;
+    double n_wind_exp = 0.667;
+    for (unsigned i = 0; i < 12; ++i) {
+      m_dbt[i] = weather.mdbt()[i];
+      m_windPowered[i] = std::pow(weather.mwind()[i] * weather.mwind()[i] * (n_dCp * m_location->terrain()), n_wind_exp);
+
+      double sunUp = 0;
+      double sunDown = 0;
+      for (int j = 0; j < 24; ++j) {
+        if (mhEgh(i, j) != 0) {
+          sunUp = j;
+          break;
+        }
+      }
+      for (int j = 23; j >= 0; --j) {
+        if (mhEgh(i, j) != 0) {
+          sunDown = j;
+          break;
+        }
+      }
+      double fracSunUp = (sunDown - sunUp + 1) / 24.0;
+      m_hoursSunDown[i] = (1.0 - fracSunUp) * hoursInMonth[i];
+
+      for (unsigned j = 0; j < 8; ++j) {
+        m_solar[i][j] = weather.msolar()(i, j);
+      }
+      m_solar[i][8] = weather.mEgh()[i];
+    }
+  }
+
+  std::shared_ptr<Location> SimModelBatch::location() const
+  {
+    return m_location;
+  }
+
+  size_t SimModelBatch::add(const SimModel& model)
+  {
+    if (!model.pop || !model.lights || !model.building || !model.structure || !model.heating || !model.cooling || !model.ventilation) {
+      throw std::runtime_error("SimModel is missing components, cannot add it to SimModelBatch");
+    }
+
+    const Structure& structure = *model.structure;
+    const Vector* directional[] = {&structure.wallArea(), &structure.windowArea(), &structure.wallUniform(), &structure.windowUniform(),
+                                   &structure.wallThermalEmissivity(), &structure.wallSolarAbsorbtion(),
+                                   &structure.windowNormalIncidenceSolarEnergyTransmittance(), &structure.windowShadingCorrectionFactor()};
+    for (const Vector* values : directional) {
+      if (values->size() != 9) {
+        throw std::runtime_error("SimModel structure must have 9 directional values, cannot add it to SimModelBatch");
+      }
+    }
+
+    if (model.location && (model.location->weather() != m_location->weather() || model.location->terrain() != m_location->terrain())) {
+      LOG(Warn, "SimModel location differs from the SimModelBatch location, the batch location will be used");
+    }
+
+    const Population& pop = *model.pop;
+    const Building& building = *model.building;
+    const Lighting& lights = *model.lights;
+    const Heating& heating = *model.heating;
+    const Cooling& cooling = *model.cooling;
+    const Ventilation& ventilation = *model.ventilation;
+
+    double scalars[] = {
+      pop.hoursStart(), pop.hoursEnd(), pop.daysStart(), pop.daysEnd(),
+      pop.densityOccupied(), pop.densityUnoccupied(), pop.heatGainPerPerson(),
+      building.lightingOccupancySensor(), building.constantIllumination(),
+      building.electricApplianceHeatGainOccupied(), building.electricApplianceHeatGainUnoccupied(),
+      building.gasApplianceHeatGainOccupied(), building.gasApplianceHeatGainUnoccupied(), building.buildingEnergyManagement(),
+      lights.powerDensityOccupied(), lights.powerDensityUnoccupied(), lights.dimmingFraction(), lights.exteriorEnergy(),
+      heating.temperatureSetPointOccupied(), heating.temperatureSetPointUnoccupied(), heating.hvacLossFactor(), heating.hotcoldWasteFactor(),
+      heating.efficiency(), heating.energyType(), heating.pumpControlReduction(),
+      heating.hotWaterDemand(), heating.hotWaterDistributionEfficiency(), heating.hotWaterSystemEfficiency(), heating.hotWaterEnergyType(),
+      cooling.temperatureSetPointOccupied(), cooling.temperatureSetPointUnoccupied(), cooling.cop(), cooling.partialLoadValue(),
+      cooling.hvacLossFactor(), cooling.pumpControlReduction(),
+      ventilation.supplyRate(), ventilation.supplyDifference(), ventilation.heatRecoveryEfficiency(), ventilation.exhaustAirRecirculated(),
+      ventilation.type(), ventilation.fanPower(), ventilation.fanControlFactor(),
+      structure.floorArea(), structure.buildingHeight(), structure.infiltrationRate(), structure.interiorHeatCapacity(), structure.wallHeatCapacity(),
+      structure.windowShadingDevice()
+    };
+    static_assert(sizeof(scalars) / sizeof(double) == WallArea, "SimModelBatch scalar inputs out of sync");
+
+    for (int i = 0; i < WallArea; ++i) {
+      m_inputs[i].push_back(scalars[i]);
+    }
+    for (unsigned d = 0; d < 8; ++d) {
+      for (unsigned j = 0; j < 9; ++j) {
+        m_inputs[WallArea + d * 9 + j].push_back((*directional[d])[j]);
+      }
+    }
+
+    return size() - 1;
+  }
+
+  void SimModelBatch::reserve(size_t size)
+  {
+    for (auto& input : m_inputs) {
+      input.reserve(size);
+    }
+  }
+
+  size_t SimModelBatch::size() const
+  {
+    return m_inputs[0].size();
+  }
+
+  void SimModelBatch::clear()
+  {
+    for (auto& input : m_inputs) {
+      input.clear();
+    }
+  }
+
+  ISOBatchResults SimModelBatch::simulate() const
+  {
+    ISOBatchResults results(size());
+    std::vector<double> scratch((numScratchScalars + 12 * numScratchMonthly) * blockSize);
+    for (size_t begin = 0; begin < size(); begin += blockSize) {
+      simulateBlock(begin, std::min(size(), begin + blockSize), scratch, results);
+    }
+    return results;
+  }
+
+  void SimModelBatch::simulateBlock(size_t begin, size_t end, std::vector<double>& scratch, ISOBatchResults& results) const
+  {
+    // Each stage below mirrors the SimModel member function of the same name, evaluated for
+    // parameter sets [begin, end) with the parameter set as the innermost loop. The order of
+    // floating point operations follows SimModel so results agree with SimModel::simulate.
+    const size_t n = end - begin;
+    auto in = [&](int input) { return m_inputs[input].data() + begin; };
+    auto scalarScratch = [&](size_t i) { return scratch.data() + i * blockSize; };
+    auto monthlyScratch = [&](size_t i, unsigned month) { return scratch.data() + (numScratchScalars + i * 12 + month) * blockSize; };
+    auto out = [&](ISOBatchResults::EndUse endUse, unsigned month) { return results.values(endUse, month) + begin; };
+
+    double* frac_hrs_wk_day = scalarScratch(0);
+    double* frac_hrs_wk_nt = scalarScratch(1);
+    double* frac_hrs_wke_tot = scalarScratch(2);
+    double* hoursOccupiedPerDay = scalarScratch(3);
+    double* hoursUnoccupiedPerDay = scalarScratch(4);
+    double* Q_illum_tot_yr = scalarScratch(5);
+    double* H_tr = scalarScratch(6);
+    double* phi_I_tot = scalarScratch(7);
+    double* tau = scalarScratch(8);
+    double* Th_avg = scalarScratch(9);
+    double* Tc_avg = scalarScratch(10);
+
+    const double* floorArea = in(FloorArea);
+
+    // scheduleAndOccupancy
+    {
+      const double* hoursStart = in(HoursStart);
+      const double* hoursEnd = in(HoursEnd);
+      const double* daysStart = in(DaysStart);
+      const double* daysEnd = in(DaysEnd);
+      for (size_t i = 0; i < n; ++i) {
+        double hoursOccupied = hoursEnd[i] - hoursStart[i];
+        hoursOccupied = hoursOccupied < 0 ? hoursOccupied + 24 : hoursOccupied;
+        double daysOccupiedPerWeek = daysEnd[i] - daysStart[i] + 1;
+        daysOccupiedPerWeek = daysOccupiedPerWeek < 0 ? daysOccupiedPerWeek + 7 : daysOccupiedPerWeek;
+        double hoursOccupiedDuringWeek = hoursOccupied * daysOccupiedPerWeek;
+        double hoursUnoccupied = 24 - hoursOccupied;
+        double hoursUnoccupiedDuringWeek = (daysOccupiedPerWeek - 1) * hoursUnoccupied;
+        double totalWeekendHours = hoursInWeek - hoursOccupiedDuringWeek - hoursUnoccupiedDuringWeek;
+        hoursOccupiedPerDay[i] = hoursOccupied;
+        hoursUnoccupiedPerDay[i] = hoursUnoccupied;
+        frac_hrs_wk_day[i] = hoursOccupiedDuringWeek / hoursInWeek;
+        frac_hrs_wk_nt[i] = hoursUnoccupiedDuringWeek / hoursInWeek;
+        frac_hrs_wke_tot[i] = totalWeekendHours / hoursInWeek;
+      }
+    }
+
+    // lightingEnergyUse
+    {
+      const double* hoursStart = in(HoursStart);
+      const double* hoursEnd = in(HoursEnd);
+      const double* daysStart = in(DaysStart);
+      const double* daysEnd = in(DaysEnd);
+      const double* lpd_occ = in(PowerDensityOccupied);
+      const double* lpd_unocc = in(PowerDensityUnoccupied);
+      const double* F_D = in(DimmingFraction);
+      const double* F_O = in(LightingOccupancySensor);
+      const double* F_C = in(ConstantIllumination);
+      double n_day_start = 7;
+      double n_day_end = 19;
+      double n_weeks = 50;
+      for (size_t i = 0; i < n; ++i) {
+        double t_lt_D = (std::min(n_day_end, hoursEnd[i]) - std::max(hoursStart[i], n_day_start)) *
+                        (daysEnd[i] + 1 - daysStart[i] + 1) * n_weeks;
+        double t_lt_N = (std::max(n_day_start - hoursStart[i], 0.0) + std::max(hoursEnd[i] - n_day_end, 0.0)) *
+                        (daysEnd[i] + 1 - daysStart[i] + 1) * n_weeks;
+        double Q_illum_occ = floorArea[i] * lpd_occ[i] * F_C[i] * F_O[i] * (t_lt_D * F_D[i] + t_lt_N) / 1000.0;
+        double t_unocc = hoursInYear - t_lt_D - t_lt_N;
+        double Q_illum_unocc = floorArea[i] * lpd_unocc[i] * t_unocc / 1000.0;
+        Q_illum_tot_yr[i] = Q_illum_occ + Q_illum_unocc;
+      }
+      const double* exteriorEnergy = in(ExteriorEnergy);
+      for (unsigned m = 0; m < 12; ++m) {
+        double* interior = out(ISOBatchResults::ElectricInteriorLights, m);
+        double* exterior = out(ISOBatchResults::ElectricExteriorLights, m);
+        for (size_t i = 0; i < n; ++i) {
+          interior[i] = safeDiv(monthFractionOfYear[m] * Q_illum_tot_yr[i], floorArea[i]);
+          exterior[i] = safeDiv(m_hoursSunDown[m] * (exteriorEnergy[i] / 1000.0), floorArea[i]);
+        }
+      }
+    }
+
+    // envelopCalculations, windowSolarGain and solarHeatGain
+    {
+      const double* shadingDevice = in(WindowShadingDevice);
+      double n_win_ff = 0.25;
+      double n_win_SDF_table[] = {0.5, 0.35, 1.0};
+      double n_win_F_W = 0.9;
+      double n_R_sc_ext = 0.04;
+      double theta_er = 11.0;
+      double n_v_env_form_factors[] = {0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 1};
+
+      for (size_t i = 0; i < n; ++i) {
+        H_tr[i] = 0;
+      }
+      // window and wall solar gains accumulate separately in monthly scratch 1 and 2
+      for (unsigned m = 0; m < 12; ++m) {
+        double* win_phi_sol = monthlyScratch(1, m);
+        double* wall_phi_sol = monthlyScratch(2, m);
+        for (size_t i = 0; i < n; ++i) {
+          win_phi_sol[i] = 0;
+          wall_phi_sol[i] = 0;
+        }
+      }
+
+      for (unsigned j = 0; j < 9; ++j) {
+        const double* wallA = in(WallArea + j);
+        const double* winA = in(WindowArea + j);
+        const double* wallU = in(WallUniform + j);
+        const double* winU = in(WindowUniform + j);
+        const double* emiss = in(WallThermalEmissivity + j);
+        const double* alpha = in(WallSolarAbsorbtion + j);
+        const double* g_gln = in(WindowTransmittance + j);
+        const double* scf = in(WindowShadingCorrection + j);
+        for (size_t i = 0; i < n; ++i) {
+          H_tr[i] += wallA[i] * wallU[i] + winA[i] * winU[i];
+        }
+        for (size_t i = 0; i < n; ++i) {
+          int sdfIndex = std::min(2, std::max(static_cast<int>(shadingDevice[i]) - 1, 0));
+          double win_A_sol = n_win_SDF_table[sdfIndex] * 1.0 * (g_gln[i] * n_win_F_W) * (1.0 - n_win_ff) * winA[i];
+          double win_scaled = scf[i] * 1.0 * win_A_sol;
+          double wall_A_sol = alpha[i] * n_R_sc_ext * wallU[i] * wallA[i];
+          double wall_phi_r = n_R_sc_ext * wallU[i] * wallA[i] * (emiss[i] * 5.0) * theta_er * n_v_env_form_factors[j];
+          for (unsigned m = 0; m < 12; ++m) {
+            monthlyScratch(1, m)[i] += win_scaled * m_solar[m][j];
+            monthlyScratch(2, m)[i] += wall_A_sol * m_solar[m][j] - wall_phi_r;
+          }
+        }
+      }
+
+      for (unsigned m = 0; m < 12; ++m) {
+        double* E_sol = monthlyScratch(0, m);
+        for (size_t i = 0; i < n; ++i) {
+          E_sol[i] = (monthlyScratch(1, m)[i] + monthlyScratch(2, m)[i]) * megasecondsInMonth[m];
+        }
+      }
+    }
+
+    // heatGainsAndLosses and internalHeatGain
+    {
+      const double* heatGain = in(HeatGainPerPerson);
+      const double* densityOccupied = in(DensityOccupied);
+      const double* densityUnoccupied = in(DensityUnoccupied);
+      const double* elecOcc = in(ElectricApplianceOccupied);
+      const double* elecUnocc = in(ElectricApplianceUnoccupied);
+      const double* gasOcc = in(GasApplianceOccupied);
+      const double* gasUnocc = in(GasApplianceUnoccupied);
+      for (size_t i = 0; i < n; ++i) {
+        double phi_int_occ = heatGain[i] / densityOccupied[i];
+        double phi_int_unocc = heatGain[i] / densityUnoccupied[i];
+        double phi_int_avg = frac_hrs_wk_day[i] * phi_int_occ + (1 - frac_hrs_wk_day[i]) * phi_int_unocc;
+        double phi_plug_occ = elecOcc[i] + gasOcc[i];
+        double phi_plug_unocc = elecUnocc[i] + gasUnocc[i];
+        double phi_plug_avg = phi_plug_occ * frac_hrs_wk_day[i] + phi_plug_unocc * (1 - frac_hrs_wk_day[i]);
+        double phi_illum_avg = Q_illum_tot_yr[i] / floorArea[i] / hoursInYear * 1000;
+        phi_I_tot[i] = phi_int_avg * floorArea[i] + phi_plug_avg * floorArea[i] + phi_illum_avg * floorArea[i];
+      }
+    }
+
+    // interiorTemp
+    //
+    // SimModel builds its free floating temperature and heat gain terms (M_Te and M_dT) as zero
+    // matrices and uses the same set points every month, so the averaged set points reduce to one
+    // value per parameter set and the unoccupied heat gains do not contribute.
+    {
+      const double* bem = in(BuildingEnergyManagement);
+      const double* heatingOccupied = in(HeatingSetPointOccupied);
+      const double* heatingUnoccupied = in(HeatingSetPointUnoccupied);
+      const double* coolingOccupied = in(CoolingSetPointOccupied);
+      const double* coolingUnoccupied = in(CoolingSetPointUnoccupied);
+      const double* interiorHeatCapacity = in(InteriorHeatCapacity);
+      const double* wallHeatCapacity = in(WallHeatCapacity);
+
+      for (size_t i = 0; i < n; ++i) {
+        double wallAreaSum = 0;
+        for (unsigned j = 0; j < 9; ++j) {
+          wallAreaSum += m_inputs[WallArea + j][begin + i];
+        }
+        double Cm = interiorHeatCapacity[i] * floorArea[i] + wallHeatCapacity[i] * wallAreaSum;
+        double H_tot = H_tr[i] + 0.0;
+        tau[i] = Cm / H_tot / 3600.0;
+      }
+
+      for (size_t i = 0; i < n; ++i) {
+        int bemType = static_cast<int>(bem[i]);
+        double T_adj = bemType == 2 ? 0.5 : (bemType == 3 ? 1.0 : 0.0);
+        double ht_tset_ctrl = heatingOccupied[i] - T_adj;
+        double cl_tset_ctrl = coolingOccupied[i] + T_adj;
+        double ht_tset_unocc = heatingUnoccupied[i];
+        double cl_tset_unocc = coolingUnoccupied[i];
+
+        double v_ti[] = {hoursUnoccupiedPerDay[i], hoursOccupiedPerDay[i], hoursUnoccupiedPerDay[i], hoursOccupiedPerDay[i], hoursUnoccupiedPerDay[i]};
+        double decay[5];
+        for (unsigned k = 0; k < 5; ++k) {
+          decay[k] = std::exp(-1 * v_ti[k] / tau[i]);
+        }
+
+        // heating
+        double Ta[4];
+        double Tstart = ht_tset_ctrl;
+        for (unsigned k = 0; k < 4; ++k) {
+          Tstart = Ta[k] = (Tstart - 0.0 - 0.0) * decay[k] + 0.0 + 0.0;
+        }
+        double Th_wke_sum = 0;
+        double Th_wk_nt = 0;
+        for (unsigned k = 0; k < 5; ++k) {
+          double Taa = k == 0 ? 0.0 : std::max(Ta[k - 1], ht_tset_unocc);
+          double v_T_avg = tau[i] / v_ti[k] * (Taa - 0.0 - 0.0) * (1 - decay[k]) + 0.0 + 0.0;
+          double Tb = std::max(v_T_avg, ht_tset_unocc);
+          Th_wke_sum += Tb;
+          if (k == 1) {
+            Th_wk_nt = Tb;
+          }
+        }
+        double Th_wke_avg = Th_wke_sum / 5;
+
+        // cooling
+        double Tc[4];
+        Tstart = cl_tset_ctrl;
+        for (unsigned k = 0; k < 4; ++k) {
+          Tstart = Tc[k] = (Tstart - 0.0 - 0.0) * decay[k] + 0.0 + 0.0;
+        }
+        double Tc_wke_sum = 0;
+        double Tc_wk_nt = 0;
+        for (unsigned k = 0; k < 5; ++k) {
+          double Tcc = k == 0 ? 0.0 : std::max(Tc[k - 1], cl_tset_unocc);
+          double v_T_avg = tau[i] / v_ti[k] * (Tcc - 0.0 - 0.0) * (1 - decay[k]) + 0.0 + 0.0;
+          double Td = std::max(v_T_avg, cl_tset_unocc);
+          Tc_wke_sum += Td;
+          if (k == 1) {
+            Tc_wk_nt = Td;
+          }
+        }
+        double Tc_wke_avg = Tc_wke_sum / 5;
+
+        double Th_wk_avg = ht_tset_ctrl * frac_hrs_wk_day[i] + Th_wk_nt * frac_hrs_wk_nt[i] + Th_wke_avg * frac_hrs_wke_tot[i];
+        double Tc_wk_avg = cl_tset_ctrl * frac_hrs_wk_day[i] + Tc_wk_nt * frac_hrs_wk_nt[i] + Tc_wke_avg * frac_hrs_wke_tot[i];
+        Th_avg[i] = std::min(Th_wk_avg, ht_tset_ctrl);
+        Tc_avg[i] = std::min(Tc_wk_avg, cl_tset_ctrl);
+      }
+    }
+
+    // ventilationCalc, Hve_ht and Hve_cl replace the solar gain terms in monthly scratch 1 and 2
+    {
+      const double* buildingHeight = in(BuildingHeight);
+      const double* supplyRate = in(SupplyRate);
+      const double* supplyDifference = in(SupplyDifference);
+      const double* heatRecovery = in(HeatRecoveryEfficiency);
+      const double* exhaustRecirculated = in(ExhaustAirRecirculated);
+      const double* ventilationType = in(VentilationType);
+      const double* infiltrationRate = in(InfiltrationRate);
+      double n_p_exp = 0.65;
+      double n_zone_frac = 0.7;
+      double n_stack_exp = 0.667;
+      double n_stack_coeff = 0.0146;
+      double n_wind_coeff = 0.0769;
+      double n_sw_coeff = 0.14;
+      double n_rhoc_air = 1200;
+      double pressureRatio = std::pow((4.0 / 75.0), n_p_exp);
+
+      for (size_t i = 0; i < n; ++i) {
+        double vent_zone_height = std::max(0.1, buildingHeight[i]);
+        double qv_supp = supplyRate[i] / floorArea[i] / 3.6;
+        double qv_ext = -(qv_supp - supplyDifference[i] / floorArea[i] / 3.6);
+        double qv_diff = qv_supp + qv_ext + 0.0;
+        double vent_outdoor_frac = 1 - exhaustRecirculated[i];
+        double tot_env_A_wall = 0;
+        double tot_env_A_win = 0;
+        for (unsigned j = 0; j < 9; ++j) {
+          tot_env_A_wall += m_inputs[WallArea + j][begin + i];
+          tot_env_A_win += m_inputs[WindowArea + j][begin + i];
+        }
+        double v_Q75pa = infiltrationRate[i] == 0 ? 0.00000000001 : infiltrationRate[i];
+        double Q4 = v_Q75pa * (tot_env_A_wall + tot_env_A_win) / floorArea[i] * pressureRatio;
+        double h_stack = n_zone_frac * vent_zone_height;
+        double infiltration = std::max(0.0, -qv_diff);
+        double mechanical = ventilationType[i] == 3 ? 0 : (frac_hrs_wk_day[i] * qv_supp * vent_outdoor_frac * (1 - heatRecovery[i]));
+
+        for (unsigned m = 0; m < 12; ++m) {
+          double stackCoeff = n_stack_coeff * Q4;
+          double qv_wind = m_windPowered[m] * Q4 * n_wind_coeff;
+          double qv_stack_ht = std::max(std::pow(std::fabs(m_dbt[m] - Th_avg[i]) * h_stack, n_stack_exp) * stackCoeff, 0.001);
+          double qv_stack_cl = std::max(std::pow(std::fabs(m_dbt[m] - Tc_avg[i]) * h_stack, n_stack_exp) * stackCoeff, 0.001);
+          double qv_sw_ht = std::max(qv_stack_ht, qv_wind) + safeDiv(qv_stack_ht * qv_wind * n_sw_coeff, Q4);
+          double qv_sw_cl = std::max(qv_stack_cl, qv_wind) + safeDiv(qv_stack_cl * qv_wind * n_sw_coeff, Q4);
+          monthlyScratch(1, m)[i] = (qv_sw_ht + infiltration + mechanical) * n_rhoc_air / 3600.0;
+          monthlyScratch(2, m)[i] = (qv_sw_cl + infiltration + mechanical) * n_rhoc_air / 3600.0;
+        }
+      }
+    }
+
+    // heatingAndCooling, Qneed_ht and Qneed_cl are stored in monthly scratch 3 and 4
+    {
+      const double* heatingOccupied = in(HeatingSetPointOccupied);
+      const double* coolingOccupied = in(CoolingSetPointOccupied);
+      const double* supplyRate = in(SupplyRate);
+      const double* fanPower = in(FanPower);
+      const double* fanControl = in(FanControlFactor);
+      double a_H0 = 1;
+      double tau_H0 = 15;
+      double n_dT_supp_ht = 7.0;
+      double n_dT_supp_cl = 7.0;
+      double n_rhoC_a = 1.22521 * 0.001012;
+
+      for (unsigned m = 0; m < 12; ++m) {
+        const double* E_sol = monthlyScratch(0, m);
+        const double* Hve_ht = monthlyScratch(1, m);
+        const double* Hve_cl = monthlyScratch(2, m);
+        double* Qneed_ht = monthlyScratch(3, m);
+        double* Qneed_cl = monthlyScratch(4, m);
+        double* fans = out(ISOBatchResults::ElectricFans, m);
+        double Ms = megasecondsInMonth[m];
+        double dbt = m_dbt[m];
+        for (size_t i = 0; i < n; ++i) {
+          double a_H = a_H0 + tau[i] / tau_H0;
+          double gain = Ms * phi_I_tot[i] + E_sol[i];
+
+          double QT_ht = (Th_avg[i] - dbt) * Ms * H_tr[i];
+          double QV_ht = Hve_ht[i] * floorArea[i] * (Th_avg[i] - dbt) * Ms;
+          double Qtot_ht = QT_ht + QV_ht;
+          double gamma_ht = safeDiv(gain, Qtot_ht + minDouble);
+          double eta_ht = gamma_ht > 0 ? (1 - std::pow(gamma_ht, a_H)) / (1 - std::pow(gamma_ht, (a_H + 1))) : 1 / (gamma_ht + minDouble);
+          Qneed_ht[i] = Qtot_ht - eta_ht * gain;
+
+          double QT_cl = (Tc_avg[i] - dbt) * H_tr[i] * Ms;
+          double QV_cl = Hve_cl[i] * floorArea[i] * (Tc_avg[i] - dbt) * Ms;
+          double Qtot_cl = QT_cl + QV_cl;
+          double gamma_cl = safeDiv(Qtot_cl, gain + minDouble);
+          double eta_cl = gamma_cl > 0.0 ? (1.0 - std::pow(gamma_cl, a_H)) / (1.0 - std::pow(gamma_cl, (a_H + 1.0))) : 1.0;
+          Qneed_cl[i] = gain - eta_cl * Qtot_cl;
+
+          double T_sup_ht = heatingOccupied[i] + n_dT_supp_ht;
+          double T_sup_cl = coolingOccupied[i] - n_dT_supp_cl;
+          double Vair_ht = safeDiv(Qneed_ht[i], (T_sup_ht - Th_avg[i]) * n_rhoC_a + minDouble);
+          double Vair_cl = safeDiv(Qneed_cl[i], (Tc_avg[i] - T_sup_cl) * n_rhoC_a + minDouble);
+          double Vair_tot = std::max(Vair_ht + Vair_cl, safeDiv(Ms * (supplyRate[i] * frac_hrs_wk_day[i]), 1000));
+          double fan = Vair_tot * (fanPower[i] * fanControl[i]);
+          fans[i] = safeDiv(safeDiv(fan, floorArea[i]), 3600);
+        }
+      }
+    }
+
+    // hvac and pump
+    {
+      const double* cop = in(CoolingCOP);
+      const double* plv = in(CoolingPartialLoadValue);
+      const double* wasteFactor = in(HotColdWasteFactor);
+      const double* heatingLoss = in(HeatingLossFactor);
+      const double* coolingLoss = in(CoolingLossFactor);
+      const double* efficiency = in(HeatingEfficiency);
+      const double* energyType = in(HeatingEnergyType);
+      const double* heatingPump = in(HeatingPumpControl);
+      const double* coolingPump = in(CoolingPumpControl);
+      double n_E_pumps = 0.25;
+      double Q_pumps_yr = 0;
+      for (double Ms : megasecondsInMonth) {
+        Q_pumps_yr += Ms * n_E_pumps;
+      }
+
+      for (size_t i = 0; i < n; ++i) {
+        double Qneed_ht_yr = 0;
+        double Qneed_cl_yr = 0;
+        for (unsigned m = 0; m < 12; ++m) {
+          Qneed_ht_yr += monthlyScratch(3, m)[i];
+          Qneed_cl_yr += monthlyScratch(4, m)[i];
+        }
+
+        double IEER = cop[i] * plv[i];
+        double f_dem_ht = std::max(Qneed_ht_yr / (Qneed_cl_yr + Qneed_ht_yr), 0.1);
+        double f_dem_cl = std::max((1.0 - f_dem_ht), 0.1);
+        double eta_dist_ht = 1.0 / (1.0 + heatingLoss[i] + wasteFactor[i] / f_dem_ht);
+        double eta_dist_cl = 1.0 / (1.0 + coolingLoss[i] + wasteFactor[i] / f_dem_cl);
+
+        double frac_ht_total = 0;
+        double frac_cl_total = 0;
+        double frac_total = 0;
+        for (unsigned m = 0; m < 12; ++m) {
+          double Qneed_ht = monthlyScratch(3, m)[i];
+          double Qneed_cl = monthlyScratch(4, m)[i];
+          frac_ht_total += safeDiv(Qneed_ht, Qneed_ht + Qneed_cl);
+          frac_cl_total += safeDiv(Qneed_cl, Qneed_ht + Qneed_cl);
+          frac_total += safeDiv(Qneed_ht + Qneed_cl, Qneed_ht_yr + Qneed_cl_yr);
+        }
+        double Q_pumps_ht = Q_pumps_yr * heatingPump[i] * floorArea[i];
+        double Q_pumps_cl = Q_pumps_yr * coolingPump[i] * floorArea[i];
+        double Q_pumps_tot = Q_pumps_ht + Q_pumps_cl;
+
+        for (unsigned m = 0; m < 12; ++m) {
+          double Qneed_ht = monthlyScratch(3, m)[i];
+          double Qneed_cl = monthlyScratch(4, m)[i];
+
+          double Qloss_ht_dist = safeDiv(Qneed_ht * (1 - eta_dist_ht), eta_dist_ht);
+          double Qloss_cl_dist = safeDiv(Qneed_cl * (1 - eta_dist_cl), eta_dist_cl);
+          double Qht_sys = safeDiv(Qloss_ht_dist + Qneed_ht, efficiency[i] + minDouble);
+          double Qcl_sys = safeDiv(Qloss_cl_dist + Qneed_cl, IEER + minDouble);
+          double Qelec_ht = energyType[i] == 1 ? Qht_sys : 0.0;
+          double Qgas_ht = energyType[i] == 1 ? 0.0 : Qht_sys + 0.0;
+
+          double Q_pump;
+          if (Q_pumps_ht == 0 || Q_pumps_cl == 0) {
+            Q_pump = safeDiv(safeDiv(Qneed_ht, Qneed_ht + Qneed_cl) * Q_pumps_ht, frac_ht_total) +
+                     safeDiv(safeDiv(Qneed_cl, Qneed_ht + Qneed_cl) * Q_pumps_cl, frac_cl_total);
+          } else {
+            Q_pump = safeDiv(safeDiv(Qneed_ht + Qneed_cl, Qneed_ht_yr + Qneed_cl_yr) * Q_pumps_tot, frac_total);
+          }
+
+          out(ISOBatchResults::ElectricHeating, m)[i] = safeDiv(safeDiv(Qelec_ht, floorArea[i]), kWh2MJ);
+          out(ISOBatchResults::ElectricCooling, m)[i] = safeDiv(safeDiv(Qcl_sys + 0.0, floorArea[i]), kWh2MJ);
+          out(ISOBatchResults::ElectricPumps, m)[i] = safeDiv(safeDiv(Q_pump, floorArea[i]), kWh2MJ);
+          out(ISOBatchResults::GasHeating, m)[i] = safeDiv(safeDiv(Qgas_ht, floorArea[i]), kWh2MJ);
+          out(ISOBatchResults::GasCooling, m)[i] = safeDiv(safeDiv(0.0, floorArea[i]), kWh2MJ);
+        }
+      }
+    }
+
+    // heatedWater and the appliance part of outputGeneration
+    {
+      const double* hotWaterDemand = in(HotWaterDemand);
+      const double* distributionEfficiency = in(HotWaterDistributionEfficiency);
+      const double* systemEfficiency = in(HotWaterSystemEfficiency);
+      const double* hotWaterEnergyType = in(HotWaterEnergyType);
+      const double* elecOcc = in(ElectricApplianceOccupied);
+      const double* elecUnocc = in(ElectricApplianceUnoccupied);
+      const double* gasOcc = in(GasApplianceOccupied);
+      const double* gasUnocc = in(GasApplianceUnoccupied);
+      double n_dhw_tset = 60;
+      double n_dhw_tsupply = 20;
+      double n_CP_h20 = 4.18;
+
+      for (unsigned m = 0; m < 12; ++m) {
+        double* dhwElec = out(ISOBatchResults::ElectricWaterSystems, m);
+        double* dhwGas = out(ISOBatchResults::GasWaterSystems, m);
+        double* plugElec = out(ISOBatchResults::ElectricInteriorEquipment, m);
+        double* plugGas = out(ISOBatchResults::GasInteriorEquipment, m);
+        for (size_t i = 0; i < n; ++i) {
+          double Q_dhw_yr = hotWaterDemand[i] * (n_dhw_tset - n_dhw_tsupply) * n_CP_h20;
+          double Qe_demand = safeDiv(daysInMonth[m] * Q_dhw_yr / daysInYear, distributionEfficiency[i]);
+          double Q_dhw_need = std::max(safeDiv(Qe_demand / kWh2MJ - 0.0, systemEfficiency[i]), 0.0);
+          dhwElec[i] = safeDiv(hotWaterEnergyType[i] == 1 ? Q_dhw_need : 0.0, floorArea[i]);
+          dhwGas[i] = safeDiv(hotWaterEnergyType[i] == 1 ? 0.0 : Q_dhw_need, floorArea[i]);
+
+          double E_plug_elec = elecOcc[i] * frac_hrs_wk_day[i] + elecUnocc[i] * (1.0 - frac_hrs_wk_day[i]);
+          double E_plug_gas = gasOcc[i] * frac_hrs_wk_day[i] + gasUnocc[i] * (1.0 - frac_hrs_wk_day[i]);
+          plugElec[i] = hoursInMonth[m] * E_plug_elec / 1000.0;
+          plugGas[i] = hoursInMonth[m] * E_plug_gas / 1000.0;
+        }
+      }
+    }
+  }
+
+} // isomodel
+} // openstudio
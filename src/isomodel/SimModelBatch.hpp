@@ -0,0 +1,174 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef ISOMODEL_SIMMODELBATCH_HPP
+#define ISOMODEL_SIMMODELBATCH_HPP
+
+#include "ISOModelAPI.hpp"
+#include "SimModel.hpp"
+
+#include "../utilities/core/Logger.hpp"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace openstudio {
+
+namespace isomodel {
+
+  /*
+   *  Monthly end use intensities for every parameter set in a SimModelBatch.
+   *  Values are stored end use major, then month, then parameter set so that each
+   *  (end use, month) pair is one contiguous array over the batch.
+   */
+  class ISOMODEL_API ISOBatchResults {
+  public:
+    enum EndUse {
+      ElectricHeating,
+      ElectricCooling,
+      ElectricInteriorLights,
+      ElectricExteriorLights,
+      ElectricFans,
+      ElectricPumps,
+      ElectricInteriorEquipment,
+      ElectricWaterSystems,
+      GasHeating,
+      GasCooling,
+      GasInteriorEquipment,
+      GasWaterSystems,
+      NumEndUses
+    };
+
+    ISOBatchResults();
+    explicit ISOBatchResults(size_t size);
+
+    /// number of parameter sets
+    size_t size() const;
+
+    double value(size_t index, unsigned month, EndUse endUse) const;
+
+    /// contiguous values for every parameter set, indexed by parameter set
+    const double* values(EndUse endUse, unsigned month) const;
+    double* values(EndUse endUse, unsigned month);
+
+    /// sum of all end uses over the year for one parameter set
+    double totalEnergyUse(size_t index) const;
+
+    /// converts one parameter set to the form returned by SimModel::simulate
+    ISOResults toISOResults(size_t index) const;
+
+  private:
+    size_t m_size;
+    std::vector<double> m_values;
+  };
+
+  /*
+   *  Evaluates many ISO model parameter sets that share the same Location (weather and terrain).
+   *
+   *  Weather dependent terms are computed once when the batch is constructed. Parameter sets are
+   *  stored structure-of-arrays and the monthly equations of SimModel::simulate run as loops over
+   *  blocks of parameter sets, so a batch run does no per parameter set allocation.
+   *  Results match SimModel::simulate for each parameter set.
+   */
+  class ISOMODEL_API SimModelBatch {
+  public:
+    explicit SimModelBatch(std::shared_ptr<Location> location);
+
+    /// uses the location of model, which typically is also the first parameter set added
+    explicit SimModelBatch(const SimModel& model);
+
+    std::shared_ptr<Location> location() const;
+
+    /*
+     *  Appends the parameter set of a SimModel and returns its index in the batch.
+     *  The SimModel's own location is not used, the batch location is used instead.
+     *  Throws if the SimModel is missing any of its components.
+     */
+    size_t add(const SimModel& model);
+
+    void reserve(size_t size);
+
+    size_t size() const;
+
+    void clear();
+
+    ISOBatchResults simulate() const;
+
+    REGISTER_LOGGER("openstudio.isomodel.SimModelBatch");
+
+  private:
+    void precomputeWeather();
+
+    enum Input {
+      HoursStart, HoursEnd, DaysStart, DaysEnd,
+      DensityOccupied, DensityUnoccupied, HeatGainPerPerson,
+      LightingOccupancySensor, ConstantIllumination,
+      ElectricApplianceOccupied, ElectricApplianceUnoccupied,
+      GasApplianceOccupied, GasApplianceUnoccupied, BuildingEnergyManagement,
+      PowerDensityOccupied, PowerDensityUnoccupied, DimmingFraction, ExteriorEnergy,
+      HeatingSetPointOccupied, HeatingSetPointUnoccupied, HeatingLossFactor, HotColdWasteFactor,
+      HeatingEfficiency, HeatingEnergyType, HeatingPumpControl,
+      HotWaterDemand, HotWaterDistributionEfficiency, HotWaterSystemEfficiency, HotWaterEnergyType,
+      CoolingSetPointOccupied, CoolingSetPointUnoccupied, CoolingCOP, CoolingPartialLoadValue,
+      CoolingLossFactor, CoolingPumpControl,
+      SupplyRate, SupplyDifference, HeatRecoveryEfficiency, ExhaustAirRecirculated,
+      VentilationType, FanPower, FanControlFactor,
+      FloorArea, BuildingHeight, InfiltrationRate, InteriorHeatCapacity, WallHeatCapacity,
+      WindowShadingDevice,
+      // directional inputs take 9 consecutive slots [S, SE, E, NE, N, NW, W, SW, roof]
+      WallArea,
+      WindowArea = WallArea + 9,
+      WallUniform = WindowArea + 9,
+      WindowUniform = WallUniform + 9,
+      WallThermalEmissivity = WindowUniform + 9,
+      WallSolarAbsorbtion = WallThermalEmissivity + 9,
+      WindowTransmittance = WallSolarAbsorbtion + 9,
+      WindowShadingCorrection = WindowTransmittance + 9,
+      NumInputs = WindowShadingCorrection + 9
+    };
+
+    void simulateBlock(size_t begin, size_t end, std::vector<double>& scratch, ISOBatchResults& results) const;
+
+    std::shared_ptr<Location> m_location;
+
+    // weather dependent terms shared by every parameter set
+    double m_dbt[12];
+    double m_windPowered[12];
+    double m_hoursSunDown[12];
+    double m_solar[12][9];
+
+    std::array<std::vector<double>, NumInputs> m_inputs;
+  };
+
+} // isomodel
+} // openstudio
+
+#endif // ISOMODEL_SIMMODELBATCH_HPP
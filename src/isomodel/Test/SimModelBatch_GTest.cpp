@@ -0,0 +1,137 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "ISOModelFixture.hpp"
+#include "../SimModelBatch.hpp"
+#include "../UserModel.hpp"
+#include <resources.hxx>
+
+#include <random>
+
+using namespace openstudio::isomodel;
+using namespace openstudio;
+
+namespace {
+
+  // builds variants of the example model, including the branches of the heating, hot water and
+  // building energy management inputs
+  std::vector<SimModel> makeVariants(UserModel& userModel, size_t count)
+  {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> scale(0.5, 1.5);
+    std::uniform_int_distribution<int> flag(1, 3);
+
+    double wallU = userModel.wallUvalueS();
+    double windowU = userModel.windowUvalueS();
+    double windowSHGC = userModel.windowSHGCS();
+    double lpd = userModel.lightingPowerIntensityOccupied();
+    double cop = userModel.coolingSystemCOP();
+    double efficiency = userModel.heatingSystemEfficiency();
+    double leakage = userModel.buildingAirLeakage();
+    double floorArea = userModel.floorArea();
+    double heatingSetpoint = userModel.heatingOccupiedSetpoint();
+    double coolingSetpoint = userModel.coolingOccupiedSetpoint();
+
+    std::vector<SimModel> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      userModel.setWallUvalueS(wallU * scale(generator));
+      userModel.setWallUvalueN(wallU * scale(generator));
+      userModel.setWindowUvalueS(windowU * scale(generator));
+      userModel.setWindowSHGCS(windowSHGC * scale(generator));
+      userModel.setWindowSHGCE(windowSHGC * scale(generator));
+      userModel.setLightingPowerIntensityOccupied(lpd * scale(generator));
+      userModel.setCoolingSystemCOP(cop * scale(generator));
+      userModel.setHeatingSystemEfficiency(efficiency * scale(generator));
+      userModel.setBuildingAirLeakage(leakage * scale(generator));
+      userModel.setFloorArea(floorArea * scale(generator));
+      userModel.setHeatingOccupiedSetpoint(heatingSetpoint + 4.0 * (scale(generator) - 1.0));
+      userModel.setCoolingOccupiedSetpoint(coolingSetpoint + 4.0 * (scale(generator) - 1.0));
+      userModel.setEquivFullLoadOccupancyFrom(6 + flag(generator));
+      userModel.setEquivFullLoadOccupancyTo(15 + flag(generator));
+      userModel.setHeatingEnergyCarrier(flag(generator) == 1 ? 1 : 2);
+      userModel.setDhwEnergyCarrier(flag(generator) == 1 ? 1 : 2);
+      userModel.setBemType(flag(generator));
+      userModel.setWindowSDFN(flag(generator));
+      result.push_back(userModel.toSimModel());
+    }
+    return result;
+  }
+
+  void expectSameResults(const ISOResults& expected, const ISOResults& actual)
+  {
+    ASSERT_EQ(expected.monthlyResults.size(), actual.monthlyResults.size());
+    for (size_t month = 0; month < expected.monthlyResults.size(); ++month) {
+      for (const auto& fuelType : EndUses::fuelTypes()) {
+        for (const auto& category : EndUses::categories()) {
+          double e = expected.monthlyResults[month].getEndUse(fuelType, category);
+          double a = actual.monthlyResults[month].getEndUse(fuelType, category);
+          EXPECT_NEAR(e, a, 1.0e-9 * std::max(1.0, std::abs(e)));
+        }
+      }
+    }
+  }
+
+}
+
+TEST_F(ISOModelFixture, SimModelBatch_MatchesSimulate)
+{
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+  SimModel simModel = userModel.toSimModel();
+
+  SimModelBatch batch(simModel);
+  EXPECT_EQ(0u, batch.add(simModel));
+  std::vector<SimModel> variants = makeVariants(userModel, 300);
+  for (const SimModel& variant : variants) {
+    batch.add(variant);
+  }
+  ASSERT_EQ(301u, batch.size());
+
+  ISOBatchResults results = batch.simulate();
+  ASSERT_EQ(301u, results.size());
+
+  ISOResults expected = simModel.simulate();
+  expectSameResults(expected, results.toISOResults(0));
+  EXPECT_NEAR(expected.totalEnergyUse(), results.totalEnergyUse(0), 1.0e-9 * expected.totalEnergyUse());
+  EXPECT_DOUBLE_EQ(expected.monthlyResults[6].getEndUse(EndUseFuelType::Electricity, EndUseCategoryType::Cooling),
+                   results.value(0, 6, ISOBatchResults::ElectricCooling));
+
+  // variants span several blocks
+  for (size_t i = 0; i < variants.size(); ++i) {
+    expectSameResults(variants[i].simulate(), results.toISOResults(i + 1));
+  }
+
+  batch.clear();
+  EXPECT_EQ(0u, batch.size());
+  EXPECT_EQ(0u, batch.simulate().size());
+}
@@ -0,0 +1,173 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "ISOModelFixture.hpp"
+
+#include "../WeatherCache.hpp"
+#include "../EpwData.hpp"
+#include "../UserModel.hpp"
+
+#include <resources.hxx>
+
+using namespace openstudio::isomodel;
+using namespace openstudio;
+
+namespace {
+
+  void expectSameWeather(const WeatherData& expected, const WeatherData& actual)
+  {
+    ASSERT_EQ(expected.msolar().size1(), actual.msolar().size1());
+    ASSERT_EQ(expected.msolar().size2(), actual.msolar().size2());
+    for (size_t i = 0; i < 12; ++i) {
+      for (size_t j = 0; j < expected.msolar().size2(); ++j) {
+        EXPECT_EQ(expected.msolar()(i, j), actual.msolar()(i, j));
+      }
+      for (size_t j = 0; j < 24; ++j) {
+        EXPECT_EQ(expected.mhdbt()(i, j), actual.mhdbt()(i, j));
+        EXPECT_EQ(expected.mhEgh()(i, j), actual.mhEgh()(i, j));
+      }
+      EXPECT_EQ(expected.mEgh()[i], actual.mEgh()[i]);
+      EXPECT_EQ(expected.mdbt()[i], actual.mdbt()[i]);
+      EXPECT_EQ(expected.mwind()[i], actual.mwind()[i]);
+    }
+  }
+
+  WeatherData parseWeather(const openstudio::path& epwPath)
+  {
+    EpwData edata(epwPath);
+    Matrix msolar, mhdbt, mhEgh;
+    Vector mEgh, mdbt, mwind;
+    edata.toISOData(msolar, mhdbt, mhEgh, mEgh, mdbt, mwind);
+
+    WeatherData result;
+    result.setMsolar(msolar);
+    result.setMhdbt(mhdbt);
+    result.setMhEgh(mhEgh);
+    result.setMEgh(mEgh);
+    result.setMdbt(mdbt);
+    result.setMwind(mwind);
+    return result;
+  }
+
+}
+
+TEST_F(ISOModelFixture, WeatherCache_Memory)
+{
+  openstudio::path epwPath = resourcesPath() / openstudio::toPath("isomodel/weather.epw");
+  openstudio::path cacheDirectory = WeatherCache::cacheDirectory();
+  WeatherCache::setCacheDirectory(openstudio::path());
+  WeatherCache::clear();
+
+  std::shared_ptr<const WeatherData> weather = WeatherCache::load(epwPath);
+  ASSERT_TRUE(weather);
+  EXPECT_EQ(1u, WeatherCache::size());
+  expectSameWeather(parseWeather(epwPath), *weather);
+
+  // same file is served from memory
+  EXPECT_EQ(weather, WeatherCache::load(epwPath));
+
+  // a copy of the file has the same checksum and shares the weather
+  openstudio::path copyPath = openstudio::tempDir() / openstudio::toPath("WeatherCache_Memory.epw");
+  openstudio::filesystem::remove(copyPath);
+  openstudio::filesystem::copy_file(epwPath, copyPath);
+  EXPECT_EQ(weather, WeatherCache::load(copyPath));
+  EXPECT_EQ(1u, WeatherCache::size());
+
+  // UserModel gets its own copy of the cached weather, changing it does not affect other models
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+  std::shared_ptr<WeatherData> modelWeather = userModel.loadWeather();
+  ASSERT_TRUE(modelWeather);
+  EXPECT_NE(weather.get(), modelWeather.get());
+  expectSameWeather(*weather, *modelWeather);
+  EXPECT_EQ(1u, WeatherCache::size());
+
+  Vector wind = modelWeather->mwind();
+  wind[0] += 10.0;
+  modelWeather->setMwind(wind);
+  expectSameWeather(parseWeather(epwPath), *weather);
+  expectSameWeather(*weather, *userModel.loadWeather());
+
+  EXPECT_THROW(WeatherCache::load(openstudio::tempDir() / openstudio::toPath("WeatherCache_Missing.epw")), std::runtime_error);
+
+  WeatherCache::clear();
+  EXPECT_EQ(0u, WeatherCache::size());
+  EXPECT_NE(weather, WeatherCache::load(epwPath));
+
+  WeatherCache::clear();
+  WeatherCache::setCacheDirectory(cacheDirectory);
+}
+
+TEST_F(ISOModelFixture, WeatherCache_Binary)
+{
+  openstudio::path epwPath = resourcesPath() / openstudio::toPath("isomodel/weather.epw");
+  openstudio::path cacheDirectory = WeatherCache::cacheDirectory();
+  openstudio::path testDirectory = openstudio::tempDir() / openstudio::toPath("WeatherCache_Binary");
+  openstudio::filesystem::remove_all(testDirectory);
+
+  WeatherData expected = parseWeather(epwPath);
+
+  // round trip
+  openstudio::filesystem::create_directories(testDirectory);
+  openstudio::path binaryPath = testDirectory / openstudio::toPath("weather.isowx");
+  ASSERT_TRUE(WeatherCache::writeBinary(expected, binaryPath));
+  std::shared_ptr<const WeatherData> weather = WeatherCache::readBinary(binaryPath);
+  ASSERT_TRUE(weather);
+  expectSameWeather(expected, *weather);
+
+  EXPECT_FALSE(WeatherCache::readBinary(testDirectory / openstudio::toPath("missing.isowx")));
+  EXPECT_FALSE(WeatherCache::readBinary(epwPath));
+
+  // load stores the binary form in the cache directory and reads it back once the memory cache is dropped
+  openstudio::filesystem::remove_all(testDirectory);
+  WeatherCache::setCacheDirectory(testDirectory);
+  WeatherCache::clear();
+  weather = WeatherCache::load(epwPath);
+  ASSERT_TRUE(weather);
+
+  std::vector<openstudio::path> files;
+  for (openstudio::filesystem::directory_iterator it(testDirectory); it != openstudio::filesystem::directory_iterator(); ++it) {
+    files.push_back(it->path());
+  }
+  ASSERT_EQ(1u, files.size());
+  EXPECT_EQ(".isowx", openstudio::toString(files[0].extension()));
+
+  WeatherCache::clear();
+  std::shared_ptr<const WeatherData> cached = WeatherCache::load(epwPath);
+  ASSERT_TRUE(cached);
+  EXPECT_NE(weather, cached);
+  expectSameWeather(expected, *cached);
+
+  WeatherCache::clear();
+  WeatherCache::setCacheDirectory(cacheDirectory);
+  openstudio::filesystem::remove_all(testDirectory);
+}
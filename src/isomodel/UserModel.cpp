@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "UserModel.hpp"
+#include "WeatherCache.hpp"
 
 using namespace std;
 namespace openstudio {
@@ -624,26 +625,8 @@ namespace isomodel {
         return std::shared_ptr<WeatherData>();
       }
     }
-    EpwData edata(weatherFilename);
-
-    Matrix _msolar(12,8,0);
-    Matrix _mhdbt(12,24,0);
-    Matrix _mhEgh(12,24,0);
-    Vector _mEgh(12);
-    Vector _mdbt(12);
-    Vector _mwind(12);
-
-    edata.toISOData(_msolar, _mhdbt, _mhEgh, _mEgh, _mdbt, _mwind);
-
-    std::shared_ptr<WeatherData> wdata(new WeatherData);
-    wdata->setMdbt(_mdbt);
-    wdata->setMEgh(_mEgh);
-    wdata->setMhdbt(_mhdbt);
-    wdata->setMhEgh(_mhEgh);
-    wdata->setMsolar(_msolar);
-    wdata->setMwind(_mwind);
-
-    return wdata;
+    // the cached weather is shared by every model using this file, give this model its own copy
+    return std::make_shared<WeatherData>(*WeatherCache::load(weatherFilename));
   }
 
   void UserModel::load(const openstudio::path &buildingFile){
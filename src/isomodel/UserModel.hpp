@@ -51,6 +51,7 @@ namespace isomodel {
      * Exposed to allow for separate loading from Ruby Scripts
      * Call setWeatherFilePath(path) then loadWeather() to update
      * the UserModel with a new set of weather data
+     * Parsed weather is cached by WeatherCache, each call returns a new copy of it
      */
     std::shared_ptr<WeatherData> loadWeather();
 
@@ -0,0 +1,340 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "WeatherCache.hpp"
+#include "EpwData.hpp"
+
+#include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/System.hpp"
+#include "../utilities/core/UUID.hpp"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+namespace openstudio {
+namespace isomodel {
+
+namespace {
+
+  constexpr char binaryMagic[8] = {'O', 'S', 'I', 'S', 'O', 'W', 'X', '\0'};
+  constexpr std::uint32_t binaryVersion = 1;
+  constexpr std::uint32_t byteOrderMark = 0x01020304;
+
+  constexpr std::uint32_t numMonths = 12;
+  constexpr std::uint32_t numHours = 24;
+  constexpr std::uint32_t numSurfaces = 8;
+
+  struct BinaryHeader
+  {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint32_t months;
+    std::uint32_t hours;
+    std::uint32_t surfaces;
+    std::uint32_t reserved;
+  };
+
+  // msolar, mhdbt and mhEgh one column of 12 months at a time, then mEgh, mdbt and mwind
+  constexpr size_t numBinaryValues = numMonths * (numSurfaces + numHours + numHours + 3);
+
+  struct FileStamp
+  {
+    std::time_t lastWriteTime;
+    std::uintmax_t size;
+    std::string checksum;
+  };
+
+  struct CacheState
+  {
+    std::mutex mutex;
+    bool cacheDirectoryInitialized = false;
+    openstudio::path cacheDirectory;
+    // checksum of each EPW path seen, reused while the file is unchanged
+    std::map<openstudio::path, FileStamp> stamps;
+    std::map<std::string, std::shared_ptr<const WeatherData>> weather;
+  };
+
+  CacheState& cacheState()
+  {
+    static CacheState state;
+    return state;
+  }
+
+  // caller must hold the cache mutex
+  openstudio::path cacheDirectoryLocked(CacheState& state)
+  {
+    if (!state.cacheDirectoryInitialized) {
+      state.cacheDirectoryInitialized = true;
+      if (boost::optional<std::string> directory = openstudio::System::getenv("OPENSTUDIO_ISOMODEL_WEATHER_CACHE")) {
+        state.cacheDirectory = openstudio::toPath(*directory);
+      }
+    }
+    return state.cacheDirectory;
+  }
+
+  std::shared_ptr<WeatherData> parseEpw(const openstudio::path &epwPath)
+  {
+    EpwData edata(epwPath);
+
+    Matrix _msolar(12,8,0);
+    Matrix _mhdbt(12,24,0);
+    Matrix _mhEgh(12,24,0);
+    Vector _mEgh(12);
+    Vector _mdbt(12);
+    Vector _mwind(12);
+
+    edata.toISOData(_msolar, _mhdbt, _mhEgh, _mEgh, _mdbt, _mwind);
+
+    std::shared_ptr<WeatherData> wdata(new WeatherData);
+    wdata->setMdbt(_mdbt);
+    wdata->setMEgh(_mEgh);
+    wdata->setMhdbt(_mhdbt);
+    wdata->setMhEgh(_mhEgh);
+    wdata->setMsolar(_msolar);
+    wdata->setMwind(_mwind);
+    return wdata;
+  }
+
+}
+
+std::shared_ptr<const WeatherData> WeatherCache::load(const openstudio::path &epwPath)
+{
+  CacheState& state = cacheState();
+
+  if (!openstudio::filesystem::is_regular_file(epwPath)) {
+    throw std::runtime_error("Unable to open weather file: " + openstudio::toString(epwPath));
+  }
+  std::time_t lastWriteTime = openstudio::filesystem::last_write_time(epwPath);
+  std::uintmax_t fileSize = openstudio::filesystem::file_size(epwPath);
+
+  std::string key;
+  openstudio::path cacheDirectory;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto stamp = state.stamps.find(epwPath);
+    if (stamp != state.stamps.end() && stamp->second.lastWriteTime == lastWriteTime && stamp->second.size == fileSize) {
+      key = stamp->second.checksum;
+      auto it = state.weather.find(key);
+      if (it != state.weather.end()) {
+        return it->second;
+      }
+    }
+    cacheDirectory = cacheDirectoryLocked(state);
+  }
+
+  if (key.empty()) {
+    key = openstudio::checksum(epwPath);
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.stamps[epwPath] = FileStamp{lastWriteTime, fileSize, key};
+    auto it = state.weather.find(key);
+    if (it != state.weather.end()) {
+      return it->second;
+    }
+  }
+
+  std::shared_ptr<WeatherData> result;
+  openstudio::path binaryPath;
+  if (!cacheDirectory.empty()) {
+    // the file size is part of the name so a checksum collision between different files is unlikely to be hit
+    binaryPath = cacheDirectory / openstudio::toPath(key + "-" + std::to_string(fileSize) + ".isowx");
+    result = readBinary(binaryPath);
+  }
+
+  if (!result) {
+    result = parseEpw(epwPath);
+    if (!binaryPath.empty()) {
+      // write under a unique name then rename so concurrent processes never see a partial file
+      boost::system::error_code ec;
+      openstudio::filesystem::create_directories(cacheDirectory, ec);
+      openstudio::path tempPath = cacheDirectory / openstudio::toPath(key + "-" + openstudio::removeBraces(openstudio::createUUID()) + ".tmp");
+      if (writeBinary(*result, tempPath)) {
+        openstudio::filesystem::rename(tempPath, binaryPath, ec);
+        if (ec) {
+          LOG(Warn, "Unable to store weather cache file " << openstudio::toString(binaryPath) << ": " << ec.message());
+          openstudio::filesystem::remove(tempPath, ec);
+        }
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  // another thread may have loaded the same weather in the meantime, keep the first one
+  return state.weather.emplace(key, std::move(result)).first->second;
+}
+
+openstudio::path WeatherCache::cacheDirectory()
+{
+  CacheState& state = cacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return cacheDirectoryLocked(state);
+}
+
+void WeatherCache::setCacheDirectory(const openstudio::path &directory)
+{
+  CacheState& state = cacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.cacheDirectoryInitialized = true;
+  state.cacheDirectory = directory;
+}
+
+void WeatherCache::clear()
+{
+  CacheState& state = cacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.stamps.clear();
+  state.weather.clear();
+}
+
+size_t WeatherCache::size()
+{
+  CacheState& state = cacheState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.weather.size();
+}
+
+bool WeatherCache::writeBinary(const WeatherData &weather, const openstudio::path &path)
+{
+  if (weather.msolar().size1() != numMonths || weather.msolar().size2() != numSurfaces ||
+      weather.mhdbt().size1() != numMonths || weather.mhdbt().size2() != numHours ||
+      weather.mhEgh().size1() != numMonths || weather.mhEgh().size2() != numHours ||
+      weather.mEgh().size() != numMonths || weather.mdbt().size() != numMonths || weather.mwind().size() != numMonths)
+  {
+    LOG(Error, "Weather data has unexpected dimensions, cannot write " << openstudio::toString(path));
+    return false;
+  }
+
+  std::vector<double> values;
+  values.reserve(numBinaryValues);
+  for (const Matrix* matrix : {&weather.msolar(), &weather.mhdbt(), &weather.mhEgh()}) {
+    for (size_t column = 0; column < matrix->size2(); ++column) {
+      for (size_t month = 0; month < numMonths; ++month) {
+        values.push_back((*matrix)(month, column));
+      }
+    }
+  }
+  for (const Vector* vector : {&weather.mEgh(), &weather.mdbt(), &weather.mwind()}) {
+    values.insert(values.end(), vector->begin(), vector->end());
+  }
+
+  BinaryHeader header;
+  std::memcpy(header.magic, binaryMagic, sizeof(header.magic));
+  header.version = binaryVersion;
+  header.byteOrder = byteOrderMark;
+  header.months = numMonths;
+  header.hours = numHours;
+  header.surfaces = numSurfaces;
+  header.reserved = 0;
+
+  std::ofstream file(openstudio::toSystemFilename(path), std::ios_base::binary | std::ios_base::trunc);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+  file.close();
+  if (!file) {
+    LOG(Error, "Unable to write weather cache file " << openstudio::toString(path));
+    return false;
+  }
+  return true;
+}
+
+std::shared_ptr<WeatherData> WeatherCache::readBinary(const openstudio::path &path)
+{
+  boost::system::error_code ec;
+  if (!openstudio::filesystem::is_regular_file(path, ec) ||
+      openstudio::filesystem::file_size(path, ec) != sizeof(BinaryHeader) + numBinaryValues * sizeof(double))
+  {
+    return std::shared_ptr<WeatherData>();
+  }
+
+  try {
+    boost::interprocess::file_mapping mapping(openstudio::toString(path).c_str(), boost::interprocess::read_only);
+    boost::interprocess::mapped_region region(mapping, boost::interprocess::read_only);
+    const char* bytes = static_cast<const char*>(region.get_address());
+
+    BinaryHeader header;
+    std::memcpy(&header, bytes, sizeof(header));
+    if (std::memcmp(header.magic, binaryMagic, sizeof(header.magic)) != 0 || header.version != binaryVersion ||
+        header.byteOrder != byteOrderMark || header.months != numMonths || header.hours != numHours || header.surfaces != numSurfaces)
+    {
+      LOG(Warn, "Ignoring incompatible weather cache file " << openstudio::toString(path));
+      return std::shared_ptr<WeatherData>();
+    }
+
+    // the region is page aligned but the values follow the header, copy instead of aliasing
+    const char* cursor = bytes + sizeof(header);
+    auto readColumns = [&cursor](Matrix& matrix) {
+      for (size_t column = 0; column < matrix.size2(); ++column) {
+        for (size_t month = 0; month < matrix.size1(); ++month) {
+          std::memcpy(&matrix(month, column), cursor, sizeof(double));
+          cursor += sizeof(double);
+        }
+      }
+    };
+    auto readVector = [&cursor](Vector& vector) {
+      std::memcpy(&vector[0], cursor, vector.size() * sizeof(double));
+      cursor += vector.size() * sizeof(double);
+    };
+
+    Matrix _msolar(numMonths, numSurfaces);
+    Matrix _mhdbt(numMonths, numHours);
+    Matrix _mhEgh(numMonths, numHours);
+    Vector _mEgh(numMonths);
+    Vector _mdbt(numMonths);
+    Vector _mwind(numMonths);
+    readColumns(_msolar);
+    readColumns(_mhdbt);
+    readColumns(_mhEgh);
+    readVector(_mEgh);
+    readVector(_mdbt);
+    readVector(_mwind);
+
+    std::shared_ptr<WeatherData> wdata(new WeatherData);
+    wdata->setMdbt(_mdbt);
+    wdata->setMEgh(_mEgh);
+    wdata->setMhdbt(_mhdbt);
+    wdata->setMhEgh(_mhEgh);
+    wdata->setMsolar(_msolar);
+    wdata->setMwind(_mwind);
+    return wdata;
+  } catch (const boost::interprocess::interprocess_exception& e) {
+    LOG(Warn, "Unable to map weather cache file " << openstudio::toString(path) << ": " << e.what());
+  }
+  return std::shared_ptr<WeatherData>();
+}
+
+}
+}
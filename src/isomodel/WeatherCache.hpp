@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef ISOMODEL_WEATHERCACHE_HPP
+#define ISOMODEL_WEATHERCACHE_HPP
+
+#include "ISOModelAPI.hpp"
+#include "WeatherData.hpp"
+
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Path.hpp"
+
+#include <memory>
+
+namespace openstudio {
+namespace isomodel {
+
+/**
+ * Process wide cache of WeatherData parsed from EPW files, keyed by the checksum of the EPW file.
+ *
+ * If a cache directory is set, parsed weather is also stored there in a compact binary form named
+ * after the checksum, so other processes sharing the directory memory map the binary file instead
+ * of parsing the EPW. The cache directory defaults to the OPENSTUDIO_ISOMODEL_WEATHER_CACHE
+ * environment variable.
+ *
+ * WeatherData returned from the cache is shared between all callers and is therefore const, copy it to modify it.
+ */
+class ISOMODEL_API WeatherCache
+{
+public:
+  /**
+   * Returns the weather for the EPW file at epwPath, parsing it only if it is not cached in memory or on disk.
+   * Throws if the file cannot be read.
+   */
+  static std::shared_ptr<const WeatherData> load(const openstudio::path &epwPath);
+
+  static openstudio::path cacheDirectory();
+  /**
+   * Sets the directory for binary weather files, an empty path disables the on disk cache
+   */
+  static void setCacheDirectory(const openstudio::path &directory);
+
+  /**
+   * Drops all weather cached in memory, binary files on disk are kept
+   */
+  static void clear();
+
+  /**
+   * Number of weather files cached in memory
+   */
+  static size_t size();
+
+  /**
+   * Writes weather in the binary cache format, each monthly column stored as a contiguous array
+   */
+  static bool writeBinary(const WeatherData &weather, const openstudio::path &path);
+
+  /**
+   * Reads weather from a file written by writeBinary, returns an empty pointer if the file is missing or invalid
+   */
+  static std::shared_ptr<WeatherData> readBinary(const openstudio::path &path);
+
+private:
+  REGISTER_LOGGER("openstudio.isomodel.WeatherCache");
+};
+
+}
+}
+
+#endif // ISOMODEL_WEATHERCACHE_HPP
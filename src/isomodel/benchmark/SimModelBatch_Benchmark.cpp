@@ -0,0 +1,127 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include "../../utilities/benchmark/BenchmarkHelpers.hpp"
+
+#include "../SimModelBatch.hpp"
+#include "../UserModel.hpp"
+
+#include "../../utilities/core/Path.hpp"
+
+#include <resources.hxx>
+
+#include <random>
+#include <vector>
+
+using namespace openstudio;
+using namespace openstudio::isomodel;
+
+namespace {
+
+  // variants of the example model with randomized envelope, lighting, system and schedule inputs
+  std::vector<SimModel> makeVariants(size_t count)
+  {
+    UserModel userModel;
+    userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+    if (!userModel.valid()) {
+      return std::vector<SimModel>();
+    }
+
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> scale(0.5, 1.5);
+    std::uniform_int_distribution<int> flag(1, 3);
+
+    double wallU = userModel.wallUvalueS();
+    double windowU = userModel.windowUvalueS();
+    double lpd = userModel.lightingPowerIntensityOccupied();
+    double cop = userModel.coolingSystemCOP();
+    double efficiency = userModel.heatingSystemEfficiency();
+    double heatingSetpoint = userModel.heatingOccupiedSetpoint();
+
+    std::vector<SimModel> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      userModel.setWallUvalueS(wallU * scale(generator));
+      userModel.setWindowUvalueS(windowU * scale(generator));
+      userModel.setLightingPowerIntensityOccupied(lpd * scale(generator));
+      userModel.setCoolingSystemCOP(cop * scale(generator));
+      userModel.setHeatingSystemEfficiency(efficiency * scale(generator));
+      userModel.setHeatingOccupiedSetpoint(heatingSetpoint + 4.0 * (scale(generator) - 1.0));
+      userModel.setEquivFullLoadOccupancyFrom(6 + flag(generator));
+      userModel.setBemType(flag(generator));
+      result.push_back(userModel.toSimModel());
+    }
+    return result;
+  }
+
+}
+
+static void BM_SimModelSimulateLoop(benchmark::State& state) {
+  std::vector<SimModel> variants = makeVariants(static_cast<size_t>(state.range(0)));
+  if (variants.empty()) {
+    state.SkipWithError("Could not load isomodel/exampleModel.ISO");
+    return;
+  }
+  for (auto _ : state) {
+    double total = 0.0;
+    for (const SimModel& variant : variants) {
+      total += variant.simulate().totalEnergyUse();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_SimModelSimulateLoop)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond);
+
+static void BM_SimModelBatch(benchmark::State& state) {
+  std::vector<SimModel> variants = makeVariants(static_cast<size_t>(state.range(0)));
+  if (variants.empty()) {
+    state.SkipWithError("Could not load isomodel/exampleModel.ISO");
+    return;
+  }
+  for (auto _ : state) {
+    // filling the batch is part of the cost of evaluating the variants
+    SimModelBatch batch(variants.front());
+    batch.reserve(variants.size());
+    for (const SimModel& variant : variants) {
+      batch.add(variant);
+    }
+    ISOBatchResults results = batch.simulate();
+    double total = 0.0;
+    for (size_t i = 0; i < results.size(); ++i) {
+      total += results.totalEnergyUse(i);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_SimModelBatch)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond);
@@ -28,6 +28,7 @@
 
 %{
   #include <measure/OSArgument.hpp>
+  #include <measure/OSArgumentBinding.hpp>
   #include <measure/OSOutput.hpp>
   #include <measure/OSRunner.hpp>
   #include <measure/OSMeasure.hpp>
@@ -65,6 +66,7 @@
 %feature("director") OSRunner;
 
 %include <measure/OSArgument.hpp>
+%include <measure/OSArgumentBinding.hpp>
 %include <measure/OSOutput.hpp>
 %include <measure/OSRunner.hpp>
 %include <measure/OSMeasure.hpp>
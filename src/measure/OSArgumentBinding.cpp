@@ -0,0 +1,162 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "OSArgumentBinding.hpp"
+
+#include <algorithm>
+
+namespace openstudio {
+namespace measure {
+
+OSArgumentBinding::Slot::Slot(const OSArgument& t_argument)
+  : argument(t_argument), hasValue(false), boolValue(false), doubleValue(0.0), integerValue(0)
+{
+  bool useDefault = !argument.hasValue();
+  if (useDefault && !argument.hasDefaultValue()) {
+    return;
+  }
+  hasValue = true;
+
+  switch (argument.type().value()) {
+    case OSArgumentType::Boolean :
+      boolValue = useDefault ? argument.defaultValueAsBool() : argument.valueAsBool();
+      break;
+    case OSArgumentType::Double :
+      doubleValue = useDefault ? argument.defaultValueAsDouble() : argument.valueAsDouble();
+      break;
+    case OSArgumentType::Integer :
+      integerValue = useDefault ? argument.defaultValueAsInteger() : argument.valueAsInteger();
+      doubleValue = integerValue;
+      break;
+    case OSArgumentType::Path :
+      pathValue = useDefault ? argument.defaultValueAsPath() : argument.valueAsPath();
+      break;
+    default:
+      break;
+  }
+  stringValue = useDefault ? argument.defaultValueAsString() : argument.valueAsString();
+}
+
+OSArgumentBinding::OSArgumentBinding()
+{
+}
+
+OSArgumentBinding::OSArgumentBinding(const std::map<std::string, OSArgument>& user_arguments)
+{
+  m_names.reserve(user_arguments.size());
+  m_slots.reserve(user_arguments.size());
+  for (const auto& p : user_arguments) {
+    m_names.push_back(p.first);
+    m_slots.push_back(Slot(p.second));
+  }
+}
+
+unsigned OSArgumentBinding::numSlots() const
+{
+  return m_slots.size();
+}
+
+boost::optional<unsigned> OSArgumentBinding::slot(const std::string& argument_name) const
+{
+  auto it = std::lower_bound(m_names.begin(), m_names.end(), argument_name);
+  if ((it != m_names.end()) && (*it == argument_name)) {
+    return unsigned(it - m_names.begin());
+  }
+  return boost::none;
+}
+
+const OSArgument& OSArgumentBinding::argument(unsigned slot) const
+{
+  if (slot >= m_slots.size()) {
+    LOG_AND_THROW("Slot " << slot << " is out of range, there are " << m_slots.size() << " bound arguments.");
+  }
+  return m_slots[slot].argument;
+}
+
+bool OSArgumentBinding::hasValue(unsigned slot) const
+{
+  return (slot < m_slots.size()) && m_slots[slot].hasValue;
+}
+
+bool OSArgumentBinding::boolValue(unsigned slot) const
+{
+  const Slot& s = checkedSlot(slot);
+  if (s.argument.type() != OSArgumentType::Boolean) {
+    LOG_AND_THROW("Argument " << s.argument.name() << " is of type " << s.argument.type().valueName() << ", not of type Bool.");
+  }
+  return s.boolValue;
+}
+
+double OSArgumentBinding::doubleValue(unsigned slot) const
+{
+  const Slot& s = checkedSlot(slot);
+  if ((s.argument.type() != OSArgumentType::Double) && (s.argument.type() != OSArgumentType::Integer)) {
+    LOG_AND_THROW("Argument " << s.argument.name() << " is of type " << s.argument.type().valueName() << ", not of type Double.");
+  }
+  return s.doubleValue;
+}
+
+int OSArgumentBinding::integerValue(unsigned slot) const
+{
+  const Slot& s = checkedSlot(slot);
+  if (s.argument.type() != OSArgumentType::Integer) {
+    LOG_AND_THROW("Argument " << s.argument.name() << " is of type " << s.argument.type().valueName() << ", not of type Integer.");
+  }
+  return s.integerValue;
+}
+
+const std::string& OSArgumentBinding::stringValue(unsigned slot) const
+{
+  return checkedSlot(slot).stringValue;
+}
+
+const openstudio::path& OSArgumentBinding::pathValue(unsigned slot) const
+{
+  const Slot& s = checkedSlot(slot);
+  if (s.argument.type() != OSArgumentType::Path) {
+    LOG_AND_THROW("Argument " << s.argument.name() << " is of type " << s.argument.type().valueName() << ", not of type Path.");
+  }
+  return s.pathValue;
+}
+
+const OSArgumentBinding::Slot& OSArgumentBinding::checkedSlot(unsigned slot) const
+{
+  if (slot >= m_slots.size()) {
+    LOG_AND_THROW("Slot " << slot << " is out of range, there are " << m_slots.size() << " bound arguments.");
+  }
+  const Slot& result = m_slots[slot];
+  if (!result.hasValue) {
+    LOG_AND_THROW("Argument " << result.argument.name() << " has no value.");
+  }
+  return result;
+}
+
+} // measure
+} // openstudio
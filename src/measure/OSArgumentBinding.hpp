@@ -0,0 +1,123 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef MEASURE_OSARGUMENTBINDING_HPP
+#define MEASURE_OSARGUMENTBINDING_HPP
+
+#include "MeasureAPI.hpp"
+
+#include "OSArgument.hpp"
+
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Path.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace measure {
+
+/** OSArgumentBinding resolves the value, or default value, of each user argument once. Measures
+ *  that read arguments many times can look up an argument's slot by name once and then read its
+ *  typed value by slot, without repeated map lookups or conversions. The binding holds copies of
+ *  the arguments, later changes to user_arguments are not reflected. */
+class MEASURE_API OSArgumentBinding {
+ public:
+  /** @name Constructors and Destructors */
+  //@{
+
+  OSArgumentBinding();
+
+  explicit OSArgumentBinding(const std::map<std::string, OSArgument>& user_arguments);
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  /** Returns the number of bound arguments. */
+  unsigned numSlots() const;
+
+  /** Returns the slot of the argument named argument_name, if it was bound. */
+  boost::optional<unsigned> slot(const std::string& argument_name) const;
+
+  /** Returns the argument bound to slot. Throws if slot is out of range. */
+  const OSArgument& argument(unsigned slot) const;
+
+  /** Returns true if the argument bound to slot has a value or a default value. */
+  bool hasValue(unsigned slot) const;
+
+  /** Returns the value, or default value, of a Boolean argument. Throws if there is no value or the
+   *  argument is of another type. */
+  bool boolValue(unsigned slot) const;
+
+  /** Returns the value, or default value, of a Double or Integer argument. Throws if there is no
+   *  value or the argument is of another type. */
+  double doubleValue(unsigned slot) const;
+
+  /** Returns the value, or default value, of an Integer argument. Throws if there is no value or
+   *  the argument is of another type. */
+  int integerValue(unsigned slot) const;
+
+  /** Returns the printed value, or default value, of an argument of any type. Throws if there is
+   *  no value. */
+  const std::string& stringValue(unsigned slot) const;
+
+  /** Returns the value, or default value, of a Path argument. Throws if there is no value or the
+   *  argument is of another type. */
+  const openstudio::path& pathValue(unsigned slot) const;
+
+  //@}
+ private:
+  REGISTER_LOGGER("openstudio.measure.OSArgumentBinding");
+
+  struct Slot {
+    explicit Slot(const OSArgument& t_argument);
+
+    OSArgument argument;
+    bool hasValue;
+    bool boolValue;
+    double doubleValue;
+    int integerValue;
+    std::string stringValue;
+    openstudio::path pathValue;
+  };
+
+  // throws if slot is out of range or has no value
+  const Slot& checkedSlot(unsigned slot) const;
+
+  std::vector<std::string> m_names; // sorted, parallel to m_slots
+  std::vector<Slot> m_slots;
+};
+
+} // measure
+} // openstudio
+
+#endif // MEASURE_OSARGUMENTBINDING_HPP
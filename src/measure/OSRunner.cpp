@@ -30,6 +30,7 @@
 #include "OSRunner.hpp"
 
 #include "OSArgument.hpp"
+#include "OSArgumentBinding.hpp"
 #include "OSMeasure.hpp"
 
 #include "../utilities/idf/Workspace.hpp"
@@ -40,6 +41,9 @@
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/PathHelpers.hpp"
+#include "../utilities/core/Tracing.hpp"
+
+#include <boost/algorithm/string/replace.hpp>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -76,6 +80,7 @@ std::string OSRunner::languagePreference() const
 }
 
 WorkflowStepResult OSRunner::result() const {
+  flushStepValues();
   return m_result;
 }
 
@@ -168,6 +173,7 @@ void OSRunner::reset()
   m_halted = false;
 
   m_result = WorkflowStepResult();
+  m_stepValueBuffer.clear();
 
   m_lastOpenStudioModel.reset();
   m_lastOpenStudioModelPath.reset();
@@ -180,6 +186,8 @@ void OSRunner::reset()
 
   m_currentDir.reset();
   m_currentDirFiles.clear();
+
+  m_stepTraceScope.reset();
 }
 
 bool OSRunner::incrementStep()
@@ -199,6 +207,8 @@ bool OSRunner::incrementStep()
     return false;
   }
 
+  flushStepValues();
+
   if (!m_result.stepResult()){
     // must have been skipped
     m_result.setStepResult(StepResult::Skip);
@@ -247,6 +257,9 @@ bool OSRunner::incrementStep()
   m_result = WorkflowStepResult();
   m_startedStep = false;
 
+  // records the trace event for this step
+  m_stepTraceScope.reset();
+
   return m_workflow.incrementStep();
 }
 
@@ -276,8 +289,13 @@ void OSRunner::prepareForMeasureRun(const OSMeasure& measure) {
 
   m_startedStep = true;
 
+  if (Tracer::enabled()) {
+    m_stepTraceScope = std::make_unique<TraceScope>("measure", measure.name());
+  }
+
   // create a new result
   m_result = WorkflowStepResult();
+  m_stepValueBuffer.clear();
   m_result.setStartedAt(DateTime::nowUTC());
   m_result.setStepResult(StepResult::Success);
 
@@ -329,7 +347,7 @@ void OSRunner::registerFinalCondition(const std::string& message) {
 
 void OSRunner::registerValue(const std::string& name, bool value) {
   WorkflowStepValue stepValue(cleanValueName(name),value);
-  m_result.addStepValue(stepValue);
+  addStepValue(stepValue);
 }
 
 void OSRunner::registerValue(const std::string& name,
@@ -338,18 +356,18 @@ void OSRunner::registerValue(const std::string& name,
 {
   WorkflowStepValue stepValue(cleanValueName(name),value);
   stepValue.setDisplayName(displayName);
-  m_result.addStepValue(stepValue);
+  addStepValue(stepValue);
 }
 
 void OSRunner::registerValue(const std::string& name, double value) {
   WorkflowStepValue stepValue(cleanValueName(name),value);
-  m_result.addStepValue(stepValue);
+  addStepValue(stepValue);
 }
 
 void OSRunner::registerValue(const std::string& name, double value, const std::string& units) {
   WorkflowStepValue stepValue(cleanValueName(name),value);
   stepValue.setUnits(units);
-  m_result.addStepValue(stepValue);
+  addStepValue(stepValue);
 }
 
 void OSRunner::registerValue(const std::string& name,
@@ -358,7 +376,7 @@ void OSRunner::registerValue(const std::string& name,
 {
   WorkflowStepValue stepValue(cleanValueName(name),value);
   stepValue.setDisplayName(displayName);
-  m_result.addStepValue(stepValue);
+  addStepValue(stepValue);
 }
 
 void OSRunner::registerValue(const std::string& name,
@@ -369,17 +387,18 @@ void OSRunner::registerValue(const std::string& name,
   WorkflowStepValue stepValue(cleanValueName(name),value);
   stepValue.setDisplayName(displayName);
   stepValue.setUnits(units);
-  m_result.addStepValue(stepValue);
+  addStepValue(stepValue);
 }
 
 void OSRunner::registerValue(const std::string& name, int value) {
   WorkflowStepValue stepValue(cleanValueName(name),value);
-  m_result.addStepValue(stepValue);}
+  addStepValue(stepValue);
+}
 
 void OSRunner::registerValue(const std::string& name, int value, const std::string& units) {
   WorkflowStepValue stepValue(cleanValueName(name),value);
   stepValue.setUnits(units);
-  m_result.addStepValue(stepValue);
+  addStepValue(stepValue);
 }
 
 void OSRunner::registerValue(const std::string& name,
@@ -388,7 +407,7 @@ void OSRunner::registerValue(const std::string& name,
 {
   WorkflowStepValue stepValue(cleanValueName(name),value);
   stepValue.setDisplayName(displayName);
-  m_result.addStepValue(stepValue);
+  addStepValue(stepValue);
 }
 
 void OSRunner::registerValue(const std::string& name,
@@ -399,12 +418,12 @@ void OSRunner::registerValue(const std::string& name,
   WorkflowStepValue stepValue(cleanValueName(name),value);
   stepValue.setDisplayName(displayName);
   stepValue.setUnits(units);
-  m_result.addStepValue(stepValue);
+  addStepValue(stepValue);
 }
 
 void OSRunner::registerValue(const std::string& name, const std::string& value) {
   WorkflowStepValue stepValue(cleanValueName(name),value);
-  m_result.addStepValue(stepValue);
+  addStepValue(stepValue);
 }
 
 void OSRunner::registerValue(const std::string& name,
@@ -413,7 +432,25 @@ void OSRunner::registerValue(const std::string& name,
 {
   WorkflowStepValue stepValue(cleanValueName(name),value);
   stepValue.setDisplayName(displayName);
-  m_result.addStepValue(stepValue);
+  addStepValue(stepValue);
+}
+
+void OSRunner::registerValues(const std::vector<WorkflowStepValue>& values)
+{
+  m_stepValueBuffer.reserve(m_stepValueBuffer.size() + values.size());
+  for (const WorkflowStepValue& value : values) {
+    // values share their impl with the caller, copy rather than renaming in place
+    std::string name = value.name();
+    WorkflowStepValue stepValue(cleanValueName(name), value.valueAsVariant());
+    std::string displayName = value.displayName();
+    if (displayName != name) {
+      stepValue.setDisplayName(displayName);
+    }
+    if (boost::optional<std::string> units = value.units()) {
+      stepValue.setUnits(*units);
+    }
+    m_stepValueBuffer.push_back(stepValue);
+  }
 }
 
 void OSRunner::haltWorkflow(const std::string& completedStatus)
@@ -617,7 +654,7 @@ bool OSRunner::validateUserArguments(const std::vector<OSArgument>& script_argum
 
   if (result) {
     for (const auto& stepValue : stepValues) {
-      m_result.addStepValue(stepValue);
+      addStepValue(stepValue);
     }
   }
 
@@ -812,6 +849,25 @@ boost::optional<openstudio::path> OSRunner::getOptionalPathArgumentValue(
   return boost::none;
 }
 
+unsigned OSRunner::getArgumentSlot(const std::string& argument_name,
+                                   const OSArgumentBinding& binding)
+{
+  std::stringstream ss;
+
+  boost::optional<unsigned> slot = binding.slot(argument_name);
+  if (slot && binding.hasValue(*slot)) {
+    return *slot;
+  }
+
+  ss << "No value found for argument '" << argument_name << "'.";
+  if (slot) {
+    ss << " Full argument as passed in by user:" << std::endl << binding.argument(*slot);
+  }
+  registerError(ss.str());
+  LOG_AND_THROW(ss.str());
+  return 0;
+}
+
 boost::optional<openstudio::WorkspaceObject> OSRunner::getOptionalWorkspaceObjectChoiceValue(
   const std::string& argument_name,
   const std::map<std::string,OSArgument>& user_arguments,
@@ -947,22 +1003,87 @@ void OSRunner::resetLanguagePreference()
 
 std::string OSRunner::cleanValueName(const std::string& name) const
 {
-  static const boost::regex allowableCharacters("[^0-9a-zA-Z]");
-  static const boost::regex leadingUnderscore("^_+");
-  static const boost::regex trailingUnderscore("_+$");
-  static const boost::regex leadingNumber("^([0-9])");
-  static const boost::regex multipleUnderscore("[_]+");
+  // equivalent to replacing [^0-9a-zA-Z] with underscores, trimming and collapsing underscores,
+  // prefixing a leading number with an underscore and then calling toUnderscoreCase, but without
+  // regexes since measures may register many values
+
+  auto isUpper = [](char c) { return (c >= 'A') && (c <= 'Z'); };
+  auto isLower = [](char c) { return (c >= 'a') && (c <= 'z'); };
+  auto isDigit = [](char c) { return (c >= '0') && (c <= '9'); };
+  auto isAlpha = [&](char c) { return isUpper(c) || isLower(c); };
+
+  // replace disallowed characters with single underscores, trim underscores, prefix a leading number
+  std::string cleaned;
+  cleaned.reserve(name.size() + 1);
+  for (char c : name) {
+    if (isAlpha(c) || isDigit(c)) {
+      cleaned.push_back(c);
+    } else if (!cleaned.empty() && (cleaned.back() != '_')) {
+      cleaned.push_back('_');
+    }
+  }
+  if (!cleaned.empty() && (cleaned.back() == '_')) {
+    cleaned.pop_back();
+  }
+  if (!cleaned.empty() && isDigit(cleaned.front())) {
+    cleaned.insert(cleaned.begin(), '_');
+  }
 
+  // toUnderscoreCase, underscores are already single so they pass through unchanged
+  boost::replace_all(cleaned, "OpenStudio", "Openstudio");
+  boost::replace_all(cleaned, "EnergyPlus", "Energyplus");
+
+  // split letters from numbers
+  std::string split;
+  split.reserve(2 * cleaned.size());
+  for (size_t i = 0; i < cleaned.size(); ++i) {
+    if ((i > 0) && ((isAlpha(cleaned[i - 1]) && isDigit(cleaned[i])) || (isDigit(cleaned[i - 1]) && isAlpha(cleaned[i])))) {
+      split.push_back('_');
+    }
+    split.push_back(cleaned[i]);
+  }
+
+  // split acronyms from following words, e.g. HVACSystem to HVAC_System
+  std::string acronyms;
+  acronyms.reserve(2 * split.size());
+  for (size_t i = 0; i < split.size(); ++i) {
+    if ((i > 1) && isUpper(split[i - 2]) && isUpper(split[i - 1]) && isLower(split[i])) {
+      char last = acronyms.back();
+      acronyms.back() = '_';
+      acronyms.push_back(last);
+    }
+    acronyms.push_back(split[i]);
+  }
 
-  std::string result = boost::regex_replace(name, allowableCharacters, "_");
-  result = boost::regex_replace(result, leadingUnderscore, "");
-  result = boost::regex_replace(result, trailingUnderscore, "");
-  result = boost::regex_replace(result, leadingNumber, "_$1");
-  result = boost::regex_replace(result, multipleUnderscore, "_");
-  result = toUnderscoreCase(result);
+  // split camel case words and convert to lower case
+  std::string result;
+  result.reserve(2 * acronyms.size());
+  for (size_t i = 0; i < acronyms.size(); ++i) {
+    char c = acronyms[i];
+    if (isUpper(c)) {
+      if ((i > 0) && isLower(acronyms[i - 1])) {
+        result.push_back('_');
+      }
+      c = char(c - 'A' + 'a');
+    }
+    result.push_back(c);
+  }
   return result;
 }
 
+void OSRunner::addStepValue(const WorkflowStepValue& value)
+{
+  m_stepValueBuffer.push_back(value);
+}
+
+void OSRunner::flushStepValues() const
+{
+  if (!m_stepValueBuffer.empty()) {
+    m_result.addStepValues(m_stepValueBuffer);
+    m_stepValueBuffer.clear();
+  }
+}
+
 void OSRunner::captureStreams()
 {
   if (m_streamsCaptured){
@@ -41,8 +41,11 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 #include "../utilities/core/Logger.hpp"
 
+#include <memory>
+
 namespace openstudio {
 
+class TraceScope;
 class Workspace;
 class WorkspaceObject;
 
@@ -53,6 +56,7 @@ namespace model {
 namespace measure {
 
 class OSArgument;
+class OSArgumentBinding;
 class OSMeasure;
 
 /** OSRunner is a concrete base class for application-specific classes that run \link OSMeasure
@@ -79,7 +83,8 @@ class MEASURE_API OSRunner {
   /** Returns preferred language, e.g. 'en' or 'fr'. New in OS 2.0. */
   std::string languagePreference() const;
 
-  /** Returns the result for the current/last OSMeasure run by this OSRunner. (prepareForMeasureRun
+  /** Returns the result for the current/last OSMeasure run by this OSRunner. Any buffered values
+   *  are added to the result first. (prepareForMeasureRun
    *  should be called prior to each run to ensure that result() corresponds to a single script, and
    *  is not instead a running result over multiple scripts. One way to ensure that this happens is
    *  to call the default version of run in ModelMeasure, etc. at the beginning of any particular
@@ -189,6 +194,10 @@ class MEASURE_API OSRunner {
                              const std::string& displayName,
                              const std::string& value);
 
+  /** Registers many values at once, names are cleaned as in registerValue. Registered values are
+   *  buffered and added to the result together when the step completes or result() is called. */
+  virtual void registerValues(const std::vector<WorkflowStepValue>& values);
+
   /** Halts the simulation with the provided completed status, does not set the current measure's step result.
    *  Measure writers can call this with "Success" if all required results have been generated.
    *  Measure writers should not call this with "Fail", runner.registerError should be used instead.
@@ -270,6 +279,12 @@ class MEASURE_API OSRunner {
       const std::string& argument_name,
       const std::map<std::string,OSArgument>& user_arguments);
 
+  /** Call this method to find the slot of an OSArgument in binding that is either required or has
+   *  a default. Values can then be read from binding by slot without further lookups by name.
+   *  Registers an error and throws if the argument has no value. */
+  unsigned getArgumentSlot(const std::string& argument_name,
+                           const OSArgumentBinding& binding);
+
   /** Call this method to retrieve the value of an OSArgument that was created by
    *  makeChoiceArgumentOfWorkspaceObjects. */
   boost::optional<openstudio::WorkspaceObject> getOptionalWorkspaceObjectChoiceValue(
@@ -325,6 +340,12 @@ class MEASURE_API OSRunner {
 
   std::string cleanValueName(const std::string& name) const;
 
+  // buffers a value for m_result
+  void addStepValue(const WorkflowStepValue& value);
+
+  // adds buffered values to m_result
+  void flushStepValues() const;
+
   void captureStreams();
   void restoreStreams();
 
@@ -336,8 +357,9 @@ class MEASURE_API OSRunner {
 
   bool m_halted;
 
-  // current data
-  WorkflowStepResult m_result;
+  // current data, registered values are buffered until the result is needed
+  mutable WorkflowStepResult m_result;
+  mutable std::vector<WorkflowStepValue> m_stepValueBuffer;
 
   mutable boost::optional<openstudio::model::Model> m_lastOpenStudioModel;
   boost::optional<openstudio::path> m_lastOpenStudioModelPath;
@@ -355,6 +377,9 @@ class MEASURE_API OSRunner {
 
   boost::optional<openstudio::path> m_currentDir;
   std::set<openstudio::path> m_currentDirFiles;
+
+  // traces the current step from prepareForMeasureRun to incrementStep
+  std::unique_ptr<TraceScope> m_stepTraceScope;
 };
 
 } // measure
@@ -31,6 +31,7 @@
 #include "MeasureFixture.hpp"
 
 #include "../OSRunner.hpp"
+#include "../OSArgumentBinding.hpp"
 #include "../OSMeasure.hpp"
 #include "../ModelMeasure.hpp"
 
@@ -96,3 +97,94 @@ TEST_F(MeasureFixture, OSRunner_StdOut) {
   ASSERT_TRUE(step.result()->stdErr());
   EXPECT_EQ("Standard Error\n", step.result()->stdErr().get());
 }
+
+TEST_F(MeasureFixture, OSRunner_RegisterValues) {
+
+  MeasureStep step("TestModelMeasure");
+
+  std::vector<WorkflowStep> steps;
+  steps.push_back(step);
+
+  WorkflowJSON workflow;
+  workflow.setWorkflowSteps(steps);
+
+  OSRunner runner(workflow);
+
+  TestModelMeasure measure;
+  runner.prepareForMeasureRun(measure);
+
+  runner.registerValue("Total Site Energy (kBtu)", 1.0, "kBtu");
+  runner.registerValue("OpenStudio HVACSystem2Count", 3);
+
+  std::vector<WorkflowStepValue> values;
+  values.push_back(WorkflowStepValue("Total Site Energy (kBtu)", 2.0));
+  values.push_back(WorkflowStepValue("name", "first"));
+  WorkflowStepValue named("name", "second");
+  named.setDisplayName("Display Name");
+  values.push_back(named);
+  runner.registerValues(values);
+
+  // the caller's values are not renamed
+  EXPECT_EQ("Total Site Energy (kBtu)", values[0].name());
+
+  std::vector<WorkflowStepValue> stepValues = runner.result().stepValues();
+  ASSERT_EQ(3u, stepValues.size());
+  EXPECT_EQ("openstudio_hvac_system_2_count", stepValues[0].name());
+  EXPECT_EQ(3, stepValues[0].valueAsInteger());
+  EXPECT_EQ("total_site_energy_k_btu", stepValues[1].name());
+  EXPECT_EQ(2.0, stepValues[1].valueAsDouble());
+  EXPECT_FALSE(stepValues[1].units());
+  EXPECT_EQ("name", stepValues[2].name());
+  EXPECT_EQ("second", stepValues[2].valueAsString());
+  EXPECT_EQ("Display Name", stepValues[2].displayName());
+
+  runner.registerValue("late", true);
+  runner.incrementStep();
+
+  ASSERT_TRUE(step.result());
+  stepValues = step.result()->stepValues();
+  ASSERT_EQ(4u, stepValues.size());
+  EXPECT_EQ("late", stepValues[3].name());
+}
+
+TEST_F(MeasureFixture, OSRunner_ArgumentBinding) {
+
+  WorkflowJSON workflow;
+  OSRunner runner(workflow);
+
+  std::vector<OSArgument> arguments;
+  OSArgument doubleArgument = OSArgument::makeDoubleArgument("double");
+  doubleArgument.setDefaultValue(1.5);
+  arguments.push_back(doubleArgument);
+  OSArgument integerArgument = OSArgument::makeIntegerArgument("integer");
+  integerArgument.setValue(3);
+  arguments.push_back(integerArgument);
+  OSArgument boolArgument = OSArgument::makeBoolArgument("bool", false);
+  arguments.push_back(boolArgument);
+  OSArgument pathArgument = OSArgument::makePathArgument("path", true, "csv");
+  pathArgument.setValue(toPath("file.csv"));
+  arguments.push_back(pathArgument);
+
+  OSArgumentBinding binding(convertOSArgumentVectorToMap(arguments));
+  EXPECT_EQ(4u, binding.numSlots());
+  EXPECT_FALSE(binding.slot("missing"));
+
+  unsigned doubleSlot = runner.getArgumentSlot("double", binding);
+  EXPECT_EQ(1.5, binding.doubleValue(doubleSlot));
+  EXPECT_EQ("1.5", binding.stringValue(doubleSlot));
+  EXPECT_THROW(binding.integerValue(doubleSlot), std::exception);
+
+  unsigned integerSlot = runner.getArgumentSlot("integer", binding);
+  EXPECT_EQ(3, binding.integerValue(integerSlot));
+  EXPECT_EQ(3.0, binding.doubleValue(integerSlot));
+
+  unsigned pathSlot = runner.getArgumentSlot("path", binding);
+  EXPECT_EQ(toPath("file.csv"), binding.pathValue(pathSlot));
+
+  ASSERT_TRUE(binding.slot("bool"));
+  EXPECT_FALSE(binding.hasValue(*binding.slot("bool")));
+  EXPECT_THROW(binding.boolValue(*binding.slot("bool")), std::exception);
+  EXPECT_THROW(runner.getArgumentSlot("bool", binding), std::exception);
+  EXPECT_THROW(runner.getArgumentSlot("missing", binding), std::exception);
+  EXPECT_EQ(2u, runner.result().stepErrors().size());
+}
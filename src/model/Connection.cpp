@@ -29,6 +29,7 @@
 
 #include "Connection.hpp"
 #include "Connection_Impl.hpp"
+#include "Model_Impl.hpp"
 #include "ModelObject.hpp"
 
 #include "../utilities/core/Assert.hpp"
@@ -79,6 +80,17 @@ namespace detail {
     return Connection::iddObjectType();
   }
 
+  bool Connection_Impl::setString(unsigned index, const std::string& value, bool checkValidity)
+  {
+    bool result = ModelObject_Impl::setString(index, value, checkValidity);
+    if( result && initialized() &&
+        ((index == OS_ConnectionFields::OutletPort) || (index == OS_ConnectionFields::InletPort)) )
+    {
+      workspaceImpl()->registerRelationshipChange();
+    }
+    return result;
+  }
+
   boost::optional<ModelObject>  Connection_Impl::sourceObject() const
   {
     if ( boost::optional<WorkspaceObject> oCandidate = getTarget(openstudio::OS_ConnectionFields::SourceObject) )
@@ -54,6 +54,12 @@ namespace detail {
 
     virtual IddObjectType iddObjectType() const override;
 
+    using ModelObject_Impl::setString;
+
+    /** Port fields are plain data but define the connection graph, so changing them is registered
+     *  as a relationship change. */
+    virtual bool setString(unsigned index, const std::string& value, bool checkValidity) override;
+
     boost::optional<ModelObject> sourceObject() const;
 
     boost::optional<unsigned> sourceObjectPort() const;
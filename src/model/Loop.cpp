@@ -50,6 +50,7 @@
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
@@ -61,12 +62,16 @@ namespace model {
 
 namespace detail {
   Loop_Impl::Loop_Impl(IddObjectType type, Model_Impl* model)
-    : ParentObject_Impl(type,model)
+    : ParentObject_Impl(type,model),
+      m_topologyCached(false),
+      m_topologyRevision(0)
   {
   }
 
   Loop_Impl::Loop_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
-    : ParentObject_Impl(idfObject, model, keepHandle)
+    : ParentObject_Impl(idfObject, model, keepHandle),
+      m_topologyCached(false),
+      m_topologyRevision(0)
   {
   }
 
@@ -74,14 +79,18 @@ namespace detail {
       const openstudio::detail::WorkspaceObject_Impl& other,
       Model_Impl* model,
       bool keepHandle)
-    : ParentObject_Impl(other,model,keepHandle)
+    : ParentObject_Impl(other,model,keepHandle),
+      m_topologyCached(false),
+      m_topologyRevision(0)
   {
   }
 
   Loop_Impl::Loop_Impl(const Loop_Impl& other,
       Model_Impl* model,
       bool keepHandles)
-    : ParentObject_Impl(other,model,keepHandles)
+    : ParentObject_Impl(other,model,keepHandles),
+      m_topologyCached(false),
+      m_topologyRevision(0)
   {
   }
 
@@ -155,26 +164,24 @@ namespace detail {
 
   boost::optional<ModelObject> Loop_Impl::demandComponent(openstudio::Handle handle) const
   {
-    auto comps = demandComponents();
+    updateTopologyCache();
 
-    auto it = std::find_if(comps.begin(), comps.end(), [&](const ModelObject & comp) {return (comp.handle() == handle);});
-    if ( it != comps.end() ) {
-      return *it;
+    if( m_demandComponentIndex.find(handle) == m_demandComponentIndex.end() ) {
+      return boost::none;
     }
 
-    return boost::none;
+    return model().getModelObject<ModelObject>(handle);
   }
 
   boost::optional<ModelObject> Loop_Impl::supplyComponent(openstudio::Handle handle) const
   {
-    auto comps = supplyComponents();
+    updateTopologyCache();
 
-    auto it = std::find_if(comps.begin(), comps.end(), [&](const ModelObject & comp) {return (comp.handle() == handle);});
-    if ( it != comps.end() ) {
-      return *it;
+    if( m_supplyComponentIndex.find(handle) == m_supplyComponentIndex.end() ) {
+      return boost::none;
     }
 
-    return boost::none;
+    return model().getModelObject<ModelObject>(handle);
   }
 
   ModelObject Loop_Impl::clone(Model model) const
@@ -319,7 +326,7 @@ namespace detail {
     std::set<T> s_;
   };
 
-  std::vector<ModelObject> Loop_Impl::supplyComponents(openstudio::IddObjectType type) const
+  std::vector<ModelObject> Loop_Impl::computeSupplyComponents() const
   {
     std::vector<ModelObject> result;
 
@@ -329,7 +336,7 @@ namespace detail {
     for( auto const & t_supplyOutletNode : t_supplyOutletNodes ) {
       auto components = supplyComponents( t_supplyInletNode,
                                           t_supplyOutletNode,
-                                          type );
+                                          IddObjectType::Catchall );
       result.insert(result.end(),components.begin(),components.end());
     }
 
@@ -343,7 +350,7 @@ namespace detail {
     }
   }
 
-  std::vector<ModelObject> Loop_Impl::demandComponents(openstudio::IddObjectType type) const
+  std::vector<ModelObject> Loop_Impl::computeDemandComponents() const
   {
     std::vector<ModelObject> result;
 
@@ -353,7 +360,7 @@ namespace detail {
     for( auto const & t_demandInletNode : t_demandInletNodes ) {
       auto components = demandComponents( t_demandInletNode,
                                           t_demandOutletNode,
-                                          type );
+                                          IddObjectType::Catchall );
       result.insert(result.end(),components.begin(),components.end());
     }
 
@@ -367,6 +374,61 @@ namespace detail {
     }
   }
 
+  void Loop_Impl::updateTopologyCache() const
+  {
+    unsigned revision = model().getImpl<Model_Impl>()->relationshipRevision();
+    if( m_topologyCached && (m_topologyRevision == revision) ) {
+      return;
+    }
+
+    m_supplyComponentHandles.clear();
+    m_supplyComponentIndex.clear();
+    for( const auto & comp : computeSupplyComponents() ) {
+      m_supplyComponentIndex.insert(std::make_pair(comp.handle(), m_supplyComponentHandles.size()));
+      m_supplyComponentHandles.push_back(comp.handle());
+    }
+
+    m_demandComponentHandles.clear();
+    m_demandComponentIndex.clear();
+    for( const auto & comp : computeDemandComponents() ) {
+      m_demandComponentIndex.insert(std::make_pair(comp.handle(), m_demandComponentHandles.size()));
+      m_demandComponentHandles.push_back(comp.handle());
+    }
+
+    // traversal does not modify relationships, so the revision read above is still current
+    m_topologyRevision = revision;
+    m_topologyCached = true;
+  }
+
+  std::vector<ModelObject> Loop_Impl::cachedComponents(const std::vector<Handle>& handles, openstudio::IddObjectType type) const
+  {
+    std::vector<ModelObject> result;
+    result.reserve(handles.size());
+
+    Model t_model = model();
+    for( const auto & handle : handles ) {
+      boost::optional<ModelObject> comp = t_model.getModelObject<ModelObject>(handle);
+      OS_ASSERT(comp);
+      if( (type == IddObjectType::Catchall) || (type == comp->iddObject().type()) ) {
+        result.push_back(*comp);
+      }
+    }
+
+    return result;
+  }
+
+  std::vector<ModelObject> Loop_Impl::supplyComponents(openstudio::IddObjectType type) const
+  {
+    updateTopologyCache();
+    return cachedComponents(m_supplyComponentHandles, type);
+  }
+
+  std::vector<ModelObject> Loop_Impl::demandComponents(openstudio::IddObjectType type) const
+  {
+    updateTopologyCache();
+    return cachedComponents(m_demandComponentHandles, type);
+  }
+
   std::vector<ModelObject> Loop_Impl::components(openstudio::IddObjectType type)
   {
     std::vector<ModelObject> result;
@@ -32,6 +32,10 @@
 
 #include "ParentObject_Impl.hpp"
 
+#include <boost/functional/hash.hpp>
+
+#include <unordered_map>
+
 namespace openstudio {
 
 namespace model {
@@ -135,6 +139,26 @@ namespace detail {
 
     REGISTER_LOGGER("openstudio.model.Loop");
 
+    // Rebuilds the cached supply and demand component lists if the model's relationship revision has
+    // changed since they were last computed. Only handles are cached, loop components hold a
+    // reference back to the loop and storing ModelObjects here would keep both alive.
+    void updateTopologyCache() const;
+
+    std::vector<ModelObject> cachedComponents(const std::vector<Handle>& handles, openstudio::IddObjectType type) const;
+
+    std::vector<ModelObject> computeSupplyComponents() const;
+
+    std::vector<ModelObject> computeDemandComponents() const;
+
+    typedef std::unordered_map<Handle, size_t, boost::hash<boost::uuids::uuid> > ComponentIndex;
+
+    mutable bool m_topologyCached;
+    mutable unsigned m_topologyRevision;
+    mutable std::vector<Handle> m_supplyComponentHandles;
+    mutable std::vector<Handle> m_demandComponentHandles;
+    mutable ComponentIndex m_supplyComponentIndex;
+    mutable ComponentIndex m_demandComponentIndex;
+
     // TODO: Make these const.
     boost::optional<ModelObject> supplyInletNodeAsModelObject();
     boost::optional<ModelObject> supplyOutletNodeAsModelObject();
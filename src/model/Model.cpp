@@ -44,6 +44,7 @@
 
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/OS_Version_FieldEnums.hxx>
+#include <utilities/idd/OS_Connection_FieldEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/PathHelpers.hpp"
@@ -76,13 +77,15 @@ namespace detail {
 
   // default constructor
   Model_Impl::Model_Impl()
-    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio)
+    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio),
+      m_portIndexPruneSize(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
   }
 
   Model_Impl::Model_Impl(const IdfFile& idfFile)
-    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft))
+    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft)),
+      m_portIndexPruneSize(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
     if (iddFileType() != IddFileType::OpenStudio) {
@@ -94,7 +97,8 @@ namespace detail {
 
   Model_Impl::Model_Impl(const openstudio::detail::Workspace_Impl& workspace,
                          bool keepHandles)
-    : openstudio::detail::Workspace_Impl(workspace,keepHandles)
+    : openstudio::detail::Workspace_Impl(workspace,keepHandles),
+      m_portIndexPruneSize(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
     if (iddFileType() != IddFileType::OpenStudio) {
@@ -108,7 +112,8 @@ namespace detail {
   Model_Impl::Model_Impl(const Model_Impl& other, bool keepHandles)
     : Workspace_Impl(other, keepHandles),
       m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
-      m_workflowJSON(WorkflowJSON(other.m_workflowJSON))
+      m_workflowJSON(WorkflowJSON(other.m_workflowJSON)),
+      m_portIndexPruneSize(0)
   {
     // notice we are cloning the workflow and sqlfile too, if necessary
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
@@ -121,7 +126,8 @@ namespace detail {
                          StrictnessLevel level)
     : Workspace_Impl(other,hs,keepHandles,level),
       m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
-      m_workflowJSON(WorkflowJSON(other.m_workflowJSON))
+      m_workflowJSON(WorkflowJSON(other.m_workflowJSON)),
+      m_portIndexPruneSize(0)
   {
     // notice we are cloning the workflow and sqlfile too, if necessary
   }
@@ -864,6 +870,59 @@ namespace detail {
     targetObject.setPointer(targetPort,c.handle());
   }
 
+  Model_Impl::ConnectedPort Model_Impl::connectedPort(const Handle& handle, unsigned port) const
+  {
+    unsigned revision = relationshipRevision();
+    PortKey key(handle, port);
+
+    auto it = m_portIndex.find(key);
+    if( (it != m_portIndex.end()) && (it->second.revision == revision) ) {
+      return it->second.connectedPort;
+    }
+
+    ConnectedPort result;
+    boost::optional<WorkspaceObject> target;
+    if( boost::optional<WorkspaceObject> object = getObject(handle) ) {
+      target = object->getTarget(port);
+    }
+    if( target ) {
+      if( boost::optional<Connection> connection = target->optionalCast<Connection>() ) {
+        boost::optional<ModelObject> sourceObject = connection->sourceObject();
+        boost::optional<ModelObject> targetObject = connection->targetObject();
+        if( sourceObject && (sourceObject->handle() == handle) ) {
+          if( targetObject ) {
+            result.object = targetObject->handle();
+          }
+          result.port = connection->getUnsigned(OS_ConnectionFields::InletPort);
+        } else if( targetObject && (targetObject->handle() == handle) ) {
+          if( sourceObject ) {
+            result.object = sourceObject->handle();
+          }
+          result.port = connection->getUnsigned(OS_ConnectionFields::OutletPort);
+        }
+      }
+    }
+
+    if( it != m_portIndex.end() ) {
+      it->second.revision = revision;
+      it->second.connectedPort = result;
+    } else {
+      if( m_portIndex.size() >= 2 * m_portIndexPruneSize + 1024 ) {
+        for( auto entry = m_portIndex.begin(); entry != m_portIndex.end(); ) {
+          if( entry->second.revision == revision ) {
+            ++entry;
+          } else {
+            entry = m_portIndex.erase(entry);
+          }
+        }
+        m_portIndexPruneSize = m_portIndex.size();
+      }
+      m_portIndex.insert(std::make_pair(key, PortIndexEntry{revision, result}));
+    }
+
+    return result;
+  }
+
   void Model_Impl::disconnect(ModelObject object,
                               unsigned port)
   {
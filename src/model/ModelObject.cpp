@@ -316,26 +316,8 @@ namespace detail {
       return result;
     }
 
-    // Query the Intialization Summary -> Component Sizing table to get
-    // the row names that contains information for this component.
-    std::stringstream rowsQuery;
-    rowsQuery << "SELECT RowName ";
-    rowsQuery << "FROM tabulardatawithstrings ";
-    rowsQuery << "WHERE ReportName='Initialization Summary' ";
-    rowsQuery << "AND ReportForString='Entire Facility' ";
-    rowsQuery << "AND TableName = 'Component Sizing Information' ";
-    rowsQuery << "AND Value='" + sqlName + "'";
-
-    boost::optional<std::vector<std::string>> rowNames = model().sqlFile().get().execAndReturnVectorOfString(rowsQuery.str());
-
-    // Warn if the query failed
-    if (!rowNames) {
-      LOG(Warn, "Could not find a component called '" + sqlName + "' in any rows of the Initialization Summary Component Sizing table.");
-      return result;
-    }
-
-    // Query each row of the Intialization Summary -> Component Sizing table
-    // that contains this component to get the desired value.
+    // Look up the value in the Intialization Summary -> Component Sizing table,
+    // the table is read and indexed by the sql file on first use
     std::string valueNameAndUnits = valueName + std::string(" [") + units + std::string("]");
     if (units == "") {
       valueNameAndUnits = valueName;
@@ -343,37 +325,7 @@ namespace detail {
       valueNameAndUnits = valueName + std::string(" []");
     }
 
-    for (std::string rowName : rowNames.get()) {
-      std::stringstream rowCheckQuery;
-      rowCheckQuery << "SELECT Value ";
-      rowCheckQuery << "FROM tabulardatawithstrings ";
-      rowCheckQuery << "WHERE ReportName='Initialization Summary' ";
-      rowCheckQuery << "AND ReportForString='Entire Facility' ";
-      rowCheckQuery << "AND TableName = 'Component Sizing Information' ";
-      rowCheckQuery << "AND RowName='" << rowName << "' ";
-      rowCheckQuery << "AND Value='" << valueNameAndUnits << "'";
-      boost::optional<std::string> rowValueName = model().sqlFile().get().execAndReturnFirstString(rowCheckQuery.str());
-      // Check if the query succeeded
-      if (!rowValueName) {
-        continue;
-      }
-      // This is the right row
-      std::stringstream valQuery;
-      valQuery << "SELECT Value ";
-      valQuery << "FROM tabulardatawithstrings ";
-      valQuery << "WHERE ReportName='Initialization Summary' ";
-      valQuery << "AND ReportForString='Entire Facility' ";
-      valQuery << "AND TableName = 'Component Sizing Information' ";
-      valQuery << "AND ColumnName='Value' ";
-      valQuery << "AND RowName='" << rowName << "' ";
-      boost::optional<double> val = model().sqlFile().get().execAndReturnFirstDouble(valQuery.str());
-      // Check if the query succeeded
-      if (val) {
-        result = val.get();
-        break;
-      }
-    }
-
+    result = model().sqlFile()->componentSizingValue(sqlName, valueNameAndUnits);
 
     if (!result) {
       LOG(Debug, "The autosized value query for " + valueNameAndUnits + " of " + sqlName + " returned no value.");
@@ -514,20 +466,16 @@ namespace detail {
 
   boost::optional<ModelObject> ModelObject_Impl::connectedObject(unsigned port) const
   {
-    OptionalWorkspaceObject wo = this->getTarget(port);
-    if ( wo ) {
-
-      Connection connection = wo->cast<Connection>();
+    if( !initialized() ) {
+      return boost::none;
+    }
 
-      boost::optional<ModelObject> targetObject = connection.targetObject();
-      boost::optional<ModelObject> sourceObject = connection.sourceObject();
-      if( sourceObject && targetObject ) {
-        if( sourceObject->handle() == this->handle() ){
-          return targetObject;
-        }
-        if( targetObject->handle() == this->handle() ){
-          return sourceObject;
-        }
+    // model objects always live in a Model
+    const Model_Impl* modelImpl = static_cast<const Model_Impl*>(workspaceImpl());
+    Model_Impl::ConnectedPort connected = modelImpl->connectedPort(handle(), port);
+    if( connected.object ) {
+      if( OptionalWorkspaceObject wo = modelImpl->getObject(*connected.object) ) {
+        return wo->optionalCast<ModelObject>();
       }
     }
     return boost::optional<ModelObject>();
@@ -535,23 +483,12 @@ namespace detail {
 
   boost::optional<unsigned> ModelObject_Impl::connectedObjectPort(unsigned port) const
   {
-    OptionalWorkspaceObject wo = this->getTarget(port);
-    if(wo)
-    {
-      Connection connection = wo->cast<Connection>();
-
-      if( boost::optional<ModelObject> sourceObject = connection.sourceObject() ) {
-        if( sourceObject->handle() == this->handle() ){
-          return connection.targetObjectPort();
-        }
-      }
-      if( boost::optional<ModelObject> targetObject = connection.targetObject() ) {
-        if( targetObject->handle() == this->handle() ){
-          return connection.sourceObjectPort();
-        }
-      }
+    if( !initialized() ) {
+      return boost::none;
     }
-    return boost::optional<unsigned>();
+
+    const Model_Impl* modelImpl = static_cast<const Model_Impl*>(workspaceImpl());
+    return modelImpl->connectedPort(handle(), port).port;
   }
 
   ModelObject ModelObject_Impl::clone(Model model) const
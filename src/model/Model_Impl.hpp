@@ -49,7 +49,9 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 
 #include <boost/optional.hpp>
+#include <boost/functional/hash.hpp>
 
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio {
@@ -263,6 +265,18 @@ namespace detail {
 
     void disconnect(ModelObject object, unsigned port);
 
+    /** The object and port at the other end of a Connection. Either may be missing if the Connection
+     *  is incomplete. */
+    struct ConnectedPort {
+      boost::optional<Handle> object;
+      boost::optional<unsigned> port;
+    };
+
+    /** Returns what is connected to port of the object with handle. Results are kept in a port index
+     *  validated against relationshipRevision(), so traversing loops that have not changed does not
+     *  resolve Connection objects again. */
+    ConnectedPort connectedPort(const Handle& handle, unsigned port) const;
+
     //@}
     /** @name Nano Signals */
     //@{
@@ -315,6 +329,18 @@ namespace detail {
     mutable boost::optional<YearDescription> m_cachedYearDescription;
     mutable boost::optional<WeatherFile> m_cachedWeatherFile;
 
+    struct PortIndexEntry {
+      unsigned revision;
+      ConnectedPort connectedPort;
+    };
+
+    typedef std::pair<Handle, unsigned> PortKey;
+    typedef std::unordered_map<PortKey, PortIndexEntry, boost::hash<PortKey> > PortIndex;
+
+    // entries from older revisions are overwritten on lookup and pruned when the index doubles in size
+    mutable PortIndex m_portIndex;
+    mutable size_t m_portIndexPruneSize;
+
   // private slots:
     void clearCachedData();
     void clearCachedBuilding(const Handle& handle);
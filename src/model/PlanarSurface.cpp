@@ -173,41 +173,20 @@ namespace model {
 
       LOG(Debug, "Before setVertices have " << numFields() << " fields.");
 
-      clearExtensibleGroups(false);
-
-      LOG(Debug, "After clearExtensibleGroups in setVertices have " << numFields() << " fields.");
-
-      // set the vertices
-      // bool nonPlanarPointFound = false;
-      for (unsigned vertexIndex = 0; vertexIndex < n; ++vertexIndex) {
-
-        // DLM: fitting points to plane here as well as in SketchUp was resulting in unacceptable rounding errors
-        // just use point directly
-        Point3d vertex = vertices[vertexIndex];
-
-        // project point to plane
-        //Point3d vertex = plane->project(vertices[vertexIndex]);
-        //LOG(Debug, "Original vertex = " << vertices[vertexIndex] << ", new vertex = " << vertex);
-
-        // see how far off we were
-        //if (!nonPlanarPointFound){
-        //  Vector3d diff = vertex - vertices[vertexIndex];
-        //  // see if more than 1 inch off of plane
-        //  if (diff.length() > 0.0254){
-        //    LOG(Warn, "PlanarSurface '" << this->name().get() << "' given non-planar vertices, these have been corrected.");
-        //    nonPlanarPointFound = true;
-        //  }
-        //}
-
-        std::vector<std::string> values;
-        values.push_back(toString(vertex.x()));
-        values.push_back(toString(vertex.y()));
-        values.push_back(toString(vertex.z()));
-
-        ModelExtensibleGroup group = pushExtensibleGroup(values, false).cast<ModelExtensibleGroup>();
-        OS_ASSERT(!group.empty());
+      // DLM: fitting points to plane here as well as in SketchUp was resulting in unacceptable rounding errors
+      // just use points directly
+      std::vector<double> values;
+      values.reserve(3*n);
+      for (const Point3d& vertex : vertices) {
+        values.push_back(vertex.x());
+        values.push_back(vertex.y());
+        values.push_back(vertex.z());
       }
 
+      // replace all vertex groups in one pass
+      result = setNumericExtensibleGroups(values, false);
+      OS_ASSERT(result);
+
       LOG(Debug, "After setVertices have " << numFields() << " fields.  Size of vertices is "
           << vertices.size() << ".");
 
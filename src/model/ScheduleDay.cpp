@@ -329,6 +329,48 @@ namespace detail {
     return result;
   }
 
+  bool ScheduleDay_Impl::setValues(const std::vector<openstudio::Time>& untilTimes, const std::vector<double>& values) {
+    if (untilTimes.empty() || (untilTimes.size() != values.size())) {
+      return false;
+    }
+
+    // validate everything before changing the object, sorting by the until time in minutes as
+    // stored, later values overwrite earlier ones for the same time as in addValue
+    std::map<int, double> minutesToValues;
+    for (unsigned i = 0; i < untilTimes.size(); ++i) {
+      const openstudio::Time& untilTime = untilTimes[i];
+      double value = values[i];
+
+      if (untilTime.totalMinutes() <= 0.5 || untilTime.totalDays() > 1.0) {
+        return false;
+      }
+
+      // Check validity, cannot be NaN, Inf, etc
+      if (std::isinf(value)) {
+        LOG(Warn, "Cannot setDouble to Infinity for " << this->briefDescription());
+        return false;
+      } else if (std::isnan(value)) {
+        LOG(Warn, "Cannot setDouble to a NaN for " << this->briefDescription());
+        return false;
+      }
+
+      int untilHours = untilTime.hours() + 24*untilTime.days();
+      int untilMinutes = untilTime.minutes() + (int)floor((untilTime.seconds()/60.0) + 0.5);
+      minutesToValues[60*untilHours + untilMinutes] = value;
+    }
+
+    // hour, minute, value for each extensible group
+    std::vector<double> groupValues;
+    groupValues.reserve(3*minutesToValues.size());
+    for (const auto& minutesAndValue : minutesToValues) {
+      groupValues.push_back(minutesAndValue.first / 60);
+      groupValues.push_back(minutesAndValue.first % 60);
+      groupValues.push_back(minutesAndValue.second);
+    }
+
+    return setNumericExtensibleGroups(groupValues);
+  }
+
   boost::optional<double> ScheduleDay_Impl::removeValue(const openstudio::Time& time){
 
     boost::optional<unsigned> timeIndex;
@@ -473,6 +515,10 @@ bool ScheduleDay::addValue(const openstudio::Time& untilTime, double value) {
   return getImpl<detail::ScheduleDay_Impl>()->addValue(untilTime, value);
 }
 
+bool ScheduleDay::setValues(const std::vector<openstudio::Time>& untilTimes, const std::vector<double>& values) {
+  return getImpl<detail::ScheduleDay_Impl>()->setValues(untilTimes, values);
+}
+
 boost::optional<double> ScheduleDay::removeValue(const openstudio::Time& time){
   return getImpl<detail::ScheduleDay_Impl>()->removeValue(time);
 }
@@ -99,6 +99,13 @@ class MODEL_API ScheduleDay : public ScheduleBase {
    *  for same time. */
   bool addValue(const openstudio::Time& untilTime, double value);
 
+  /** Replaces all existing times and values with untilTimes and values, which are sorted by time
+   *  and may be given in any order.  A later value replaces an earlier one for the same time.
+   *  Returns false, leaving the schedule unchanged, if the vectors are empty or of different
+   *  sizes, or if any time or value would be rejected by addValue.  Much faster than repeated
+   *  calls to addValue when setting many values. */
+  bool setValues(const std::vector<openstudio::Time>& untilTimes, const std::vector<double>& values);
+
   /** Remove a value added by addValue at the exact time.  Returns the removed
    *  value if there was one. */
   boost::optional<double> removeValue(const openstudio::Time& time);
@@ -120,6 +120,9 @@ namespace detail {
     /// for same time if it exists.
     bool addValue(const openstudio::Time& untilTime, double value);
 
+    /// Replaces all times and values, validating and writing them in a single pass.
+    bool setValues(const std::vector<openstudio::Time>& untilTimes, const std::vector<double>& values);
+
     boost::optional<double> removeValue(const openstudio::Time& time);
 
     /// Clear all values from this schedule.
@@ -159,7 +159,6 @@ namespace detail {
     }
 
     // at this point we are going to change the object
-    clearExtensibleGroups(false);
 
     // set the interval
     this->setIntervalLength(intervalLength, false);
@@ -171,23 +170,13 @@ namespace detail {
     // set the out of range value
     double outOfRangeValue = timeSeries.outOfRangeValue();
 
-    // add in numIntervalsToFirstReport-1 outOfRangeValues to pad the timeseries
-    for (unsigned i = 0; i < numIntervalsToFirstReport - 1; ++i){
-      std::vector<std::string> temp;
-      temp.push_back(toString(outOfRangeValue));
+    // add in numIntervalsToFirstReport-1 outOfRangeValues to pad the timeseries, then the values
+    std::vector<double> groupValues(static_cast<unsigned>(numIntervalsToFirstReport) - 1, outOfRangeValue);
+    groupValues.insert(groupValues.end(), values.begin(), values.end());
 
-      ModelExtensibleGroup group = pushExtensibleGroup(temp, false).cast<ModelExtensibleGroup>();
-      OS_ASSERT(!group.empty());
-    }
-
-    // set the values
-    for (unsigned i = 0; i < values.size(); ++i){
-      std::vector<std::string> temp;
-      temp.push_back(toString(values[i]));
-
-      ModelExtensibleGroup group = pushExtensibleGroup(temp, false).cast<ModelExtensibleGroup>();
-      OS_ASSERT(!group.empty());
-    }
+    // values were checked above, write them all at once
+    bool ok = setNumericExtensibleGroups(groupValues, false);
+    OS_ASSERT(ok);
 
     this->emitChangeSignals();
 
@@ -59,10 +59,17 @@
 #include "DefaultConstructionSet.hpp"
 #include "DefaultConstructionSet_Impl.hpp"
 #include "ShadingSurfaceGroup.hpp"
+#include "ShadingSurfaceGroup_Impl.hpp"
 #include "InteriorPartitionSurfaceGroup.hpp"
+#include "InteriorPartitionSurfaceGroup_Impl.hpp"
+#include "DefaultSurfaceConstructions.hpp"
+#include "DefaultSurfaceConstructions_Impl.hpp"
+#include "DefaultSubSurfaceConstructions.hpp"
+#include "DefaultSubSurfaceConstructions_Impl.hpp"
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Plane.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
@@ -70,6 +77,10 @@
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/ThreeJS.hpp"
 
+#include <boost/functional/hash.hpp>
+
+#include <set>
+
 #include <thread>
 
 #include <cmath>
@@ -146,18 +157,6 @@ namespace openstudio
 
     }
 
-    size_t getVertexIndex(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001)
-    {
-      size_t n = allPoints.size();
-      for (size_t i = 0; i < n; ++i){
-        if (std::sqrt(std::pow(point3d.x()-allPoints[i].x(), 2) + std::pow(point3d.y()-allPoints[i].y(), 2) + std::pow(point3d.z()-allPoints[i].z(), 2)) < tol){
-          return i;
-        }
-      }
-      allPoints.push_back(point3d);
-      return (allPoints.size() - 1);
-    }
-
     void updateUserData(ThreeUserData& userData, const PlanarSurface& planarSurface)
     {
       std::string name = planarSurface.nameString();
@@ -240,6 +239,10 @@ namespace openstudio
         userData.setSurfaceTypeMaterialName(getSurfaceTypeThreeMaterialName(subSurfaceType));
 
         boost::optional<Surface> parentSurface = subSurface->surface();
+        if (parentSurface){
+          // lets an incremental export find the parent of a removed sub surface
+          userData.setSurfaceHandle(toThreeUUID(toString(parentSurface->handle())));
+        }
         std::string boundaryMaterialName;
         if (surface){
           boundaryMaterialName = "Boundary_" + surface->surfaceType();
@@ -303,45 +306,176 @@ namespace openstudio
       }
     }
 
-    void makeGeometries(const PlanarSurface& planarSurface, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas, bool triangulateSurfaces)
+    /// geometry of a planar surface gathered from the model so that it can be triangulated off of the calling thread
+    struct SurfaceTriangulation {
+      Transformation siteTransformation;
+      Transformation t;
+      Point3dVector vertices;
+      Point3dVector faceVertices;
+      Point3dVectorVector faceSubVertices;
+      Point3dVectorVector finalFaceVertices;
+      std::vector<LogMessage> triangulationMessages;
+    };
+
+    SurfaceTriangulation getSurfaceTriangulation(const PlanarSurface& planarSurface)
     {
-      std::string name = planarSurface.nameString();
+      SurfaceTriangulation result;
+
       boost::optional<Surface> surface = planarSurface.optionalCast<Surface>();
       boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
 
       // get the transformation to site coordinates
-      Transformation siteTransformation;
       if (planarSurfaceGroup){
-        siteTransformation = planarSurfaceGroup->siteTransformation();
+        result.siteTransformation = planarSurfaceGroup->siteTransformation();
       }
 
       // get the vertices
-      Point3dVector vertices = planarSurface.vertices();
-      Transformation t = Transformation::alignFace(vertices);
+      result.vertices = planarSurface.vertices();
+      result.t = Transformation::alignFace(result.vertices);
       //Transformation r = t.rotationMatrix();
-      Transformation tInv = t.inverse();
-      Point3dVector faceVertices = reverse(tInv*vertices);
+      Transformation tInv = result.t.inverse();
+      result.faceVertices = reverse(tInv*result.vertices);
 
       // get vertices of all sub surfaces
-      Point3dVectorVector faceSubVertices;
       if (surface){
         for (const auto& subSurface : surface->subSurfaces()){
-          faceSubVertices.push_back(reverse(tInv*subSurface.vertices()));
+          result.faceSubVertices.push_back(reverse(tInv*subSurface.vertices()));
+        }
+      }
+
+      return result;
+    }
+
+    size_t hashFaceVertices(const Point3dVector& vertices, const Point3dVectorVector& holes)
+    {
+      size_t seed = 0;
+      auto hashPoints = [&seed](const Point3dVector& points){
+        boost::hash_combine(seed, points.size());
+        for (const auto& point : points){
+          boost::hash_combine(seed, point.x());
+          boost::hash_combine(seed, point.y());
+          boost::hash_combine(seed, point.z());
+        }
+      };
+
+      hashPoints(vertices);
+      for (const auto& hole : holes){
+        hashPoints(hole);
+      }
+
+      return seed;
+    }
+
+    /// triangulate one surface on a worker thread, keeping the messages logged by the triangulation
+    void triangulateSurface(SurfaceTriangulation& surface)
+    {
+      StringStreamLogSink logSink;
+      logSink.setLogLevel(Warn);
+      logSink.setThreadId(std::this_thread::get_id());
+
+      surface.finalFaceVertices = computeTriangulation(surface.faceVertices, surface.faceSubVertices);
+      surface.triangulationMessages = logSink.logMessages();
+    }
+
+    /// triangulate surfaces on all available processors, each call writes only to its own surface
+    /// log messages from worker threads would be dropped by the translator's thread filtered log sink, so they
+    /// are collected per surface and logged again on the calling thread after the join
+    void computeTriangulations(const std::vector<SurfaceTriangulation*>& surfaces)
+    {
+      std::thread::id callingThreadId = std::this_thread::get_id();
+      parallelFor(surfaces.size(), [&surfaces, callingThreadId](size_t i) {
+        if (std::this_thread::get_id() == callingThreadId){
+          // messages logged on the calling thread already reach the translator's log sink
+          surfaces[i]->finalFaceVertices = computeTriangulation(surfaces[i]->faceVertices, surfaces[i]->faceSubVertices);
+        } else {
+          triangulateSurface(*surfaces[i]);
+        }
+      });
+
+      for (SurfaceTriangulation* surface : surfaces){
+        for (const LogMessage& logMessage : surface->triangulationMessages){
+          LOG_FREE(logMessage.logLevel(), logMessage.logChannel(), logMessage.logMessage());
         }
+        surface->triangulationMessages.clear();
       }
+    }
+
+    /// triangulate surfaces, reusing triangulations in cache
+    /// if pruneCache is true only entries for these surfaces are kept, otherwise new entries are added to the cache
+    template <typename TriangulationCache>
+    void computeCachedTriangulations(std::vector<SurfaceTriangulation>& surfaceTriangulations, TriangulationCache& cache, bool pruneCache)
+    {
+      typedef typename TriangulationCache::mapped_type::value_type TriangulationCacheEntry;
+
+      std::vector<SurfaceTriangulation*> toTriangulate;
+      std::vector<size_t> hashes;
+      hashes.reserve(surfaceTriangulations.size());
+      for (auto& surfaceTriangulation : surfaceTriangulations)
+      {
+        size_t hash = hashFaceVertices(surfaceTriangulation.faceVertices, surfaceTriangulation.faceSubVertices);
+        hashes.push_back(hash);
+
+        bool found = false;
+        auto it = cache.find(hash);
+        if (it != cache.end()){
+          for (const auto& entry : it->second){
+            if ((entry.vertices == surfaceTriangulation.faceVertices) && (entry.holes == surfaceTriangulation.faceSubVertices)){
+              surfaceTriangulation.finalFaceVertices = entry.triangles;
+              found = true;
+              break;
+            }
+          }
+        }
+
+        if (!found){
+          toTriangulate.push_back(&surfaceTriangulation);
+        }
+      }
+
+      computeTriangulations(toTriangulate);
+
+      TriangulationCache newCache;
+      TriangulationCache& updatedCache = pruneCache ? newCache : cache;
+      for (size_t i = 0; i < surfaceTriangulations.size(); ++i)
+      {
+        const SurfaceTriangulation& surfaceTriangulation = surfaceTriangulations[i];
+        auto& entries = updatedCache[hashes[i]];
+        bool found = false;
+        for (const auto& entry : entries){
+          if ((entry.vertices == surfaceTriangulation.faceVertices) && (entry.holes == surfaceTriangulation.faceSubVertices)){
+            found = true;
+            break;
+          }
+        }
+        if (!found){
+          entries.push_back(TriangulationCacheEntry{surfaceTriangulation.faceVertices, surfaceTriangulation.faceSubVertices, surfaceTriangulation.finalFaceVertices});
+        }
+      }
+
+      if (pruneCache){
+        cache.swap(newCache);
+      }
+    }
+
+    void makeGeometries(const PlanarSurface& planarSurface, const SurfaceTriangulation& surfaceTriangulation, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas, bool triangulateSurfaces)
+    {
+      std::string name = planarSurface.nameString();
+      const Transformation& siteTransformation = surfaceTriangulation.siteTransformation;
+      const Transformation& t = surfaceTriangulation.t;
+      const Point3dVector& vertices = surfaceTriangulation.vertices;
 
       Point3dVectorVector finalFaceVertices;
       if (triangulateSurfaces){
-        finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
+        finalFaceVertices = surfaceTriangulation.finalFaceVertices;
         if (finalFaceVertices.empty()){
-          LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << faceSubVertices.size() << " sub surfaces");
+          LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << surfaceTriangulation.faceSubVertices.size() << " sub surfaces");
           return;
         }
       } else{
-        finalFaceVertices.push_back(faceVertices);
+        finalFaceVertices.push_back(surfaceTriangulation.faceVertices);
       }
 
-      Point3dVector allVertices;
+      VertexWelder allVertices;
       std::vector<size_t> faceIndices;
       for (const auto& finalFaceVerts : finalFaceVertices) {
         Point3dVector finalVerts = siteTransformation*t*finalFaceVerts;
@@ -365,14 +499,14 @@ namespace openstudio
         Point3dVector::reverse_iterator it = finalVerts.rbegin();
         Point3dVector::reverse_iterator itend = finalVerts.rend();
         for (; it != itend; ++it){
-          faceIndices.push_back(getVertexIndex(*it, allVertices));
+          faceIndices.push_back(allVertices.index(*it));
         }
 
         // convert to 1 based indices
         //face_indices.each_index {|i| face_indices[i] = face_indices[i] + 1}
       }
 
-      ThreeGeometryData geometryData(toThreeVector(allVertices), faceIndices);
+      ThreeGeometryData geometryData(toThreeVector(allVertices.vertices()), faceIndices);
 
       ThreeGeometry geometry(toThreeUUID(toString(planarSurface.handle())), "Geometry", geometryData);
       geometries.push_back(geometry);
@@ -405,6 +539,105 @@ namespace openstudio
     }
 
 
+    /// adds planarSurface to affectedSurfaces if it is not already there
+    void addAffectedSurface(const PlanarSurface& planarSurface, std::vector<PlanarSurface>& affectedSurfaces, std::set<Handle>& affectedHandles)
+    {
+      if (affectedHandles.insert(planarSurface.handle()).second){
+        affectedSurfaces.push_back(planarSurface);
+      }
+    }
+
+    void addAffectedSurfaces(const Space& space, std::vector<PlanarSurface>& affectedSurfaces, std::set<Handle>& affectedHandles)
+    {
+      for (const auto& surface : space.surfaces()){
+        addAffectedSurface(surface, affectedSurfaces, affectedHandles);
+        for (const auto& subSurface : surface.subSurfaces()){
+          addAffectedSurface(subSurface, affectedSurfaces, affectedHandles);
+        }
+      }
+      for (const auto& group : space.shadingSurfaceGroups()){
+        for (const auto& shadingSurface : group.shadingSurfaces()){
+          addAffectedSurface(shadingSurface, affectedSurfaces, affectedHandles);
+        }
+      }
+      for (const auto& group : space.interiorPartitionSurfaceGroups()){
+        for (const auto& interiorPartitionSurface : group.interiorPartitionSurfaces()){
+          addAffectedSurface(interiorPartitionSurface, affectedSurfaces, affectedHandles);
+        }
+      }
+    }
+
+    /// find the planar surfaces whose geometry or user data depend on the changed objects
+    /// returns false if all surfaces must be translated again
+    bool getAffectedSurfaces(const Model& model, const std::vector<Handle>& changedHandles, std::vector<PlanarSurface>& affectedSurfaces)
+    {
+      std::set<Handle> affectedHandles;
+
+      for (const auto& handle : changedHandles){
+        boost::optional<ModelObject> modelObject = model.getModelObject<ModelObject>(handle);
+        if (!modelObject){
+          // removed objects are mapped to the surfaces they affected by the caller
+          continue;
+        }
+
+        if (boost::optional<PlanarSurface> planarSurface = modelObject->optionalCast<PlanarSurface>()){
+          addAffectedSurface(*planarSurface, affectedSurfaces, affectedHandles);
+
+          // sub surfaces are holes in their parent surface and take exposure from it
+          if (boost::optional<Surface> surface = modelObject->optionalCast<Surface>()){
+            for (const auto& subSurface : surface->subSurfaces()){
+              addAffectedSurface(subSurface, affectedSurfaces, affectedHandles);
+            }
+            if (boost::optional<Surface> adjacentSurface = surface->adjacentSurface()){
+              addAffectedSurface(*adjacentSurface, affectedSurfaces, affectedHandles);
+            }
+          } else if (boost::optional<SubSurface> subSurface = modelObject->optionalCast<SubSurface>()){
+            if (boost::optional<Surface> surface = subSurface->surface()){
+              addAffectedSurface(*surface, affectedSurfaces, affectedHandles);
+            }
+            if (boost::optional<SubSurface> adjacentSubSurface = subSurface->adjacentSubSurface()){
+              addAffectedSurface(*adjacentSubSurface, affectedSurfaces, affectedHandles);
+            }
+          }
+        } else if (boost::optional<Space> space = modelObject->optionalCast<Space>()){
+          addAffectedSurfaces(*space, affectedSurfaces, affectedHandles);
+        } else if (boost::optional<ShadingSurfaceGroup> group = modelObject->optionalCast<ShadingSurfaceGroup>()){
+          for (const auto& shadingSurface : group->shadingSurfaces()){
+            addAffectedSurface(shadingSurface, affectedSurfaces, affectedHandles);
+          }
+        } else if (boost::optional<InteriorPartitionSurfaceGroup> group = modelObject->optionalCast<InteriorPartitionSurfaceGroup>()){
+          for (const auto& interiorPartitionSurface : group->interiorPartitionSurfaces()){
+            addAffectedSurface(interiorPartitionSurface, affectedSurfaces, affectedHandles);
+          }
+        } else if (boost::optional<ThermalZone> thermalZone = modelObject->optionalCast<ThermalZone>()){
+          for (const auto& space : thermalZone->spaces()){
+            addAffectedSurfaces(space, affectedSurfaces, affectedHandles);
+          }
+        } else if (boost::optional<SpaceType> spaceType = modelObject->optionalCast<SpaceType>()){
+          for (const auto& space : spaceType->spaces()){
+            addAffectedSurfaces(space, affectedSurfaces, affectedHandles);
+          }
+        } else if (boost::optional<BuildingStory> buildingStory = modelObject->optionalCast<BuildingStory>()){
+          for (const auto& space : buildingStory->spaces()){
+            addAffectedSurfaces(space, affectedSurfaces, affectedHandles);
+          }
+        } else if (boost::optional<BuildingUnit> buildingUnit = modelObject->optionalCast<BuildingUnit>()){
+          for (const auto& space : buildingUnit->spaces()){
+            addAffectedSurfaces(space, affectedSurfaces, affectedHandles);
+          }
+        } else if (modelObject->optionalCast<Building>() ||
+                   modelObject->optionalCast<ConstructionBase>() ||
+                   modelObject->optionalCast<DefaultConstructionSet>() ||
+                   modelObject->optionalCast<DefaultSurfaceConstructions>() ||
+                   modelObject->optionalCast<DefaultSubSurfaceConstructions>()){
+          // building transformation and default constructions can affect any surface
+          return false;
+        }
+      }
+
+      return true;
+    }
+
     ThreeJSForwardTranslator::ThreeJSForwardTranslator()
     {
       m_logSink.setLogLevel(Warn);
@@ -425,6 +658,11 @@ namespace openstudio
       return result;
     }
 
+    void ThreeJSForwardTranslator::clearTriangulationCache()
+    {
+      m_triangulationCache.clear();
+    }
+
     std::vector<LogMessage> ThreeJSForwardTranslator::errors() const
     {
       std::vector<LogMessage> result;
@@ -479,12 +717,26 @@ namespace openstudio
       double n = 0;
       std::vector<PlanarSurface>::size_type N = planarSurfaces.size() + planarSurfaceGroups.size() + buildingStories.size() + buildingUnits.size() + thermalZones.size() + spaceTypes.size() + defaultConstructionSets.size() + 1;
 
-      // loop over all surfaces
+      // gather surface geometry, model access is not thread safe so this is done on the calling thread
+      std::vector<SurfaceTriangulation> surfaceTriangulations;
+      surfaceTriangulations.reserve(planarSurfaces.size());
       for (const auto& planarSurface : planarSurfaces)
       {
+        surfaceTriangulations.push_back(getSurfaceTriangulation(planarSurface));
+      }
+
+      if (triangulateSurfaces){
+        // only entries used by this translation are kept in the cache
+        computeCachedTriangulations(surfaceTriangulations, m_triangulationCache, true);
+      }
+
+      // loop over all surfaces
+      for (size_t surfaceIndex = 0; surfaceIndex < planarSurfaces.size(); ++surfaceIndex)
+      {
+        const PlanarSurface& planarSurface = planarSurfaces[surfaceIndex];
         std::vector<ThreeGeometry> geometries;
         std::vector<ThreeUserData> userDatas;
-        makeGeometries(planarSurface, geometries, userDatas, triangulateSurfaces);
+        makeGeometries(planarSurface, surfaceTriangulations[surfaceIndex], geometries, userDatas, triangulateSurfaces);
         OS_ASSERT(geometries.size() == userDatas.size());
 
         size_t n = geometries.size();
@@ -620,5 +872,110 @@ namespace openstudio
       return scene;
     }
 
+    ThreeSceneDelta ThreeJSForwardTranslator::modelToThreeJSDelta(const Model& model, const ThreeScene& previousScene, const std::vector<Handle>& changedHandles, bool triangulateSurfaces)
+    {
+      m_logSink.setThreadId(std::this_thread::get_id());
+      m_logSink.resetStringStream();
+
+      std::vector<ThreeMaterial> materials;
+      std::map<std::string, std::string> materialMap;
+      for (const auto& material : makeStandardThreeMaterials()){
+        addThreeMaterial(materials, materialMap, material);
+      }
+      buildMaterials(model, materials, materialMap);
+
+      // scene children of the previous scene by geometry id, child uuids are kept for modified geometries
+      std::map<std::string, std::string> previousChildIds;
+      std::map<std::string, ThreeUserData> previousUserDatas;
+      for (const auto& child : previousScene.object().children()){
+        previousChildIds[child.geometry()] = child.uuid();
+        previousUserDatas.insert(std::make_pair(child.geometry(), child.userData()));
+      }
+
+      // a removed surface no longer knows its parent or adjacent surface, these are recorded in the previous scene
+      std::vector<Handle> affectingHandles = changedHandles;
+      for (const auto& handle : changedHandles){
+        if (model.getModelObject<ModelObject>(handle)){
+          continue;
+        }
+        auto it = previousUserDatas.find(toThreeUUID(toString(handle)));
+        if (it == previousUserDatas.end()){
+          continue;
+        }
+        for (const std::string& relatedHandle : {it->second.surfaceHandle(), it->second.outsideBoundaryConditionObjectHandle()}){
+          if (!relatedHandle.empty()){
+            affectingHandles.push_back(toUUID(fromThreeUUID(relatedHandle)));
+          }
+        }
+      }
+
+      std::vector<PlanarSurface> affectedSurfaces;
+      if (!getAffectedSurfaces(model, affectingHandles, affectedSurfaces)){
+        affectedSurfaces = model.getModelObjects<PlanarSurface>();
+      }
+
+      std::set<std::string> removedGeometryIds;
+      for (const auto& handle : changedHandles){
+        std::string geometryId = toThreeUUID(toString(handle));
+        if (!model.getModelObject<ModelObject>(handle) && (previousChildIds.find(geometryId) != previousChildIds.end())){
+          removedGeometryIds.insert(geometryId);
+        }
+      }
+
+      std::vector<SurfaceTriangulation> surfaceTriangulations;
+      surfaceTriangulations.reserve(affectedSurfaces.size());
+      for (const auto& planarSurface : affectedSurfaces)
+      {
+        surfaceTriangulations.push_back(getSurfaceTriangulation(planarSurface));
+      }
+
+      if (triangulateSurfaces){
+        // keep cached triangulations of unaffected surfaces
+        computeCachedTriangulations(surfaceTriangulations, m_triangulationCache, false);
+      }
+
+      std::vector<ThreeGeometry> addedGeometries;
+      std::vector<ThreeSceneChild> addedChildren;
+      std::vector<ThreeGeometry> modifiedGeometries;
+      std::vector<ThreeSceneChild> modifiedChildren;
+
+      for (size_t surfaceIndex = 0; surfaceIndex < affectedSurfaces.size(); ++surfaceIndex)
+      {
+        const PlanarSurface& planarSurface = affectedSurfaces[surfaceIndex];
+        std::vector<ThreeGeometry> geometries;
+        std::vector<ThreeUserData> userDatas;
+        makeGeometries(planarSurface, surfaceTriangulations[surfaceIndex], geometries, userDatas, triangulateSurfaces);
+        OS_ASSERT(geometries.size() == userDatas.size());
+
+        std::string geometryId = toThreeUUID(toString(planarSurface.handle()));
+        auto it = previousChildIds.find(geometryId);
+
+        if (geometries.empty()){
+          // surface can no longer be triangulated
+          if (it != previousChildIds.end()){
+            removedGeometryIds.insert(geometryId);
+          }
+          continue;
+        }
+
+        for (size_t i = 0; i < geometries.size(); ++i){
+          std::string thisName(userDatas[i].name());
+          std::string thisMaterialId = getThreeMaterialId(userDatas[i].surfaceTypeMaterialName(), materialMap);
+
+          if (it != previousChildIds.end()){
+            modifiedGeometries.push_back(geometries[i]);
+            modifiedChildren.push_back(ThreeSceneChild(it->second, thisName, "Mesh", geometries[i].uuid(), thisMaterialId, userDatas[i]));
+          } else{
+            std::string thisUUID(toThreeUUID(toString(createUUID())));
+            addedGeometries.push_back(geometries[i]);
+            addedChildren.push_back(ThreeSceneChild(thisUUID, thisName, "Mesh", geometries[i].uuid(), thisMaterialId, userDatas[i]));
+          }
+        }
+      }
+
+      return ThreeSceneDelta(addedGeometries, addedChildren, modifiedGeometries, modifiedChildren,
+                             std::vector<std::string>(removedGeometryIds.begin(), removedGeometryIds.end()), materials);
+    }
+
   }//model
 }//openstudio
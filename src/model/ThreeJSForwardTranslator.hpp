@@ -38,6 +38,8 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <unordered_map>
+
 namespace openstudio
 {
   namespace model
@@ -60,16 +62,35 @@ namespace openstudio
       ThreeScene modelToThreeJS(const Model& model, bool triangulateSurfaces);
       ThreeScene modelToThreeJS(const Model& model, bool triangulateSurfaces, std::function<void(double)> updatePercentage);
 
+      /// Convert only the objects which changed since previousScene was generated from this model, e.g. as recorded by a WorkspaceChangeTracker.
+      /// Surfaces affected by a changed object, directly or through their space, zone, story, space type or building unit, are re-emitted
+      /// and surfaces of removed objects are removed. Changes to the building or to any construction or construction set re-emit all surfaces.
+      /// previousScene must have been generated with the same value of triangulateSurfaces, scene metadata is not updated.
+      ThreeSceneDelta modelToThreeJSDelta(const Model& model, const ThreeScene& previousScene, const std::vector<Handle>& changedHandles, bool triangulateSurfaces);
+
       /// Get warning messages generated by the last translation.
       std::vector<LogMessage> warnings() const;
 
       /// Get error messages generated by the last translation.
       std::vector<LogMessage> errors() const;
 
+      /// Triangulations are cached by face vertices between calls to modelToThreeJS, surfaces
+      /// which have not changed since the last translation are not triangulated again.
+      /// Only entries used by the last translation are kept.
+      void clearTriangulationCache();
+
     private:
       REGISTER_LOGGER("openstudio.model.ThreeJSForwardTranslator");
 
+      struct TriangulationCacheEntry {
+        Point3dVector vertices;
+        Point3dVectorVector holes;
+        Point3dVectorVector triangles;
+      };
+
       StringStreamLogSink m_logSink;
+
+      std::unordered_map<size_t, std::vector<TriangulationCacheEntry>> m_triangulationCache;
     };
 
   }
@@ -0,0 +1,120 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "BenchmarkModels.hpp"
+
+#include "../Space.hpp"
+#include "../Surface.hpp"
+#include "../Surface_Impl.hpp"
+#include "../SubSurface.hpp"
+#include "../ThermalZone.hpp"
+#include "../AirLoopHVAC.hpp"
+#include "../PlantLoop.hpp"
+#include "../Node.hpp"
+#include "../Schedule.hpp"
+#include "../FanConstantVolume.hpp"
+#include "../CoilHeatingWater.hpp"
+#include "../BoilerHotWater.hpp"
+#include "../PumpVariableSpeed.hpp"
+#include "../AirTerminalSingleDuctConstantVolumeNoReheat.hpp"
+
+#include "../../utilities/geometry/Point3d.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace openstudio {
+namespace model {
+
+  Model makeBenchmarkModel(unsigned numSpaces, unsigned numAirLoops, bool matched)
+  {
+    Model model;
+
+    unsigned numPerRow = static_cast<unsigned>(std::ceil(std::sqrt(static_cast<double>(numSpaces))));
+    std::vector<Space> spaces;
+    std::vector<ThermalZone> zones;
+    for (unsigned i = 0; i < numSpaces; ++i) {
+      double x = 10.0 * (i % numPerRow);
+      double y = 10.0 * (i / numPerRow);
+      std::vector<Point3d> floorPrint{Point3d(x, y + 10, 0), Point3d(x + 10, y + 10, 0), Point3d(x + 10, y, 0), Point3d(x, y, 0)};
+      boost::optional<Space> space = Space::fromFloorPrint(floorPrint, 3.0, model);
+      if (!space) {
+        continue;
+      }
+      ThermalZone zone(model);
+      space->setThermalZone(zone);
+      spaces.push_back(*space);
+      zones.push_back(zone);
+    }
+
+    if (matched) {
+      matchSurfaces(spaces);
+      for (Surface surface : model.getConcreteModelObjects<Surface>()) {
+        if ((surface.surfaceType() == "Wall") && (surface.outsideBoundaryCondition() == "Outdoors")) {
+          surface.setWindowToWallRatio(0.3);
+        }
+      }
+    }
+
+    if (numAirLoops == 0) {
+      return model;
+    }
+
+    Schedule alwaysOn = model.alwaysOnDiscreteSchedule();
+
+    PlantLoop hotWaterLoop(model);
+    BoilerHotWater boiler(model);
+    hotWaterLoop.addSupplyBranchForComponent(boiler);
+    PumpVariableSpeed pump(model);
+    Node supplyInletNode = hotWaterLoop.supplyInletNode();
+    pump.addToNode(supplyInletNode);
+
+    std::vector<AirLoopHVAC> airLoops;
+    for (unsigned i = 0; i < numAirLoops; ++i) {
+      AirLoopHVAC airLoop(model);
+      FanConstantVolume fan(model, alwaysOn);
+      Node supplyOutletNode = airLoop.supplyOutletNode();
+      fan.addToNode(supplyOutletNode);
+      CoilHeatingWater coil(model, alwaysOn);
+      coil.addToNode(supplyOutletNode);
+      hotWaterLoop.addDemandBranchForComponent(coil);
+      airLoops.push_back(airLoop);
+    }
+
+    for (size_t i = 0; i < zones.size(); ++i) {
+      AirTerminalSingleDuctConstantVolumeNoReheat terminal(model, alwaysOn);
+      airLoops[i % airLoops.size()].addBranchForZone(zones[i], terminal);
+    }
+
+    return model;
+  }
+
+} // model
+} // openstudio
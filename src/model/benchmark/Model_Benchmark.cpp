@@ -0,0 +1,176 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <benchmark/benchmark.h>
+#include "../../utilities/benchmark/BenchmarkHelpers.hpp"
+
+#include "BenchmarkModels.hpp"
+
+#include "../Model.hpp"
+#include "../Space.hpp"
+#include "../Space_Impl.hpp"
+#include "../AirLoopHVAC.hpp"
+#include "../AirLoopHVAC_Impl.hpp"
+#include "../AirTerminalSingleDuctConstantVolumeNoReheat.hpp"
+#include "../AirTerminalSingleDuctConstantVolumeNoReheat_Impl.hpp"
+#include "../BoilerHotWater.hpp"
+#include "../BoilerHotWater_Impl.hpp"
+#include "../CoilHeatingWater.hpp"
+#include "../CoilHeatingWater_Impl.hpp"
+#include "../FanConstantVolume.hpp"
+#include "../FanConstantVolume_Impl.hpp"
+#include "../PlantLoop.hpp"
+#include "../PlantLoop_Impl.hpp"
+#include "../PumpVariableSpeed.hpp"
+#include "../PumpVariableSpeed_Impl.hpp"
+
+#include "../../utilities/core/Path.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/filetypes/EpwFile.hpp"
+#include "../../utilities/sql/SqlFile.hpp"
+#include "../../utilities/time/Calendar.hpp"
+
+#include <resources.hxx>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+namespace {
+
+  // sizes are {number of spaces, number of air loops}
+  void modelSizes(benchmark::internal::Benchmark* b) {
+    for (int numSpaces : {10, 100, 1000}) {
+      b->Args({numSpaces, std::max(1, numSpaces / 10)});
+    }
+  }
+
+  template <typename T>
+  void addSizingRows(const Model& model, const std::vector<std::string>& descriptions, std::vector<benchmark_helpers::ComponentSizingRow>& rows) {
+    for (const T& object : model.getConcreteModelObjects<T>()) {
+      std::string sqlName = boost::to_upper_copy(object.nameString());
+      for (const std::string& description : descriptions) {
+        rows.push_back({sqlName, description, std::to_string(0.1 * (rows.size() + 1))});
+      }
+    }
+  }
+
+  // writes an sql file with the Component Sizing Information rows an EnergyPlus run reports for the
+  // autosized fields of model's HVAC, and returns its path
+  openstudio::path sizingSqlFile(const Model& model, const std::string& suffix) {
+    openstudio::path p = openstudio::tempDir() / openstudio::toPath("OpenStudioBenchmark_sizing_" + suffix + ".sql");
+    if (openstudio::filesystem::exists(p)) {
+      openstudio::filesystem::remove(p);
+    }
+
+    std::vector<benchmark_helpers::ComponentSizingRow> rows;
+    addSizingRows<AirLoopHVAC>(model, {"Design Supply Air Flow Rate [m3/s]"}, rows);
+    addSizingRows<AirTerminalSingleDuctConstantVolumeNoReheat>(model, {"Design Size Maximum Air Flow Rate [m3/s]"}, rows);
+    addSizingRows<BoilerHotWater>(model, {"Design Size Nominal Capacity [W]", "Design Size Design Water Flow Rate [m3/s]"}, rows);
+    addSizingRows<CoilHeatingWater>(model, {"Design Size U-Factor Times Area Value [W/K]", "Design Size Maximum Water Flow Rate [m3/s]",
+                                            "Design Size Rated Capacity [W]"}, rows);
+    addSizingRows<FanConstantVolume>(model, {"Design Size Maximum Flow Rate [m3/s]"}, rows);
+    addSizingRows<PlantLoop>(model, {"Maximum Loop Flow Rate [m3/s]", "Plant Loop Volume [m3]"}, rows);
+    addSizingRows<PumpVariableSpeed>(model, {"Design Flow Rate [m3/s]", "Design Power Consumption [W]"}, rows);
+
+    Calendar c(2012);
+    SqlFile sql(p, EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")), DateTime::now(), c);
+    benchmark_helpers::insertComponentSizingRows(sql, rows);
+    return p;
+  }
+
+}
+
+static void BM_ModelBuild(benchmark::State& state) {
+  for (auto _ : state) {
+    Model model = makeBenchmarkModel(static_cast<unsigned>(state.range(0)), static_cast<unsigned>(state.range(1)));
+    benchmark::DoNotOptimize(model);
+  }
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_ModelBuild)->Apply(modelSizes)->Unit(benchmark::kMillisecond);
+
+static void BM_ModelLoad(benchmark::State& state) {
+  openstudio::path p = openstudio::tempDir() / openstudio::toPath("OpenStudioBenchmark_" + std::to_string(state.range(0)) + "_" + std::to_string(state.range(1)) + ".osm");
+  {
+    Model model = makeBenchmarkModel(static_cast<unsigned>(state.range(0)), static_cast<unsigned>(state.range(1)));
+    if (!model.save(p, true)) {
+      state.SkipWithError("Unable to save synthetic model");
+      return;
+    }
+  }
+  for (auto _ : state) {
+    boost::optional<Model> model = Model::load(p);
+    benchmark::DoNotOptimize(model);
+  }
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_ModelLoad)->Apply(modelSizes)->Unit(benchmark::kMillisecond);
+
+static void BM_ModelSave(benchmark::State& state) {
+  openstudio::path p = openstudio::tempDir() / openstudio::toPath("OpenStudioBenchmark_save.osm");
+  Model model = makeBenchmarkModel(static_cast<unsigned>(state.range(0)), static_cast<unsigned>(state.range(1)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(model.save(p, true));
+  }
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_ModelSave)->Apply(modelSizes)->Unit(benchmark::kMillisecond);
+
+static void BM_IntersectSurfaces(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Model model = makeBenchmarkModel(static_cast<unsigned>(state.range(0)), 0, false);
+    std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+    state.ResumeTiming();
+
+    intersectSurfaces(spaces);
+    matchSurfaces(spaces);
+  }
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_IntersectSurfaces)->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMillisecond);
+
+static void BM_ModelApplySizingValues(benchmark::State& state) {
+  Model model = makeBenchmarkModel(static_cast<unsigned>(state.range(0)), static_cast<unsigned>(state.range(1)));
+  openstudio::path p = sizingSqlFile(model, std::to_string(state.range(0)) + "_" + std::to_string(state.range(1)));
+  for (auto _ : state) {
+    // a fresh sql file each time, as after a sizing run
+    model.setSqlFile(SqlFile(p));
+    model.applySizingValues();
+  }
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_ModelApplySizingValues)->Apply(modelSizes)->Unit(benchmark::kMillisecond);
@@ -33,6 +33,7 @@
 
 #include "../Model.hpp"
 #include "../Connection.hpp"
+#include "../Connection_Impl.hpp"
 #include "../AirLoopHVAC.hpp"
 #include "../Node.hpp"
 #include "../AirLoopHVACZoneSplitter.hpp"
@@ -45,6 +46,7 @@
 #include <utilities/idd/OS_Node_FieldEnums.hxx>
 #include <utilities/idd/OS_AirLoopHVAC_ZoneSplitter_FieldEnums.hxx>
 #include <utilities/idd/OS_AirLoopHVAC_ZoneMixer_FieldEnums.hxx>
+#include <utilities/idd/OS_Connection_FieldEnums.hxx>
 #include <utilities/idd/IddEnums.hxx>
 
 using namespace openstudio;
@@ -70,3 +72,55 @@ TEST_F(ModelFixture, Connection_Name)
   ASSERT_TRUE(connection.name());
   EXPECT_NE(connection.name().get(),"");
 }
+
+TEST_F(ModelFixture, Connection_PortIndex)
+{
+  Model m;
+  Node node1(m);
+  Node node2(m);
+  FanConstantVolume fan(m);
+
+  m.connect(node1, node1.outletPort(), node2, node2.inletPort());
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_TRUE(node1.outletModelObject());
+    EXPECT_EQ(node2, node1.outletModelObject().get());
+    ASSERT_TRUE(node2.inletModelObject());
+    EXPECT_EQ(node1, node2.inletModelObject().get());
+    ASSERT_TRUE(node1.connectedObjectPort(node1.outletPort()));
+    EXPECT_EQ(node2.inletPort(), node1.connectedObjectPort(node1.outletPort()).get());
+  }
+
+  // ports are data fields but are part of the connection graph
+  boost::optional<Connection> connection = node1.getModelObjectTarget<Connection>(node1.outletPort());
+  ASSERT_TRUE(connection);
+  EXPECT_TRUE(connection->setTargetObjectPort(99u));
+  ASSERT_TRUE(node1.connectedObjectPort(node1.outletPort()));
+  EXPECT_EQ(99u, node1.connectedObjectPort(node1.outletPort()).get());
+  EXPECT_TRUE(connection->setUnsigned(OS_ConnectionFields::InletPort, node2.inletPort()));
+  EXPECT_EQ(node2.inletPort(), node1.connectedObjectPort(node1.outletPort()).get());
+
+  m.connect(node1, node1.outletPort(), fan, fan.inletPort());
+  ASSERT_TRUE(node1.outletModelObject());
+  EXPECT_EQ(fan, node1.outletModelObject().get());
+  ASSERT_TRUE(fan.inletModelObject());
+  EXPECT_EQ(node1, fan.inletModelObject().get());
+  EXPECT_FALSE(node2.inletModelObject());
+
+  m.disconnect(node1, node1.outletPort());
+  EXPECT_FALSE(node1.outletModelObject());
+  EXPECT_FALSE(node1.connectedObjectPort(node1.outletPort()));
+  EXPECT_FALSE(fan.inletModelObject());
+
+  // incomplete connections
+  Connection partial(m);
+  EXPECT_TRUE(node2.setPointer(node2.outletPort(), partial.handle()));
+  EXPECT_FALSE(node2.outletModelObject());
+  EXPECT_TRUE(partial.setSourceObject(node2));
+  EXPECT_FALSE(node2.outletModelObject());
+  EXPECT_TRUE(partial.setTargetObject(fan));
+  ASSERT_TRUE(node2.outletModelObject());
+  EXPECT_EQ(fan, node2.outletModelObject().get());
+
+  fan.remove();
+  EXPECT_FALSE(node2.outletModelObject());
+}
@@ -33,6 +33,7 @@
 
 #include "../Model.hpp"
 #include "../Model_Impl.hpp"
+#include "../ModelLoader.hpp"
 #include "../GenericModelObject.hpp"
 #include "../GenericModelObject_Impl.hpp"
 #include "../ScheduleTypeLimits.hpp"
@@ -486,6 +487,35 @@ TEST_F(ExampleModelFixture, ExampleModel_StagedLoad) {
   EXPECT_FALSE(zones[0].spaces().empty());
 }
 
+TEST_F(ExampleModelFixture, ExampleModel_LoadModels)
+{
+  Model model = exampleModel();
+
+  std::vector<openstudio::path> paths;
+  for (unsigned i = 0; i < 6; ++i){
+    openstudio::path path = toPath("./ExampleModel_LoadModels" + std::to_string(i) + ".osm");
+    addPathToCleanUp(path);
+    EXPECT_TRUE(model.save(path, true));
+    paths.push_back(path);
+  }
+  paths.push_back(toPath("./ExampleModel_LoadModels_Missing.osm"));
+
+  ModelLoader loader = loadModels(paths, 3);
+  EXPECT_EQ(paths.size(), loader.size());
+  EXPECT_EQ(3u, loader.numThreads());
+
+  std::vector<std::shared_future<boost::optional<Model> > > futures = loader.futures();
+  ASSERT_EQ(paths.size(), futures.size());
+  for (unsigned i = 0; i < 6; ++i){
+    boost::optional<Model> loaded = futures[i].get();
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(model.numObjects(), loaded->numObjects());
+    ASSERT_TRUE(loaded->getOptionalUniqueModelObject<Building>());
+    EXPECT_EQ(4u, loaded->getModelObjects<Space>().size());
+  }
+  EXPECT_FALSE(futures[6].get());
+}
+
 TEST_F(ExampleModelFixture, ExampleModel_ReloadTwoTimes)
 {
   Model model = exampleModel();
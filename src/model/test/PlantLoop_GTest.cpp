@@ -202,6 +202,45 @@ TEST_F(ModelFixture,PlantLoop_demandComponents)
   ASSERT_EQ( 3u,plantLoop.demandComponents(coil2,mixer).size() );
 }
 
+TEST_F(ModelFixture,PlantLoop_ComponentCache)
+{
+  Model m;
+  PlantLoop plantLoop(m);
+  Schedule s = m.alwaysOnDiscreteSchedule();
+
+  // the component lists are cached between topology changes
+  ASSERT_EQ( 5u,plantLoop.demandComponents().size() );
+  ASSERT_EQ( 5u,plantLoop.demandComponents().size() );
+
+  CoilHeatingWater coil(m,s);
+  EXPECT_FALSE(plantLoop.demandComponent(coil.handle()));
+  EXPECT_FALSE(plantLoop.component(coil.handle()));
+
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil));
+  EXPECT_TRUE(plantLoop.demandComponent(coil.handle()));
+  EXPECT_FALSE(plantLoop.supplyComponent(coil.handle()));
+  ASSERT_TRUE(plantLoop.component(coil.handle()));
+  EXPECT_EQ( coil,plantLoop.component(coil.handle()).get() );
+  EXPECT_EQ( 1u,plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size() );
+
+  // data changes leave the topology alone
+  EXPECT_TRUE(coil.setName("My Coil"));
+  EXPECT_EQ( 7u,plantLoop.demandComponents().size() );
+
+  ChillerElectricEIR chiller(m);
+  EXPECT_TRUE(plantLoop.addSupplyBranchForComponent(chiller));
+  EXPECT_TRUE(plantLoop.supplyComponent(chiller.handle()));
+  EXPECT_FALSE(plantLoop.demandComponent(chiller.handle()));
+
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(coil));
+  EXPECT_FALSE(plantLoop.demandComponent(coil.handle()));
+  EXPECT_EQ( 5u,plantLoop.demandComponents().size() );
+  EXPECT_TRUE(plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).empty());
+
+  chiller.remove();
+  EXPECT_TRUE(plantLoop.supplyComponents(ChillerElectricEIR::iddObjectType()).empty());
+}
+
 TEST_F(ModelFixture,PlantLoop_addDemandBranchForComponent)
 {
   Model m;
@@ -354,3 +354,47 @@ TEST_F(ModelFixture, Schedule_Day_addValue_NaN_Infinity)
 }
 
 
+
+TEST_F(ModelFixture, Schedule_Day_setValues)
+{
+  Model model;
+
+  ScheduleDay daySchedule(model);
+
+  // unsorted with a repeated time, the later value wins
+  std::vector<Time> times = { Time(0, 24, 0), Time(0, 6, 0), Time(0, 18, 30), Time(0, 6, 0) };
+  std::vector<double> values = { 0.1, 0.5, 1.0, 0.2 };
+  EXPECT_TRUE(daySchedule.setValues(times, values));
+  ASSERT_EQ(3u, daySchedule.times().size());
+  EXPECT_EQ(Time(0, 6, 0), daySchedule.times()[0]);
+  EXPECT_EQ(Time(0, 18, 30), daySchedule.times()[1]);
+  EXPECT_EQ(Time(0, 24, 0), daySchedule.times()[2]);
+  ASSERT_EQ(3u, daySchedule.values().size());
+  EXPECT_EQ(0.2, daySchedule.values()[0]);
+  EXPECT_EQ(1.0, daySchedule.values()[1]);
+  EXPECT_EQ(0.1, daySchedule.values()[2]);
+  EXPECT_EQ(1.0, daySchedule.getValue(Time(0, 12, 0)));
+
+  // invalid input leaves the schedule unchanged
+  EXPECT_FALSE(daySchedule.setValues(std::vector<Time>(), std::vector<double>()));
+  EXPECT_FALSE(daySchedule.setValues(times, std::vector<double>(2, 1.0)));
+  values[1] = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_FALSE(daySchedule.setValues(times, values));
+  times[1] = Time(1, 6, 0);
+  values[1] = 0.5;
+  EXPECT_FALSE(daySchedule.setValues(times, values));
+  EXPECT_EQ(3u, daySchedule.times().size());
+  EXPECT_EQ(0.2, daySchedule.values()[0]);
+
+  // every minute of the day
+  times.clear();
+  values.clear();
+  for (int i = 1; i <= 24*60; ++i) {
+    times.push_back(Time(0, 0, i));
+    values.push_back(i / 1440.0);
+  }
+  EXPECT_TRUE(daySchedule.setValues(times, values));
+  EXPECT_EQ(1440u, daySchedule.times().size());
+  EXPECT_EQ(Time(0, 24, 0), daySchedule.times().back());
+  EXPECT_DOUBLE_EQ(0.5, daySchedule.values()[719]);
+}
@@ -38,10 +38,13 @@
 #include "../Space_Impl.hpp"
 #include "../Surface.hpp"
 #include "../Surface_Impl.hpp"
+#include "../SubSurface.hpp"
+#include "../SubSurface_Impl.hpp"
 #include "../ConstructionAirBoundary.hpp"
 #include "../Construction.hpp"
 
 #include "../../utilities/geometry/ThreeJS.hpp"
+#include "../../utilities/idf/WorkspaceChangeTracker.hpp"
 
 #include <algorithm>
 
@@ -156,3 +159,172 @@ TEST_F(ModelFixture,ThreeJSForwardTranslator_ConstructionAirBoundary) {
   EXPECT_TRUE(checkIfMaterialExist(materials, "AirWall"));
 
 }
+
+TEST_F(ModelFixture,ThreeJSForwardTranslator_TriangulationCache) {
+
+  ThreeJSForwardTranslator ft;
+
+  Model model = exampleModel();
+
+  ThreeScene scene1 = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(0, ft.errors().size());
+
+  // second translation reuses cached triangulations
+  ThreeScene scene2 = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(0, ft.errors().size());
+
+  ft.clearTriangulationCache();
+  ThreeScene scene3 = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(0, ft.errors().size());
+
+  std::vector<ThreeGeometry> geometries1 = scene1.geometries();
+  std::vector<ThreeGeometry> geometries2 = scene2.geometries();
+  std::vector<ThreeGeometry> geometries3 = scene3.geometries();
+  ASSERT_EQ(geometries1.size(), geometries2.size());
+  ASSERT_EQ(geometries1.size(), geometries3.size());
+  for (size_t i = 0; i < geometries1.size(); ++i){
+    EXPECT_EQ(geometries1[i].uuid(), geometries2[i].uuid());
+    EXPECT_EQ(geometries1[i].data().vertices(), geometries2[i].data().vertices());
+    EXPECT_EQ(geometries1[i].data().faces(), geometries2[i].data().faces());
+    EXPECT_EQ(geometries1[i].data().vertices(), geometries3[i].data().vertices());
+    EXPECT_EQ(geometries1[i].data().faces(), geometries3[i].data().faces());
+  }
+
+  // moving a surface must not return a stale triangulation
+  std::vector<Surface> surfaces = model.getConcreteModelObjects<Surface>();
+  ASSERT_FALSE(surfaces.empty());
+  Point3dVector vertices = surfaces[0].vertices();
+  for (auto& vertex : vertices){
+    vertex = Point3d(vertex.x() + 1.0, vertex.y(), vertex.z());
+  }
+  EXPECT_TRUE(surfaces[0].setVertices(vertices));
+
+  ThreeScene scene4 = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(0, ft.errors().size());
+  boost::optional<ThreeGeometry> moved = scene4.getGeometry(toThreeUUID(toString(surfaces[0].handle())));
+  boost::optional<ThreeGeometry> original = scene1.getGeometry(toThreeUUID(toString(surfaces[0].handle())));
+  ASSERT_TRUE(moved);
+  ASSERT_TRUE(original);
+  EXPECT_NE(original->data().vertices(), moved->data().vertices());
+}
+
+TEST_F(ModelFixture,ThreeJSForwardTranslator_Delta) {
+
+  ThreeJSForwardTranslator ft;
+
+  Model model = exampleModel();
+
+  ThreeScene scene = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(0, ft.errors().size());
+
+  WorkspaceChangeTracker tracker(model);
+
+  // nothing changed
+  ThreeSceneDelta delta = ft.modelToThreeJSDelta(model, scene, tracker.changedHandles(), true);
+  EXPECT_TRUE(delta.empty());
+  tracker.clearState();
+
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  ASSERT_FALSE(spaces.empty());
+  std::vector<Surface> surfaces = spaces[0].surfaces();
+  ASSERT_GE(surfaces.size(), 2u);
+
+  // modify one surface, remove another
+  EXPECT_TRUE(surfaces[0].setName("Renamed Surface"));
+  Handle removedHandle = surfaces[1].handle();
+  std::vector<SubSurface> removedSubSurfaces = surfaces[1].subSurfaces();
+  surfaces[1].remove();
+
+  delta = ft.modelToThreeJSDelta(model, scene, tracker.changedHandles(), true);
+  EXPECT_EQ(0, ft.errors().size());
+  EXPECT_TRUE(delta.addedGeometries().empty());
+  ASSERT_FALSE(delta.modifiedGeometries().empty());
+  EXPECT_EQ(toThreeUUID(toString(surfaces[0].handle())), delta.modifiedGeometries()[0].uuid());
+  EXPECT_EQ("Renamed Surface", delta.modifiedChildren()[0].userData().name());
+  EXPECT_EQ(1u + removedSubSurfaces.size(), delta.removedGeometryIds().size());
+  EXPECT_NE(delta.removedGeometryIds().end(), std::find(delta.removedGeometryIds().begin(), delta.removedGeometryIds().end(), toThreeUUID(toString(removedHandle))));
+
+  // applying the delta matches a full translation
+  ThreeScene updated = delta.apply(scene);
+  ThreeScene full = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(full.geometries().size(), updated.geometries().size());
+  EXPECT_EQ(full.object().children().size(), updated.object().children().size());
+  for (const auto& geometry : full.geometries()){
+    boost::optional<ThreeGeometry> other = updated.getGeometry(geometry.uuid());
+    ASSERT_TRUE(other);
+    EXPECT_EQ(geometry.data().vertices(), other->data().vertices());
+    EXPECT_EQ(geometry.data().faces(), other->data().faces());
+  }
+  tracker.clearState();
+
+  // adding a space adds its surfaces
+  Space newSpace(model);
+  Point3dVector vertices;
+  vertices.push_back(Point3d(0, 10, 0));
+  vertices.push_back(Point3d(10, 10, 0));
+  vertices.push_back(Point3d(10, 0, 0));
+  vertices.push_back(Point3d(0, 0, 0));
+  Surface newSurface(vertices, model);
+  newSurface.setSpace(newSpace);
+
+  delta = ft.modelToThreeJSDelta(model, updated, tracker.changedHandles(), true);
+  ASSERT_EQ(1u, delta.addedGeometries().size());
+  EXPECT_EQ(toThreeUUID(toString(newSurface.handle())), delta.addedGeometries()[0].uuid());
+  EXPECT_TRUE(delta.modifiedGeometries().empty());
+  EXPECT_TRUE(delta.removedGeometryIds().empty());
+  EXPECT_TRUE(ThreeScene::load(delta.apply(updated).toJSON()));
+}
+
+TEST_F(ModelFixture,ThreeJSForwardTranslator_Delta_RemoveSubSurface) {
+
+  ThreeJSForwardTranslator ft;
+
+  Model model = exampleModel();
+
+  ThreeScene scene = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(0, ft.errors().size());
+
+  WorkspaceChangeTracker tracker(model);
+
+  boost::optional<SubSurface> window;
+  for (const auto& subSurface : model.getConcreteModelObjects<SubSurface>()){
+    if (subSurface.surface()){
+      window = subSurface;
+      break;
+    }
+  }
+  ASSERT_TRUE(window);
+  Surface wall = window->surface().get();
+  std::string wallId = toThreeUUID(toString(wall.handle()));
+  std::string windowId = toThreeUUID(toString(window->handle()));
+
+  boost::optional<ThreeGeometry> oldWallGeometry = scene.getGeometry(wallId);
+  ASSERT_TRUE(oldWallGeometry);
+
+  window->remove();
+
+  // the wall loses its hole
+  ThreeSceneDelta delta = ft.modelToThreeJSDelta(model, scene, tracker.changedHandles(), true);
+  EXPECT_EQ(0, ft.errors().size());
+  ASSERT_EQ(1u, delta.removedGeometryIds().size());
+  EXPECT_EQ(windowId, delta.removedGeometryIds()[0]);
+
+  boost::optional<ThreeGeometry> modifiedWallGeometry;
+  for (const auto& geometry : delta.modifiedGeometries()){
+    if (geometry.uuid() == wallId){
+      modifiedWallGeometry = geometry;
+    }
+  }
+  ASSERT_TRUE(modifiedWallGeometry);
+  EXPECT_NE(oldWallGeometry->data().faces(), modifiedWallGeometry->data().faces());
+
+  ThreeScene updated = delta.apply(scene);
+  ThreeScene full = ft.modelToThreeJS(model, true);
+  boost::optional<ThreeGeometry> fullWallGeometry = full.getGeometry(wallId);
+  ASSERT_TRUE(fullWallGeometry);
+  boost::optional<ThreeGeometry> updatedWallGeometry = updated.getGeometry(wallId);
+  ASSERT_TRUE(updatedWallGeometry);
+  EXPECT_EQ(fullWallGeometry->data().vertices(), updatedWallGeometry->data().vertices());
+  EXPECT_EQ(fullWallGeometry->data().faces(), updatedWallGeometry->data().faces());
+  EXPECT_FALSE(updated.getGeometry(windowId));
+}
@@ -55,6 +55,7 @@
 #include "../utilities/core/Containers.hpp"
 #include "../utilities/core/Compare.hpp"
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Tracing.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
 #include "../utilities/units/QuantityConverter.hpp"
 #include <utilities/idd/OS_ComponentData_FieldEnums.hxx>
@@ -412,6 +413,8 @@ void VersionTranslator::setAllowNewerVersions(bool allowNewerVersions)
 boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
                                                                bool isComponent,
                                                                ProgressBar* progressBar) {
+  OS_TRACE_SCOPE("osversion", isComponent ? "VersionTranslator::loadComponent" : "VersionTranslator::loadModel");
+
   m_originalVersion = VersionString("0.0.0");
   m_map.clear();
   m_logSink.setThreadId(std::this_thread::get_id());
@@ -463,6 +466,7 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
   }
 
   // validity checking
+  OS_TRACE_SCOPE("osversion", "VersionTranslator::buildModel");
   Workspace finalWorkspace(finalModel);
   model::Model tempModel(finalWorkspace); // None-level strictness!
   OS_ASSERT(tempModel.strictnessLevel() == StrictnessLevel::None);
@@ -503,6 +507,8 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
 }
 
 void VersionTranslator::initializeMap(std::istream& is) {
+  OS_TRACE_SCOPE("osversion", "VersionTranslator::initializeMap");
+
   // default version is 0.7.0
   VersionString currentVersion("0.7.0");
 
@@ -621,6 +627,7 @@ IddFileAndFactoryWrapper VersionTranslator::getIddFile(const VersionString& vers
 void VersionTranslator::update(const VersionString& startVersion) {
   std::map<VersionString, IdfFile>::const_iterator start = m_map.find(startVersion);
   if (start != m_map.end()) {
+    OS_TRACE_SCOPE("osversion", "VersionTranslator::update from " + startVersion.str());
 
     std::string translatedIdf;
     VersionString lastVersion("0.0.0");
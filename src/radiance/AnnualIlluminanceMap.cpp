@@ -30,29 +30,71 @@
 #include "AnnualIlluminanceMap.hpp"
 #include "HeaderInfo.hpp"
 
-#include <iostream>
-#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
 #include <vector>
 
-#include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
+#include <charconv>
+#include <limits>
 
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 
 using namespace std;
-using namespace boost;
 using namespace openstudio;
 
 namespace openstudio{
 namespace radiance{
 
+  // advances cursor past the next number in [cursor, end) and stores it in value, returns false if there is none
+  static bool scanNumber(const char*& cursor, const char* end, double& value)
+  {
+    while (cursor < end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r')){
+      ++cursor;
+    }
+    if (cursor == end){
+      return false;
+    }
+
+    const char* first = cursor;
+    if (*first == '+'){
+      ++first;
+    }
+
+#if defined(__cpp_lib_to_chars)
+    auto result = std::from_chars(first, end, value);
+    if (result.ec != std::errc() || result.ptr == first){
+      return false;
+    }
+    cursor = result.ptr;
+#else
+    const char* last = first;
+    while (last < end && *last != ' ' && *last != '\t' && *last != '\r'){
+      ++last;
+    }
+    std::string token(first, last);
+    char* parsed = nullptr;
+    value = std::strtod(token.c_str(), &parsed);
+    if (parsed == token.c_str()){
+      return false;
+    }
+    cursor = first + (parsed - token.c_str());
+#endif
+
+    // numbers must be followed by a separator
+    return (cursor == end || *cursor == ' ' || *cursor == '\t' || *cursor == '\r');
+  }
+
   /// default constructor
   AnnualIlluminanceMap::AnnualIlluminanceMap()
+    : m_numTimeSteps(0)
   {}
 
   /// constructor with path
   AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::path& path)
+    : m_numTimeSteps(0)
   {
     init(path);
   }
@@ -65,9 +107,24 @@ namespace radiance{
       return;
     }
 
-    // open file
-    openstudio::filesystem::ifstream file(path);
+    boost::system::error_code ec;
+    if (openstudio::filesystem::file_size(path, ec) == 0 || ec){
+      LOG(Fatal,  "File is empty: '" << toString(path) << "'" );
+      return;
+    }
+
+    try {
+      boost::interprocess::file_mapping mapping(openstudio::toString(path).c_str(), boost::interprocess::read_only);
+      boost::interprocess::mapped_region region(mapping, boost::interprocess::read_only);
+      const char* begin = static_cast<const char*>(region.get_address());
+      parse(begin, begin + region.get_size());
+    } catch (const boost::interprocess::interprocess_exception& e) {
+      LOG(Fatal,  "Unable to map file '" << toString(path) << "': " << e.what());
+    }
+  }
 
+  void AnnualIlluminanceMap::parse(const char* begin, const char* end)
+  {
     // keep track of line number
     unsigned lineNum = 0;
 
@@ -75,38 +132,34 @@ namespace radiance{
     unsigned M=0;
     unsigned N=0;
 
-    // temp string to read file
-    string line;
-
     // lines 1 and 2 are the header lines
-    string line1, line2;
-
-    // this will contain matches to regular expressions
-    smatch matches;
-
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
+    string line1;
 
     // conversion from footcandles to lux
     const double footcandlesToLux(10.76);
 
-    // read the rest of the file line by line
-    while(getline(file, line)){
+    // each line contains the month, day, time (in hours),
+    // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
+    // followed by M*N illuminance points
+    double lineHeader[6];
+
+    const char* lineBegin = begin;
+    while (lineBegin < end){
+      const char* lineEnd = static_cast<const char*>(std::memchr(lineBegin, '\n', end - lineBegin));
+      if (!lineEnd){
+        lineEnd = end;
+      }
       ++lineNum;
 
       if (lineNum == 1){
 
         // save line 1
-        line1 = line;
-
+        line1.assign(lineBegin, lineEnd);
 
       }else if (lineNum == 2){
 
-        // save line 2
-        line2 = line;
-
         // create the header info
-        HeaderInfo headerInfo(line1, line2);
+        HeaderInfo headerInfo(line1, string(lineBegin, lineEnd));
 
         // we can now initialize x and y vectors
         m_xVector = headerInfo.xVector();
@@ -117,68 +170,131 @@ namespace radiance{
 
       }else{
 
-        // each line contains the month, day, time (in hours),
-        // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
-        // followed by M*N illuminance points
+        const char* cursor = lineBegin;
+        unsigned numHeader = 0;
+        while (numHeader < 6 && scanNumber(cursor, lineEnd, lineHeader[numHeader])){
+          ++numHeader;
+        }
 
-        // break the line up by spaces
-        vector<string> lineVector;
-        tokenizer<char_separator<char>, std::string::const_iterator, std::string > tk(line, char_separator<char>(" "));
-        for (tokenizer<char_separator<char>, std::string::const_iterator, std::string >::iterator it(tk.begin()); it!=tk.end(); ++it)
-        {
-           lineVector.push_back(*it);
+        // read the values straight into the next time step, values are ordered with y outer and x inner
+        const std::size_t offset = m_illuminance.size();
+        m_illuminance.resize(offset + static_cast<std::size_t>(M)*N);
+        double* values = m_illuminance.data() + offset;
+
+        unsigned numValues = 0;
+        double value;
+        if (numHeader == 6){
+          while (scanNumber(cursor, lineEnd, value)){
+            if (numValues < M*N){
+              unsigned j = numValues / M;
+              unsigned i = numValues % M;
+              values[i*N + j] = footcandlesToLux*value;
+            }
+            ++numValues;
+          }
         }
 
-        // total number minus 6 standard header items
-        unsigned numValues = lineVector.size() - 6;
+        // skip any trailing separators to detect garbage at the end of the line
+        while (cursor < lineEnd && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r')){
+          ++cursor;
+        }
 
-        if (numValues != M*N){
+        if (numHeader != 6 || cursor != lineEnd || numValues != M*N){
+          m_illuminance.resize(offset);
+          if (numHeader == 0 && cursor == lineEnd){
+            // blank line
+            lineBegin = (lineEnd < end) ? lineEnd + 1 : end;
+            continue;
+          }
           LOG(Fatal,  "Incorrect number of illuminance values read " << numValues << ", expecting " << M*N << ".");
           return;
-        }else{
-
-          MonthOfYear month = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          unsigned day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
-
-          // ignore solar angles and global horizontal for now
+        }
 
-          // make the date time
-          DateTime dateTime(Date(month, day), Time(fracDays));
+        MonthOfYear month = monthOfYear(static_cast<unsigned>(lineHeader[0]));
+        unsigned day = static_cast<unsigned>(lineHeader[1]);
+        double fracDays = lineHeader[2] / 24.0;
 
-          // matrix we are going to read in
-          Matrix illuminanceMap(M,N);
+        // ignore solar angles and global horizontal for now
 
-          // read in the values
-          unsigned index = 6;
-          for (unsigned j = 0; j < N; ++j){
-            for (unsigned i = 0; i < M; ++i){
-              illuminanceMap(i,j) = footcandlesToLux*lexical_cast<double>(lineVector[index]);
-              ++index;
-            }
-          }
+        // make the date time
+        DateTime dateTime(Date(month, day), Time(fracDays));
 
-          m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
+        auto inserted = m_dateTimeIndices.insert(std::make_pair(dateTime, m_numTimeSteps));
+        if (inserted.second){
+          ++m_numTimeSteps;
+        }else{
+          // repeated date time replaces the earlier map
+          std::copy(values, values + static_cast<std::size_t>(M)*N, m_illuminance.data() + static_cast<std::size_t>(inserted.first->second)*M*N);
+          m_illuminance.resize(offset);
         }
+
+        m_dateTimes.push_back(dateTime);
       }
-    }
 
-    // close file
-    file.close();
+      lineBegin = (lineEnd < end) ? lineEnd + 1 : end;
+    }
   }
 
   /// get the illuminance map in lux corresponding to date and time
   openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const
   {
-    auto it = m_dateTimeIlluminanceMap.find(dateTime);
-    if (it != m_dateTimeIlluminanceMap.end()){
-      return it->second;
+    IlluminanceMapView view = illuminanceMapView(dateTime);
+    if (view.empty()){
+      return m_nullIlluminanceMap;
+    }
+
+    // Matrix is row major so the view can be copied directly
+    Matrix result(view.size1(), view.size2());
+    std::copy(view.data(), view.data() + static_cast<std::size_t>(view.size1())*view.size2(), result.data().begin());
+    return result;
+  }
+
+  IlluminanceMapView AnnualIlluminanceMap::illuminanceMapView(const openstudio::DateTime& dateTime) const
+  {
+    auto it = m_dateTimeIndices.find(dateTime);
+    if (it != m_dateTimeIndices.end()){
+      unsigned M = m_xVector.size();
+      unsigned N = m_yVector.size();
+      return IlluminanceMapView(m_illuminance.data() + static_cast<std::size_t>(it->second)*M*N, M, N);
     }
 
-    return m_nullIlluminanceMap;
+    return IlluminanceMapView();
   }
 
+  openstudio::Matrix AnnualIlluminanceMap::daylightAutonomy(double threshold) const
+  {
+    return fractionInRange(threshold, std::numeric_limits<double>::infinity());
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::usefulDaylightIlluminance(double lower, double upper) const
+  {
+    return fractionInRange(lower, upper);
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::fractionInRange(double lower, double upper) const
+  {
+    const std::size_t M = m_xVector.size();
+    const std::size_t N = m_yVector.size();
+    const std::size_t size = M*N;
+
+    Matrix result(M, N, 0.0);
+    if (m_numTimeSteps == 0 || size == 0){
+      return result;
+    }
+
+    // one pass over the contiguous data, the inner loop is branch free so it vectorizes
+    std::vector<double> counts(size, 0.0);
+    const double* values = m_illuminance.data();
+    for (unsigned t = 0; t < m_numTimeSteps; ++t, values += size){
+      for (std::size_t k = 0; k < size; ++k){
+        counts[k] += static_cast<double>((values[k] >= lower) & (values[k] <= upper));
+      }
+    }
+
+    const double scale = 1.0 / m_numTimeSteps;
+    std::transform(counts.begin(), counts.end(), result.data().begin(), [scale](double count) { return count*scale; });
+    return result;
+  }
 
 } // radiance
 } // openstudio
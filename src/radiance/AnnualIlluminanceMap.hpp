@@ -38,19 +38,59 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
 
+#include <map>
+#include <vector>
+
 namespace openstudio{
 namespace radiance{
 
+  /** IlluminanceMapView is a read only view of a single illuminance map stored in an AnnualIlluminanceMap.
+  *   The view does not own its data and is only valid as long as the AnnualIlluminanceMap it came from.
+  */
+  class IlluminanceMapView
+  {
+    public:
+
+      /// default constructor, creates an empty view
+      IlluminanceMapView() : m_data(nullptr), m_size1(0), m_size2(0) {}
+
+      /// constructor from contiguous row major data
+      IlluminanceMapView(const double* data, unsigned size1, unsigned size2) : m_data(data), m_size1(size1), m_size2(size2) {}
+
+      /// number of x points
+      unsigned size1() const {return m_size1;}
+
+      /// number of y points
+      unsigned size2() const {return m_size2;}
+
+      /// true if the view does not reference any data
+      bool empty() const {return (m_data == nullptr);}
+
+      /// illuminance in lux at x point i and y point j
+      double operator()(unsigned i, unsigned j) const {return m_data[i*m_size2 + j];}
+
+      /// pointer to the row major data
+      const double* data() const {return m_data;}
+
+    private:
+
+      const double* m_data;
+      unsigned m_size1;
+      unsigned m_size2;
+  };
+
   /** AnnualIlluminanceMap represents illuminance map for an entire year.
   *   We assume that the output files is from SPOT, with length in meters and illuminance
   *   values in footcandles.  All illuminance values are converted to lux.
+  *
+  *   All illuminance maps are stored in one contiguous array indexed by time step, x point and y point.
   */
   class RADIANCE_API AnnualIlluminanceMap
   {
     private:
 
-      // map of DateTime to Matrix (illuminance map)
-      typedef std::map<openstudio::DateTime, openstudio::Matrix> DateTimeIlluminanceMap;
+      // map of DateTime to time step index in the illuminance array
+      typedef std::map<openstudio::DateTime, unsigned> DateTimeIndexMap;
 
     public:
 
@@ -76,17 +116,33 @@ namespace radiance{
       /// get the illuminance map in lux corresponding to date and time
       openstudio::Matrix illuminanceMap(const openstudio::DateTime& dateTime) const;
 
+      /// get a view of the illuminance map in lux corresponding to date and time without copying, empty if there is no data
+      IlluminanceMapView illuminanceMapView(const openstudio::DateTime& dateTime) const;
+
+      /// get the fraction of time steps at each point where illuminance is at least threshold lux
+      openstudio::Matrix daylightAutonomy(double threshold) const;
+
+      /// get the fraction of time steps at each point where illuminance is between lower and upper lux, inclusive
+      openstudio::Matrix usefulDaylightIlluminance(double lower = 100.0, double upper = 2000.0) const;
+
     private:
 
       REGISTER_LOGGER("radiance.AnnualIlluminanceMap");
 
       void init(const openstudio::path& path);
 
+      void parse(const char* begin, const char* end);
+
+      // fraction of time steps at each point with illuminance in [lower, upper]
+      openstudio::Matrix fractionInRange(double lower, double upper) const;
+
       openstudio::DateTimeVector m_dateTimes;
       openstudio::Vector m_xVector;
       openstudio::Vector m_yVector;
       openstudio::Matrix m_nullIlluminanceMap; // used when there is no data
-      DateTimeIlluminanceMap m_dateTimeIlluminanceMap;
+      DateTimeIndexMap m_dateTimeIndices;
+      std::vector<double> m_illuminance; // time step x M x N
+      unsigned m_numTimeSteps;
   };
 
 } // radiance
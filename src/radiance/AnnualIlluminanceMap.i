@@ -22,6 +22,10 @@
 
 %ignore openstudio::radiance::AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::Path&);
 
+// views reference memory owned by the map, use illuminanceMap instead
+%ignore openstudio::radiance::IlluminanceMapView;
+%ignore openstudio::radiance::AnnualIlluminanceMap::illuminanceMapView;
+
 %include <radiance/AnnualIlluminanceMap.hpp>
 
 #endif //RADIANCE_ANNUALILLUMINANCEMAP_I
@@ -75,6 +75,7 @@
 
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
 #include "../utilities/time/DateTime.hpp"
@@ -95,6 +96,8 @@
 #include <radiance/embedded_files.hxx>
 
 
+#include <charconv>
+#include <cstdio>
 #include <cstring>
 #include <cmath>
 #include <sstream>
@@ -129,30 +132,23 @@ namespace radiance {
   // internal method used to format doubles as strings
   std::string formatString(double t_d, unsigned t_prec)
   {
-    std::stringstream ss;
-    ss << std::setprecision(t_prec) << std::noshowpoint << std::fixed << t_d;
-    std::string s = ss.str();
-
-    /*
-    // truncate 0's from the end
-    int i = s.size() - 1;
-    while (i > 0 && s[i] == '0')
-    {
-      --i;
+    // fixed notation with t_prec digits, same as streaming with std::fixed and std::setprecision
+    // but without constructing a stream for every coordinate
+    char buffer[512];
+#if defined(__cpp_lib_to_chars)
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), t_d, std::chars_format::fixed, (int)t_prec);
+    if (result.ec == std::errc()) {
+      return std::string(buffer, result.ptr);
     }
-
-    if (i > 0)
-    {
-      s.erase(i + 1);
-
-      if (*s.rbegin() == '.')
-      {
-        s.push_back('0');
-      }
+#else
+    int n = std::snprintf(buffer, sizeof(buffer), "%.*f", (int)t_prec, t_d);
+    if (n >= 0 && (size_t)n < sizeof(buffer)) {
+      return std::string(buffer, n);
     }
-    */
-
-    return s;
+#endif
+    std::stringstream ss;
+    ss << std::setprecision(t_prec) << std::noshowpoint << std::fixed << t_d;
+    return ss.str();
   }
 
   // internal method used to format all other types as strings
@@ -164,13 +160,23 @@ namespace radiance {
 
   // basic constructor
   ForwardTranslator::ForwardTranslator()
-    : m_windowGroupId(1) // m_windowGroupId is reserved for uncontrolled
+    : m_skipUnchangedFiles(false), m_windowGroupId(1) // m_windowGroupId is reserved for uncontrolled
   {
     m_logSink.setLogLevel(Warn);
     m_logSink.setChannelRegex(boost::regex("openstudio\\.radiance\\.ForwardTranslator"));
     m_logSink.setThreadId(std::this_thread::get_id());
   }
 
+  void ForwardTranslator::setSkipUnchangedFiles(bool skipUnchangedFiles)
+  {
+    m_skipUnchangedFiles = skipUnchangedFiles;
+  }
+
+  bool ForwardTranslator::skipUnchangedFiles() const
+  {
+    return m_skipUnchangedFiles;
+  }
+
   std::vector<openstudio::path> ForwardTranslator::translateModel(const openstudio::path& outPath, const openstudio::model::Model& model)
   {
     m_model = model.clone(true).cast<openstudio::model::Model>();
@@ -279,7 +285,7 @@ namespace radiance {
 
       LOG(Debug, "Working Directory: " + openstudio::toString(outPath));
 
-      if (openstudio::filesystem::exists(outPath)){
+      if (openstudio::filesystem::exists(outPath) && !m_skipUnchangedFiles){
         openstudio::filesystem::remove_all(outPath);
       }
 
@@ -315,6 +321,21 @@ namespace radiance {
       // get spaces
       buildingSpaces(radDir, building.spaces(), outfiles);
 
+      // remove scene files from an earlier translation that were not written this time
+      if (m_skipUnchangedFiles){
+        std::vector<openstudio::path> staleFiles;
+        for (openstudio::filesystem::recursive_directory_iterator it(radDir / openstudio::toPath("scene")), end; it != end; ++it){
+          if (openstudio::filesystem::is_regular_file(it->path()) &&
+              m_writtenFiles.find(it->path().lexically_normal().generic_string()) == m_writtenFiles.end()){
+            staleFiles.push_back(it->path());
+          }
+        }
+        for (const auto & staleFile : staleFiles){
+          LOG(Debug, "Removing stale scene file '" << toString(staleFile) << "'");
+          openstudio::filesystem::remove(staleFile);
+        }
+      }
+
       // write options files
       std::string dcmatsStringin;
       std::ifstream dcmatfilein(openstudio::toSystemFilename(radDir / openstudio::toPath("materials/materials_dc.rad")));
@@ -508,28 +529,41 @@ namespace radiance {
     // get the current vertices and convert to face coordinates
     Point3dVector surfaceFaceVertices = alignFace.inverse()*surface.vertices();
 
-    // boost polygon wants vertices in clockwise order, faceVertices must be reversed, otherFaceVertices already CCW
-    std::reverse(surfaceFaceVertices.begin(), surfaceFaceVertices.end());
-
     // get the current subsurfaces and convert to face coordinates
     std::vector<std::vector<Point3d> > holes;
     for (const SubSurface& subSurface : surface.subSurfaces()){
-      Point3dVector hole = alignFace.inverse()*subSurface.vertices();
-      std::reverse(hole.begin(), hole.end());
-      holes.push_back(hole);
+      holes.push_back(alignFace.inverse()*subSurface.vertices());
     }
 
-    // perform the subtraction
-    std::vector<std::vector<Point3d> > faceResult = openstudio::subtract(surfaceFaceVertices, holes, 0.01);
+    result = getPolygons(surfaceFaceVertices, holes, buildingTransformation*spaceTransformation*alignFace);
 
-    if (faceResult.empty()) {
+    if (result.empty()) {
       // DLM: is this an error (fail simulation) or a warning?  Should we attempt to put the whole surface in here?
       LOG(Warn, "Failed to create surface polygons for Surface '" << surface.nameString() << "'");
     }
 
+    return result;
+  }
+
+  openstudio::Point3dVectorVector ForwardTranslator::getPolygons(const openstudio::Point3dVector& faceVertices,
+                                                                 const std::vector<openstudio::Point3dVector>& holes,
+                                                                 const openstudio::Transformation& faceToWorld)
+  {
+    openstudio::Point3dVectorVector result;
+
+    // boost polygon wants vertices in clockwise order, faceVertices must be reversed, otherFaceVertices already CCW
+    Point3dVector surfaceFaceVertices(faceVertices.rbegin(), faceVertices.rend());
+    std::vector<std::vector<Point3d> > reversedHoles;
+    for (const Point3dVector& hole : holes){
+      reversedHoles.push_back(Point3dVector(hole.rbegin(), hole.rend()));
+    }
+
+    // perform the subtraction
+    std::vector<std::vector<Point3d> > faceResult = openstudio::subtract(surfaceFaceVertices, reversedHoles, 0.01);
+
     // convert to absolute coordinates
     for (const Point3dVector& face : faceResult) {
-      Point3dVector worldFace = buildingTransformation*spaceTransformation*alignFace*face;
+      Point3dVector worldFace = faceToWorld*face;
       std::reverse(worldFace.begin(), worldFace.end());
       result.push_back(worldFace);
     }
@@ -849,6 +883,34 @@ namespace radiance {
     m_radWindowGroups.clear();
     m_radWindowGroupShades.clear();
 
+    m_windowGroups.clear();
+    m_windowGroupId = 1;
+
+    m_writtenFiles.clear();
+  }
+
+  bool ForwardTranslator::writeFile(const openstudio::path& filename, const std::string& contents)
+  {
+    m_writtenFiles.insert(filename.lexically_normal().generic_string());
+
+    if (m_skipUnchangedFiles && openstudio::filesystem::is_regular_file(filename)){
+      // read in text mode so line endings compare the same way they were written
+      openstudio::filesystem::ifstream existing(filename);
+      if (existing.is_open()){
+        std::string existingContents((std::istreambuf_iterator<char>(existing)), std::istreambuf_iterator<char>());
+        if (existingContents == contents){
+          LOG(Debug, "Skipping unchanged file '" << toString(filename) << "'");
+          return true;
+        }
+      }
+    }
+
+    OFSTREAM file(filename);
+    if (!file.is_open()){
+      return false;
+    }
+    file << contents;
+    return true;
   }
 
   WindowGroup ForwardTranslator::getWindowGroup(const openstudio::Vector3d& outwardNormal, const model::Space& space, const model::ConstructionBase& construction,
@@ -956,15 +1018,14 @@ namespace radiance {
       }
 
       openstudio::path filename = t_radDir / openstudio::toPath("/scene/shading_site.rad");
-      OFSTREAM f(filename);
-      if (f.is_open()){
+      std::string contents;
+      for (const auto & line : siteShadingSurfaces)
+      {
+        contents += line;
+      }
+      if (writeFile(filename, contents)){
         t_outfiles.push_back(filename);
         m_radSceneFiles.push_back(filename);
-
-        for (const auto & line : siteShadingSurfaces)
-        {
-          f << line;
-        }
       }else{
         LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
       }
@@ -1049,25 +1110,86 @@ namespace radiance {
       }
 
       openstudio::path filename = t_radDir / openstudio::toPath("scene/shading_building.rad");
-      OFSTREAM f(filename);
-      if (f.is_open()){
+      std::string contents;
+      for (const auto & line : buildingShadingSurfaces)
+      {
+        contents += line;
+      }
+      if (writeFile(filename, contents)){
         t_outfiles.push_back(filename);
         m_radSceneFiles.push_back(filename);
-        for (const auto & line : buildingShadingSurfaces)
-        {
-          f << line;
-        }
       }else{
         LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
       }
     }
   }
 
+  // subtract the sub surfaces from every surface in the spaces, the model is only read on this thread
+  // and the polygon subtraction, which dominates for models with many windows, runs on all cores
+  static std::map<openstudio::Handle, openstudio::Point3dVectorVector> getSurfacePolygons(const openstudio::model::Model& model,
+      const std::vector<openstudio::model::Space> &spaces)
+  {
+    struct SurfaceJob
+    {
+      openstudio::Handle handle;
+      Point3dVector faceVertices;
+      std::vector<Point3dVector> holes;
+      Transformation faceToWorld;
+      openstudio::Point3dVectorVector result;
+    };
+
+    Transformation buildingTransformation;
+    OptionalBuilding building = model.getOptionalUniqueModelObject<Building>();
+    if (building){
+      buildingTransformation = building->transformation();
+    }
+
+    std::vector<SurfaceJob> jobs;
+    for (const auto & space : spaces)
+    {
+      Transformation spaceToWorld = buildingTransformation*space.transformation();
+      for (const auto & surface : space.surfaces())
+      {
+        if (surface.isAirWall()){
+          continue;
+        }
+        Point3dVector vertices = surface.vertices();
+        Transformation alignFace = Transformation::alignFace(vertices);
+        Transformation faceInverse = alignFace.inverse();
+
+        SurfaceJob job;
+        job.handle = surface.handle();
+        job.faceVertices = faceInverse*vertices;
+        for (const SubSurface& subSurface : surface.subSurfaces()){
+          job.holes.push_back(faceInverse*subSurface.vertices());
+        }
+        job.faceToWorld = spaceToWorld*alignFace;
+        jobs.push_back(job);
+      }
+    }
+
+    parallelFor(jobs.size(), [&jobs](size_t i) {
+      try {
+        jobs[i].result = ForwardTranslator::getPolygons(jobs[i].faceVertices, jobs[i].holes, jobs[i].faceToWorld);
+      } catch (const std::exception&) {
+        // an empty result is reported as a failure by the caller
+      }
+    });
+
+    std::map<openstudio::Handle, openstudio::Point3dVectorVector> result;
+    for (auto & job : jobs){
+      result[job.handle].swap(job.result);
+    }
+    return result;
+  }
+
   void ForwardTranslator::buildingSpaces(const openstudio::path &t_radDir, const std::vector<openstudio::model::Space> &t_spaces,
       std::vector<openstudio::path> &t_outfiles)
   {
     std::vector<std::string> space_names;
 
+    std::map<openstudio::Handle, openstudio::Point3dVectorVector> surfacePolygons = getSurfacePolygons(m_model, t_spaces);
+
 
     for (const auto & space : t_spaces)
     {
@@ -1113,7 +1235,11 @@ namespace radiance {
         }
 
         // create polygon object
-        openstudio::Point3dVectorVector polygons = openstudio::radiance::ForwardTranslator::getPolygons(surface);
+        const openstudio::Point3dVectorVector& polygons = surfacePolygons[surface.handle()];
+        if (polygons.empty()) {
+          // DLM: is this an error (fail simulation) or a warning?  Should we attempt to put the whole surface in here?
+          LOG(Warn, "Failed to create surface polygons for Surface '" << surface.nameString() << "'");
+        }
         for (const openstudio::Point3dVector& polygon : polygons) {
 
           if (!surface.adjacentSurface()) {
@@ -1535,20 +1661,16 @@ namespace radiance {
                   switchableGroup_wgMats = "void " + rMaterial + " " + windowGroup_name + "\n" + matString + "\n";
 
                   openstudio::path filename = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_clear.mat");
-                  OFSTREAM file(filename);
-                  if (file.is_open()){
+                  if (writeFile(filename, switchableGroup_wgMats)){
                     t_outfiles.push_back(filename);
-                    file << switchableGroup_wgMats;
                   } else{
                     LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
                   }
 
                   switchableGroup_wgMats = "void " + rMaterial + " " + windowGroup_name + "_TINTED\n" + matStringTinted + "\n\nvoid alias " + windowGroup_name + " " + windowGroup_name + "_TINTED " + "\n\n";
                   openstudio::path filename2 = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_tinted.mat");
-                  OFSTREAM file2(filename2);
-                  if (file2.is_open()){
+                  if (writeFile(filename2, switchableGroup_wgMats)){
                     t_outfiles.push_back(filename2);
-                    file2 << switchableGroup_wgMats;
                   } else{
                     LOG(Error, "Cannot open file '" << toString(filename2) << "' for writing");
                   }
@@ -1559,10 +1681,8 @@ namespace radiance {
                   std::string wgMat = "";
                   wgMat = "void " + rMaterial + " " + windowGroup_name + "\n" + matString + "\n\n";
                   openstudio::path wgSingleFilename = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + ".mat");
-                  OFSTREAM wgSingleFile(wgSingleFilename);
-                  if (wgSingleFile.is_open()){
+                  if (writeFile(wgSingleFilename, wgMat)){
                     t_outfiles.push_back(wgSingleFilename);
-                    wgSingleFile << wgMat;
                   } else{
                     LOG(Error, "Cannot open file '" << toString(wgSingleFilename) << "' for writing");
                   }
@@ -1640,10 +1760,8 @@ namespace radiance {
                   std::string wgShadeMat = "";
                   wgShadeMat = "void " + rMaterial + " " + windowGroup_name + "_SHADE\n" + matString + "\n\n";
                   openstudio::path wgSingleFilename = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_SHADE.mat");
-                  OFSTREAM wgSingleFile(wgSingleFilename);
-                  if (wgSingleFile.is_open()){
+                  if (writeFile(wgSingleFilename, wgShadeMat)){
                     t_outfiles.push_back(wgSingleFilename);
-                    wgSingleFile << wgShadeMat;
                   } else{
                     LOG(Error, "Cannot open file '" << toString(wgSingleFilename) << "' for writing");
                   }
@@ -2088,167 +2206,159 @@ namespace radiance {
 
       // write geometry
       openstudio::path filename = t_radDir / openstudio::toPath("scene") / openstudio::toPath(space_name + ".rad");
-      OFSTREAM file(filename);
-      if (file.is_open()){
+      if (writeFile(filename, m_radSpaces[space_name])){
         t_outfiles.push_back(filename);
         m_radSceneFiles.push_back(filename);
-        file << m_radSpaces[space_name];
       } else{
         LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
       }
+    }
 
-      for (const auto & windowGroup : m_windowGroups)
-      {
-        std::string windowGroup_name = windowGroup.name();
+    // the window groups and materials collect contributions from every space, so they are written once
+    // after all of the spaces have been processed
 
-        //write windows (and glazed doors)
-        if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end())
-        {
+    // get the Radiance parameters... so we have them.
+    openstudio::model::RadianceParameters radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
 
-          // get the Radiance parameters... so we have them.
-          openstudio::model::RadianceParameters radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
-          if(windowGroup_name != "WG0"){
-            if (radianceParameters.skyDiscretizationResolution() == "146"){
-              LOG(Info, "writing out window group '" + windowGroup_name + "', using Klems sampling basis.");
-            } else if (radianceParameters.skyDiscretizationResolution() == "578"){
-              LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
-            } else if (radianceParameters.skyDiscretizationResolution() == "2306"){
-              LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
-            }
-          }
+    for (const auto & windowGroup : m_windowGroups)
+    {
+      std::string windowGroup_name = windowGroup.name();
 
-          openstudio::path glazefilename = t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad");
-          OFSTREAM glazefile(glazefilename);
-          if (glazefile.is_open()){
-            t_outfiles.push_back(glazefilename);
-            m_radSceneFiles.push_back(glazefilename);
-            glazefile << m_radWindowGroups[windowGroup_name];
-          } else{
-            LOG(Error, "Cannot open file '" << toString(glazefilename) << "' for writing");
+      //write windows (and glazed doors)
+      if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end())
+      {
+        if(windowGroup_name != "WG0"){
+          if (radianceParameters.skyDiscretizationResolution() == "146"){
+            LOG(Info, "writing out window group '" + windowGroup_name + "', using Klems sampling basis.");
+          } else if (radianceParameters.skyDiscretizationResolution() == "578"){
+            LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
+          } else if (radianceParameters.skyDiscretizationResolution() == "2306"){
+            LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
           }
+        }
 
-          if(windowGroup_name != "WG0" && !m_radWindowGroupShades[windowGroup_name].empty()){
-            openstudio::path shadefilename = t_radDir / openstudio::toPath("scene/shades") / openstudio::toPath(windowGroup_name + "_SHADE.rad");
-            OFSTREAM shadefile(shadefilename);
-            if (shadefile.is_open()){
-              t_outfiles.push_back(shadefilename);
-              m_radSceneFiles.push_back(shadefilename);
-              shadefile << m_radWindowGroupShades[windowGroup_name];
-            } else{
-              LOG(Error, "Cannot open file '" << toString(shadefilename) << "' for writing");
-            }
-          }
+        openstudio::path glazefilename = t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad");
+        if (writeFile(glazefilename, m_radWindowGroups[windowGroup_name])){
+          t_outfiles.push_back(glazefilename);
+          m_radSceneFiles.push_back(glazefilename);
+        } else{
+          LOG(Error, "Cannot open file '" << toString(glazefilename) << "' for writing");
+        }
 
-          // write window group control points
-          // only write for controlled window groups
-          if(windowGroup_name != "WG0"){
-            openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts");
-            OFSTREAM file(filename);
-            if (file.is_open()){
-              t_outfiles.push_back(filename);
-              file << windowGroup.windowGroupPoints();
-            } else{
-              LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-            }
+        if(windowGroup_name != "WG0" && !m_radWindowGroupShades[windowGroup_name].empty()){
+          openstudio::path shadefilename = t_radDir / openstudio::toPath("scene/shades") / openstudio::toPath(windowGroup_name + "_SHADE.rad");
+          if (writeFile(shadefilename, m_radWindowGroupShades[windowGroup_name])){
+            t_outfiles.push_back(shadefilename);
+            m_radSceneFiles.push_back(shadefilename);
+          } else{
+            LOG(Error, "Cannot open file '" << toString(shadefilename) << "' for writing");
           }
         }
-      }
-
-      // write radiance materials file
-      m_radMaterials.insert("# OpenStudio Materials File\n\n");
-      openstudio::path materialsfilename = t_radDir / openstudio::toPath("materials/materials.rad");
-      OFSTREAM materialsfile(materialsfilename);
-      if (materialsfile.is_open()){
-        t_outfiles.push_back(materialsfilename);
-        for (const auto & line : m_radMaterials)
-        {
-          materialsfile << line;
-        };
-        for (const auto & line : m_radMixMaterials)
-        {
-          materialsfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materialsfilename) << "' for writing");
-      }
 
-
-      // write radiance DC vmx materials (lights) file
-      m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
-      openstudio::path materials_vmxfilename = t_radDir / openstudio::toPath("materials/materials_vmx.rad");
-      OFSTREAM materials_vmxfile(materials_vmxfilename);
-      if (materials_vmxfile.is_open()){
-        t_outfiles.push_back(materials_vmxfilename);
-        for (const auto & line : m_radMaterialsDC)
-        {
-          materials_vmxfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_vmxfilename) << "' for writing");
+        // write window group control points
+        // only write for controlled window groups
+        if(windowGroup_name != "WG0"){
+          openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts");
+          if (writeFile(filename, windowGroup.windowGroupPoints())){
+            t_outfiles.push_back(filename);
+          } else{
+            LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
+          }
+        }
       }
+    }
 
+    // write radiance materials file
+    m_radMaterials.insert("# OpenStudio Materials File\n\n");
+    openstudio::path materialsfilename = t_radDir / openstudio::toPath("materials/materials.rad");
+    std::string materials;
+    for (const auto & line : m_radMaterials)
+    {
+      materials += line;
+    };
+    for (const auto & line : m_radMixMaterials)
+    {
+      materials += line;
+    };
+    if (writeFile(materialsfilename, materials)){
+      t_outfiles.push_back(materialsfilename);
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materialsfilename) << "' for writing");
+    }
 
-      // write radiance WG0 vmx materials file (blacks out controlled window groups)
-      m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
-      openstudio::path materials_WG0filename = t_radDir / openstudio::toPath("materials/materials_WG0.rad");
-      OFSTREAM materials_WG0file(materials_WG0filename);
-      if (materials_WG0file.is_open()){
-        t_outfiles.push_back(materials_WG0filename);
-        for (const auto & line : m_radMaterialsWG0)
-        {
-          materials_WG0file << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_WG0filename) << "' for writing");
-      }
 
-      // write radiance blackout materials file (blacks out everything)
-      m_radMaterialsSwitchableBase.insert("# OpenStudio Blackout Materials File\n# black out all window and shade materials.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
-      openstudio::path materials_SwitchableBasefilename = t_radDir / openstudio::toPath("materials/materials_blackout.rad");
-      OFSTREAM materials_SwitchableBasefile(materials_SwitchableBasefilename);
-      if (materials_SwitchableBasefile.is_open()){
-        t_outfiles.push_back(materials_SwitchableBasefilename);
-        for (const auto & line : m_radMaterialsSwitchableBase)
-        {
-          materials_SwitchableBasefile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_SwitchableBasefilename) << "' for writing");
-      }
+    // write radiance DC vmx materials (lights) file
+    m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
+    openstudio::path materials_vmxfilename = t_radDir / openstudio::toPath("materials/materials_vmx.rad");
+    std::string materials_vmx;
+    for (const auto & line : m_radMaterialsDC)
+    {
+      materials_vmx += line;
+    };
+    if (writeFile(materials_vmxfilename, materials_vmx)){
+      t_outfiles.push_back(materials_vmxfilename);
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_vmxfilename) << "' for writing");
+    }
 
 
-      // write radiance vmx materials list
-      // format of this file is: window group, bsdf, bsdf
-      m_radDCmats.insert("# OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control type,shade control setpoint,unshaded bsdf,shaded bsdf\n");
-      openstudio::path materials_dcfilename = t_radDir / openstudio::toPath("bsdf/mapping.rad");
-      OFSTREAM materials_dcfile(materials_dcfilename);
-      if (materials_dcfile.is_open()){
-        t_outfiles.push_back(materials_dcfilename);
-        for (const auto & line : m_radDCmats)
-        {
-          materials_dcfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_dcfilename) << "' for writing");
-      }
+    // write radiance WG0 vmx materials file (blacks out controlled window groups)
+    m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
+    openstudio::path materials_WG0filename = t_radDir / openstudio::toPath("materials/materials_WG0.rad");
+    std::string materials_WG0;
+    for (const auto & line : m_radMaterialsWG0)
+    {
+      materials_WG0 += line;
+    };
+    if (writeFile(materials_WG0filename, materials_WG0)){
+      t_outfiles.push_back(materials_WG0filename);
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_WG0filename) << "' for writing");
+    }
 
+    // write radiance blackout materials file (blacks out everything)
+    m_radMaterialsSwitchableBase.insert("# OpenStudio Blackout Materials File\n# black out all window and shade materials.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
+    openstudio::path materials_SwitchableBasefilename = t_radDir / openstudio::toPath("materials/materials_blackout.rad");
+    std::string materials_SwitchableBase;
+    for (const auto & line : m_radMaterialsSwitchableBase)
+    {
+      materials_SwitchableBase += line;
+    };
+    if (writeFile(materials_SwitchableBasefilename, materials_SwitchableBase)){
+      t_outfiles.push_back(materials_SwitchableBasefilename);
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_SwitchableBasefilename) << "' for writing");
+    }
 
-      // write complete scene
-      openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
-      OFSTREAM modelfile(modelfilename);
 
-      if (modelfile.is_open()){
-        t_outfiles.push_back(modelfilename);
+    // write radiance vmx materials list
+    // format of this file is: window group, bsdf, bsdf
+    m_radDCmats.insert("# OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control type,shade control setpoint,unshaded bsdf,shaded bsdf\n");
+    openstudio::path materials_dcfilename = t_radDir / openstudio::toPath("bsdf/mapping.rad");
+    std::string materials_dc;
+    for (const auto & line : m_radDCmats)
+    {
+      materials_dc += line;
+    };
+    if (writeFile(materials_dcfilename, materials_dc)){
+      t_outfiles.push_back(materials_dcfilename);
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_dcfilename) << "' for writing");
+    }
 
-        std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
 
-        for (const auto & filename : uniquePaths)
-        {
-          modelfile << "!xform ./" << openstudio::toString(openstudio::relativePath(filename, t_radDir)) << std::endl;
-        }
-      } else{
-        LOG(Error, "Cannot open file '" << toString(modelfilename) << "' for writing");
-      }
+    // write complete scene
+    openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
+    std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
+    std::string modelContents;
+    for (const auto & filename : uniquePaths)
+    {
+      modelContents += "!xform ./" + openstudio::toString(openstudio::relativePath(filename, t_radDir)) + "\n";
+    }
+    if (writeFile(modelfilename, modelContents)){
+      t_outfiles.push_back(modelfilename);
+    } else{
+      LOG(Error, "Cannot open file '" << toString(modelfilename) << "' for writing");
     }
   }
 
@@ -45,6 +45,7 @@
 
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Vector3d.hpp"
+#include "../utilities/geometry/Transformation.hpp"
 
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
@@ -67,6 +68,15 @@ namespace radiance {
      */
     std::vector<openstudio::path> translateModel(const openstudio::path& outPath, const openstudio::model::Model& model);
 
+    /** If true, translateModel keeps an existing output directory and only rewrites the files whose contents
+     *  changed, so unchanged space, window group and material files keep their timestamps when re-exporting
+     *  after small edits. Scene files left over from an earlier translation are removed. Defaults to false,
+     *  which clears the output directory before translating.
+     */
+    void setSkipUnchangedFiles(bool skipUnchangedFiles);
+
+    bool skipUnchangedFiles() const;
+
     /** Get warning messages generated by the last translation.
      */
     std::vector<LogMessage> warnings() const;
@@ -83,6 +93,12 @@ namespace radiance {
     /// will be in absolute coodinates
     static openstudio::Point3dVectorVector getPolygons(const openstudio::model::Surface& surface);
 
+    /// subtract holes from a polygon given in face coordinates and return the resulting polygons
+    /// transformed by faceToWorld, this does not touch the model so it is safe to call from several threads
+    static openstudio::Point3dVectorVector getPolygons(const openstudio::Point3dVector& faceVertices,
+                                                       const std::vector<openstudio::Point3dVector>& holes,
+                                                       const openstudio::Transformation& faceToWorld);
+
     /// convert subsurface vertices to absolute coodinates
     static openstudio::Point3dVector getPolygon(const openstudio::model::SubSurface& subSurface);
 
@@ -125,6 +141,13 @@ namespace radiance {
 
       void clear();
 
+      // write contents to filename unless skipping unchanged files and the file already has these contents,
+      // returns false if the file could not be opened for writing
+      bool writeFile(const openstudio::path& filename, const std::string& contents);
+
+      bool m_skipUnchangedFiles;
+      std::set<std::string> m_writtenFiles;
+
       // create materials library for model, shared for all Spaces
       std::set<std::string> m_radMaterials;
       std::set<std::string> m_radMixMaterials;
@@ -31,26 +31,32 @@
 
 #include "../utilities/core/Logger.hpp"
 
-#include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
-#include <boost/algorithm/string.hpp>
+#include <cstdlib>
 
 using namespace std;
-using namespace boost;
 using namespace openstudio;
 
 namespace openstudio{
 namespace radiance{
 
+  // reads count whitespace separated numbers from line, returns false if there are not enough of them
+  static bool readNumbers(const std::string& line, double* values, unsigned count)
+  {
+    const char* cursor = line.c_str();
+    for (unsigned i = 0; i < count; ++i){
+      char* end = nullptr;
+      values[i] = std::strtod(cursor, &end);
+      if (end == cursor){
+        return false;
+      }
+      cursor = end;
+    }
+    return true;
+  }
+
   /// header consists of two lines
   HeaderInfo::HeaderInfo(const std::string& line1, const std::string& line2){
 
-    // this will contain matches to regular expressions
-    smatch matches;
-
-    // matches a single number followed by either tabs or spaces
-    string singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
-
     // coordinate system
     Vector origin(3);
     Vector maxX(3);
@@ -62,37 +68,23 @@ namespace radiance{
     // first line defines coordinate system for illuminance map
     // there will be 9 numbers separated by spaces or tabs
     // first 3 are origin point, second 3 are max x, last 3 are max y
-    stringstream coordSystemSS;
-    for (unsigned i = 0; i < 9; ++i){
-      coordSystemSS << singleNumber;
-    }
-    const regex coordSystem(coordSystemSS.str());
-
-    if (regex_search(line1, matches, coordSystem)){
-      origin(0) = lexical_cast<double>( string(matches[1].first, matches[1].second) );
-      origin(1) = lexical_cast<double>( string(matches[2].first, matches[2].second) );
-      origin(2) = lexical_cast<double>( string(matches[3].first, matches[3].second) );
-      maxX(0) = lexical_cast<double>( string(matches[4].first, matches[4].second) );
-      maxX(1) = lexical_cast<double>( string(matches[5].first, matches[5].second) );
-      maxX(2) = lexical_cast<double>( string(matches[6].first, matches[6].second) );
-      maxY(0) = lexical_cast<double>( string(matches[7].first, matches[7].second) );
-      maxY(1) = lexical_cast<double>( string(matches[8].first, matches[8].second) );
-      maxY(2) = lexical_cast<double>( string(matches[9].first, matches[9].second) );
+    double coordSystem[9];
+    if (readNumbers(line1, coordSystem, 9)){
+      for (unsigned i = 0; i < 3; ++i){
+        origin(i) = coordSystem[i];
+        maxX(i) = coordSystem[3 + i];
+        maxY(i) = coordSystem[6 + i];
+      }
     }else{
       LOG(Fatal, "No coordinate system defined in line1: '" << line1 << "'");
     }
 
     // second line defines offsets and spacing
-    stringstream spacingOffsetSS;
-    for (unsigned i = 0; i < 3; ++i){
-      spacingOffsetSS << singleNumber;
-    }
-    const regex spacingOffset(spacingOffsetSS.str());
-
-    if (regex_search(line2, matches, spacingOffset)){
-      xSpacing = lexical_cast<double>( string(matches[1].first, matches[1].second) );
-      ySpacing = lexical_cast<double>( string(matches[2].first, matches[2].second) );
-      offset = lexical_cast<double>( string(matches[3].first, matches[3].second) );
+    double spacingOffset[3];
+    if (readNumbers(line2, spacingOffset, 3)){
+      xSpacing = spacingOffset[0];
+      ySpacing = spacingOffset[1];
+      offset = spacingOffset[2];
     }else{
       LOG(Fatal, "No spacing or offsets defined in line2: '" << line2 << "'");
     }
@@ -33,7 +33,7 @@
 
 #include <resources.hxx>
 
-
+#include "../../utilities/core/Filesystem.hpp"
 
 using namespace std;
 using namespace boost;
@@ -80,3 +80,67 @@ TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap)
 
 }
 
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_Synthetic)
+{
+  // 3 x points and 2 y points, values are in footcandles ordered with y outer and x inner
+  openstudio::path path = toPath("./AnnualIlluminanceMap_Synthetic.ill");
+  {
+    openstudio::filesystem::ofstream file(path);
+    file << "0 0 0 2 0 0 0 0.5 0\n";
+    file << "1 0.5 0\n";
+    file << "1 1 12.0 180 30 1000 1 2 3 4 5 6\n";
+    file << "1 1 13.0 185 31 1000\t100 200 300 400 500 600\r\n";
+    file << "\n";
+  }
+
+  AnnualIlluminanceMap map(path);
+  ASSERT_EQ(3u, map.xVector().size());
+  ASSERT_EQ(2u, map.yVector().size());
+  ASSERT_EQ(2u, map.dateTimes().size());
+
+  openstudio::DateTime noon(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(0.5));
+  openstudio::Matrix illuminance = map.illuminanceMap(noon);
+  ASSERT_EQ(3u, illuminance.size1());
+  ASSERT_EQ(2u, illuminance.size2());
+  EXPECT_DOUBLE_EQ(1*10.76, illuminance(0,0));
+  EXPECT_DOUBLE_EQ(3*10.76, illuminance(2,0));
+  EXPECT_DOUBLE_EQ(4*10.76, illuminance(0,1));
+  EXPECT_DOUBLE_EQ(6*10.76, illuminance(2,1));
+
+  openstudio::DateTime one(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(13.0 / 24.0));
+  IlluminanceMapView view = map.illuminanceMapView(one);
+  ASSERT_FALSE(view.empty());
+  EXPECT_DOUBLE_EQ(200*10.76, view(1,0));
+  EXPECT_DOUBLE_EQ(500*10.76, view(1,1));
+
+  openstudio::DateTime missing(openstudio::Date(openstudio::MonthOfYear::Feb, 1), openstudio::Time(0.5));
+  EXPECT_TRUE(map.illuminanceMapView(missing).empty());
+  EXPECT_EQ(0u, map.illuminanceMap(missing).size1());
+
+  // the first hour is always below 100 lux, the second is above 2000 lux from 300 fc on
+  openstudio::Matrix da = map.daylightAutonomy(100.0);
+  EXPECT_DOUBLE_EQ(0.5, da(0,0));
+  EXPECT_DOUBLE_EQ(0.5, da(2,1));
+
+  openstudio::Matrix udi = map.usefulDaylightIlluminance(100.0, 2500.0);
+  EXPECT_DOUBLE_EQ(0.5, udi(0,0));
+  EXPECT_DOUBLE_EQ(0.5, udi(1,0));
+  EXPECT_DOUBLE_EQ(0.0, udi(2,0));
+  EXPECT_DOUBLE_EQ(0.0, udi(2,1));
+}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_WrongCount)
+{
+  openstudio::path path = toPath("./AnnualIlluminanceMap_WrongCount.ill");
+  {
+    openstudio::filesystem::ofstream file(path);
+    file << "0 0 0 2 0 0 0 0.5 0\n";
+    file << "1 0.5 0\n";
+    file << "1 1 12.0 180 30 1000 1 2 3 4 5 6\n";
+    file << "1 1 13.0 185 31 1000 1 2 3 4 5\n";
+  }
+
+  AnnualIlluminanceMap map(path);
+  ASSERT_EQ(1u, map.dateTimes().size());
+  EXPECT_DOUBLE_EQ(1.0, map.daylightAutonomy(10.0)(0,0));
+}
@@ -233,6 +233,47 @@ TEST(Radiance, ForwardTranslator_ExampleModel)
 }
 
 
+TEST(Radiance, ForwardTranslator_SkipUnchangedFiles)
+{
+  Model model = exampleModel();
+
+  openstudio::path outpath = toPath("./ForwardTranslator_SkipUnchangedFiles");
+  openstudio::filesystem::remove_all(outpath);
+
+  ForwardTranslator ft;
+  ft.setSkipUnchangedFiles(true);
+  std::vector<path> outpaths = ft.translateModel(outpath, model);
+  ASSERT_FALSE(outpaths.empty());
+  EXPECT_TRUE(ft.errors().empty()) << printLogMessages(ft.errors());
+
+  // backdate the scene files so that any rewrite shows up in the timestamp
+  std::time_t past = std::time(nullptr) - 3600;
+  std::vector<path> sceneFiles;
+  for (openstudio::filesystem::recursive_directory_iterator it(outpath / toPath("scene")), end; it != end; ++it){
+    if (openstudio::filesystem::is_regular_file(it->path())){
+      openstudio::filesystem::last_write_time(it->path(), past);
+      sceneFiles.push_back(it->path());
+    }
+  }
+  ASSERT_FALSE(sceneFiles.empty());
+
+  // a scene file that is not part of the model any more should be removed
+  openstudio::path staleFile = outpath / toPath("scene/stale.rad");
+  {
+    openstudio::filesystem::ofstream stale(staleFile);
+    stale << "# stale\n";
+  }
+
+  std::vector<path> outpaths2 = ft.translateModel(outpath, model);
+  EXPECT_EQ(outpaths.size(), outpaths2.size());
+  EXPECT_TRUE(ft.errors().empty()) << printLogMessages(ft.errors());
+  for (const auto & sceneFile : sceneFiles){
+    ASSERT_TRUE(openstudio::filesystem::exists(sceneFile)) << toString(sceneFile);
+    EXPECT_EQ(past, openstudio::filesystem::last_write_time(sceneFile)) << toString(sceneFile);
+  }
+  EXPECT_FALSE(openstudio::filesystem::exists(staleFile));
+}
+
 TEST(Radiance, ForwardTranslator_ExampleModelWithShadingControl)
 {
   Model model = exampleModel();
@@ -355,4 +396,8 @@ TEST(Radiance, ForwardTranslator_formatString)
   EXPECT_EQ("0", formatString(0.4412345, 0));
   EXPECT_EQ("0.4", formatString(0.4412345, 1));
   EXPECT_EQ("0.44", formatString(0.4412345, 2));
+
+  EXPECT_EQ("-2.500", formatString(-2.5, 3));
+  EXPECT_EQ("0.100000000000000", formatString(0.1));
+  EXPECT_EQ("-12.345678901234500", formatString(-12.3456789012345));
 }
@@ -0,0 +1,93 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef UTILITIES_BENCHMARK_BENCHMARKHELPERS_HPP
+#define UTILITIES_BENCHMARK_BENCHMARKHELPERS_HPP
+
+#include "../core/System.hpp"
+#include "../sql/SqlFile.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace benchmark_helpers {
+
+  /// records the peak resident memory of the process so far, in MB, as a counter on state
+  /// this is a process wide high-water mark, it only describes this benchmark if the process runs no other
+  /// benchmark, developer/ruby/RunBenchmarks.rb runs each benchmark in its own process for this reason
+  inline void setPeakMemoryCounter(benchmark::State& state) {
+    state.counters["peak_memory_MB"] = benchmark::Counter(static_cast<double>(System::peakMemoryUsage()) / (1024.0 * 1024.0));
+  }
+
+  /// one row of the Initialization Summary Component Sizing Information table
+  struct ComponentSizingRow {
+    std::string componentName;
+    std::string description;
+    std::string value;
+  };
+
+  /// appends rows to the Component Sizing Information table of sql, as EnergyPlus reports them
+  inline void insertComponentSizingRows(SqlFile& sql, const std::vector<ComponentSizingRow>& rows) {
+    int stringIndex = sql.execAndReturnFirstInt("SELECT COALESCE(MAX(StringIndex), 0) FROM Strings").get_value_or(0);
+    int tabularDataIndex = sql.execAndReturnFirstInt("SELECT COALESCE(MAX(TabularDataIndex), 0) FROM TabularData").get_value_or(0);
+    auto addString = [&](const std::string& value) {
+      sql.execute("INSERT INTO Strings (StringIndex, StringTypeIndex, Value) VALUES (" + std::to_string(++stringIndex) + ", 1, '" + value + "')");
+      return stringIndex;
+    };
+
+    sql.execute("BEGIN");
+    int reportName = addString("Initialization Summary");
+    int reportFor = addString("Entire Facility");
+    int tableName = addString("Component Sizing Information");
+    int units = addString("");
+    int componentName = addString("Component Name");
+    int description = addString("Description");
+    int value = addString("Value");
+    for (const ComponentSizingRow& row : rows) {
+      int rowName = addString(std::to_string(tabularDataIndex));
+      for (const auto& cell : {std::make_pair(componentName, row.componentName), std::make_pair(description, row.description), std::make_pair(value, row.value)}) {
+        std::stringstream ss;
+        ss << "INSERT INTO TabularData (TabularDataIndex, ReportNameIndex, ReportForStringIndex, TableNameIndex, RowNameIndex, ColumnNameIndex, UnitsIndex, SimulationIndex, RowId, ColumnId, Value) VALUES ("
+           << ++tabularDataIndex << ", " << reportName << ", " << reportFor << ", " << tableName << ", " << rowName << ", " << cell.first << ", " << units
+           << ", 1, 0, 0, '" << cell.second << "')";
+        sql.execute(ss.str());
+      }
+    }
+    sql.execute("COMMIT");
+  }
+
+} // benchmark_helpers
+} // openstudio
+
+#endif // UTILITIES_BENCHMARK_BENCHMARKHELPERS_HPP
@@ -0,0 +1,128 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <benchmark/benchmark.h>
+#include "BenchmarkHelpers.hpp"
+
+#include "../idf/IdfFile.hpp"
+#include "../idf/Workspace.hpp"
+#include "../idf/WorkspaceObject.hpp"
+
+#include <utilities/idd/IddEnums.hxx>
+
+#include <sstream>
+#include <string>
+
+using namespace openstudio;
+
+namespace {
+
+  // text of an EnergyPlus IDF with numZones box shaped zones of six surfaces each
+  std::string syntheticIdfText(int numZones) {
+    std::stringstream ss;
+    ss << "Version,\n  9.3;\n\n";
+    for (int i = 0; i < numZones; ++i) {
+      double x = 10.0 * i;
+      ss << "Zone,\n  Zone " << i << ";\n\n";
+      auto surface = [&](const std::string& name, const std::string& type, const std::string& vertices) {
+        ss << "BuildingSurface:Detailed,\n"
+           << "  Zone " << i << " " << name << ",\n"
+           << "  " << type << ",\n"
+           << "  ,\n"
+           << "  Zone " << i << ",\n"
+           << "  Outdoors,\n"
+           << "  ,\n"
+           << "  SunExposed,\n"
+           << "  WindExposed,\n"
+           << "  autocalculate,\n"
+           << "  4,\n"
+           << vertices << "\n\n";
+      };
+      auto vertex = [&](double vx, double vy, double vz, bool last) {
+        std::stringstream v;
+        v << "  " << vx << ", " << vy << ", " << vz << (last ? ";" : ",\n");
+        return v.str();
+      };
+      surface("Floor", "Floor", vertex(x, 10, 0, false) + vertex(x + 10, 10, 0, false) + vertex(x + 10, 0, 0, false) + vertex(x, 0, 0, true));
+      surface("Roof", "Roof", vertex(x, 0, 3, false) + vertex(x + 10, 0, 3, false) + vertex(x + 10, 10, 3, false) + vertex(x, 10, 3, true));
+      surface("South Wall", "Wall", vertex(x, 0, 3, false) + vertex(x, 0, 0, false) + vertex(x + 10, 0, 0, false) + vertex(x + 10, 0, 3, true));
+      surface("East Wall", "Wall", vertex(x + 10, 0, 3, false) + vertex(x + 10, 0, 0, false) + vertex(x + 10, 10, 0, false) + vertex(x + 10, 10, 3, true));
+      surface("North Wall", "Wall", vertex(x + 10, 10, 3, false) + vertex(x + 10, 10, 0, false) + vertex(x, 10, 0, false) + vertex(x, 10, 3, true));
+      surface("West Wall", "Wall", vertex(x, 10, 3, false) + vertex(x, 10, 0, false) + vertex(x, 0, 0, false) + vertex(x, 0, 3, true));
+    }
+    return ss.str();
+  }
+
+}
+
+static void BM_IdfFileLoad(benchmark::State& state) {
+  std::string text = syntheticIdfText(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    std::istringstream is(text);
+    boost::optional<IdfFile> idfFile = IdfFile::load(is, IddFileType::EnergyPlus);
+    benchmark::DoNotOptimize(idfFile);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(text.size()));
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_IdfFileLoad)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMillisecond);
+
+static void BM_IdfFilePrint(benchmark::State& state) {
+  std::istringstream is(syntheticIdfText(static_cast<int>(state.range(0))));
+  boost::optional<IdfFile> idfFile = IdfFile::load(is, IddFileType::EnergyPlus);
+  if (!idfFile) {
+    state.SkipWithError("Unable to load synthetic IDF");
+    return;
+  }
+  for (auto _ : state) {
+    std::stringstream os;
+    idfFile->print(os);
+    benchmark::DoNotOptimize(os);
+  }
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_IdfFilePrint)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMillisecond);
+
+static void BM_WorkspaceAddIdfObjects(benchmark::State& state) {
+  std::istringstream is(syntheticIdfText(static_cast<int>(state.range(0))));
+  boost::optional<IdfFile> idfFile = IdfFile::load(is, IddFileType::EnergyPlus);
+  if (!idfFile) {
+    state.SkipWithError("Unable to load synthetic IDF");
+    return;
+  }
+  std::vector<IdfObject> objects = idfFile->objects();
+  for (auto _ : state) {
+    Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+    workspace.addObjects(objects);
+    benchmark::DoNotOptimize(workspace);
+  }
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_WorkspaceAddIdfObjects)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,184 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <benchmark/benchmark.h>
+#include "BenchmarkHelpers.hpp"
+
+#include "../sql/SqlFile.hpp"
+#include "../core/Path.hpp"
+#include "../core/Filesystem.hpp"
+#include "../data/DataEnums.hpp"
+#include "../data/TimeSeries.hpp"
+#include "../data/Vector.hpp"
+#include "../filetypes/EpwFile.hpp"
+#include "../time/Calendar.hpp"
+#include "../time/Date.hpp"
+
+#include <resources.hxx>
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace openstudio;
+
+namespace {
+
+  std::string zoneName(int i) {
+    return "ZONE " + std::to_string(i);
+  }
+
+  // writes, once per size, an sql file with a week of hourly zone temperatures for numZones zones
+  // and four Component Sizing Information rows per zone, and returns its path
+  openstudio::path syntheticSqlFile(int numZones) {
+    openstudio::path p = openstudio::tempDir() / openstudio::toPath("OpenStudioBenchmark_" + std::to_string(numZones) + ".sql");
+    static std::map<int, bool> written;
+    if (written[numZones]) {
+      return p;
+    }
+    if (openstudio::filesystem::exists(p)) {
+      openstudio::filesystem::remove(p);
+    }
+
+    Calendar c(2012);
+    SqlFile sql(p, EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")), DateTime::now(), c);
+
+    std::vector<double> values(24 * 7);
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = 20.0 + static_cast<double>(i % 24) / 4.0;
+    }
+    TimeSeries timeSeries(c.startDate(), Time(0, 1), createVector(values), "C");
+
+    for (int i = 0; i < numZones; ++i) {
+      sql.insertTimeSeriesData("Average", "Zone", "Zone", zoneName(i), "Zone Mean Air Temperature", ReportingFrequency::Hourly,
+                               boost::optional<std::string>(), "C", timeSeries);
+    }
+
+    const std::vector<std::string> descriptions{"Design Size Rated Air Flow Rate [m3/s]", "Design Size Gross Rated Total Cooling Capacity [W]",
+                                                "Design Size Maximum Flow Rate [m3/s]", "Design Size Nominal Capacity [W]"};
+    std::vector<benchmark_helpers::ComponentSizingRow> rows;
+    for (int i = 0; i < numZones; ++i) {
+      for (size_t j = 0; j < descriptions.size(); ++j) {
+        rows.push_back({zoneName(i) + " COIL", descriptions[j], std::to_string(1.0 + i + j)});
+      }
+    }
+    benchmark_helpers::insertComponentSizingRows(sql, rows);
+
+    written[numZones] = true;
+    return p;
+  }
+
+}
+
+static void BM_SqlFileOpen(benchmark::State& state) {
+  openstudio::path p = syntheticSqlFile(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    SqlFile sql(p);
+    benchmark::DoNotOptimize(sql.connectionOpen());
+  }
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_SqlFileOpen)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond);
+
+static void BM_SqlFileTimeSeries(benchmark::State& state) {
+  int numZones = static_cast<int>(state.range(0));
+  SqlFile sql(syntheticSqlFile(numZones));
+  std::vector<std::string> envPeriods = sql.availableEnvPeriods();
+  if (envPeriods.empty()) {
+    state.SkipWithError("No environment period in synthetic sql file");
+    return;
+  }
+  for (auto _ : state) {
+    double total = 0.0;
+    for (int i = 0; i < numZones; ++i) {
+      boost::optional<TimeSeries> ts = sql.timeSeries(envPeriods[0], "Hourly", "Zone Mean Air Temperature", zoneName(i));
+      if (ts) {
+        total += ts->values()[0];
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * numZones);
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_SqlFileTimeSeries)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond);
+
+static void BM_SqlFileComponentSizingValue(benchmark::State& state) {
+  int numZones = static_cast<int>(state.range(0));
+  openstudio::path p = syntheticSqlFile(numZones);
+  for (auto _ : state) {
+    // a fresh file each time, as when sizing values are applied to a model after a run
+    SqlFile sql(p);
+    double total = 0.0;
+    for (int i = 0; i < numZones; ++i) {
+      if (boost::optional<double> value = sql.componentSizingValue(zoneName(i) + " COIL", "Design Size Nominal Capacity [W]")) {
+        total += *value;
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * numZones);
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_SqlFileComponentSizingValue)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond);
+
+// the same lookups with the per component queries getAutosizedValue ran before SqlFile indexed the
+// Component Sizing Information table, kept as the baseline for BM_SqlFileComponentSizingValue
+static void BM_SqlFileComponentSizingQueries(benchmark::State& state) {
+  int numZones = static_cast<int>(state.range(0));
+  openstudio::path p = syntheticSqlFile(numZones);
+  const std::string table = "FROM tabulardatawithstrings WHERE ReportName='Initialization Summary' AND ReportForString='Entire Facility' "
+                            "AND TableName='Component Sizing Information' ";
+  const std::string description = "Design Size Nominal Capacity [W]";
+  for (auto _ : state) {
+    SqlFile sql(p);
+    double total = 0.0;
+    for (int i = 0; i < numZones; ++i) {
+      boost::optional<std::vector<std::string>> rowNames = sql.execAndReturnVectorOfString("SELECT RowName " + table + "AND Value='" + zoneName(i) + " COIL'");
+      if (!rowNames) {
+        continue;
+      }
+      for (const std::string& rowName : *rowNames) {
+        if (!sql.execAndReturnFirstString("SELECT Value " + table + "AND RowName='" + rowName + "' AND Value='" + description + "'")) {
+          continue;
+        }
+        if (boost::optional<double> value = sql.execAndReturnFirstDouble("SELECT Value " + table + "AND ColumnName='Value' AND RowName='" + rowName + "'")) {
+          total += *value;
+          break;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * numZones);
+  benchmark_helpers::setPeakMemoryCounter(state);
+}
+BENCHMARK(BM_SqlFileComponentSizingQueries)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond);
@@ -28,8 +28,13 @@
 ***********************************************************************************************************************/
 
 #include "Checksum.hpp"
+#include "ParallelFor.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
+#include <vector>
 
 #include <boost/crc.hpp>
 
@@ -38,51 +43,125 @@ namespace openstudio {
 
   namespace detail {
 
-    bool checksumIgnore(char c)
+    // the only character left out of checksums, so that files checksum the same with either line ending
+    const char checksumIgnoredChar = '\r';
+
+    // Slicing-by-8 tables for the reflected CRC-32 polynomial used by boost::crc_32_type
+    struct Crc32Tables
+    {
+      Crc32Tables()
+      {
+        for (unsigned i = 0; i < 256; ++i) {
+          std::uint32_t crc = i;
+          for (unsigned j = 0; j < 8; ++j) {
+            crc = (crc & 1u) ? ((crc >> 1) ^ 0xEDB88320u) : (crc >> 1);
+          }
+          table[0][i] = crc;
+        }
+        for (unsigned i = 0; i < 256; ++i) {
+          for (unsigned k = 1; k < 8; ++k) {
+            table[k][i] = (table[k-1][i] >> 8) ^ table[0][table[k-1][i] & 0xFFu];
+          }
+        }
+      }
+
+      std::uint32_t table[8][256];
+    };
+
+    const Crc32Tables& crc32Tables()
+    {
+      static const Crc32Tables tables;
+      return tables;
+    }
+
+    inline std::uint32_t readLittleEndian32(const unsigned char* p)
     {
-      // ignore all whitespace
-      //bool result = (c == ' ' || c == '\t' || c == '\n' ||  c == '\v' || c == '\f' || c == '\r');
+      return static_cast<std::uint32_t>(p[0]) |
+             (static_cast<std::uint32_t>(p[1]) << 8) |
+             (static_cast<std::uint32_t>(p[2]) << 16) |
+             (static_cast<std::uint32_t>(p[3]) << 24);
+    }
+
+    // process a block with no ignored characters, crc is the running (pre-inverted) register
+    std::uint32_t crc32Update(std::uint32_t crc, const unsigned char* p, size_t n)
+    {
+      const auto& t = crc32Tables().table;
+
+      while (n >= 8) {
+        std::uint32_t one = readLittleEndian32(p) ^ crc;
+        std::uint32_t two = readLittleEndian32(p + 4);
+        crc = t[7][one & 0xFFu] ^ t[6][(one >> 8) & 0xFFu] ^ t[5][(one >> 16) & 0xFFu] ^ t[4][one >> 24] ^
+              t[3][two & 0xFFu] ^ t[2][(two >> 8) & 0xFFu] ^ t[1][(two >> 16) & 0xFFu] ^ t[0][two >> 24];
+        p += 8;
+        n -= 8;
+      }
 
-      // ignore just line feed
-      bool result = (c == '\r');
+      while (n > 0) {
+        crc = t[0][(crc ^ *p) & 0xFFu] ^ (crc >> 8);
+        ++p;
+        --n;
+      }
 
-      return result;
+      return crc;
+    }
+
+    /// Accumulates the checksum of a byte stream, skipping checksumIgnoredChar.
+    class ChecksumAccumulator
+    {
+     public:
+      ChecksumAccumulator()
+        : m_crc(0xFFFFFFFFu)
+      {}
+
+      void process(const char* data, size_t n)
+      {
+        const char* end = data + n;
+        while (data < end) {
+          const char* ignored = static_cast<const char*>(std::memchr(data, checksumIgnoredChar, end - data));
+          const char* blockEnd = ignored ? ignored : end;
+          m_crc = crc32Update(m_crc, reinterpret_cast<const unsigned char*>(data), blockEnd - data);
+          data = ignored ? ignored + 1 : end;
+        }
+      }
+
+      std::string result() const
+      {
+        std::stringstream ss;
+        ss << std::hex << std::uppercase << (m_crc ^ 0xFFFFFFFFu);
+        std::string result = "00000000";
+        std::string checksum = ss.str();
+        result.replace(8-checksum.size(), checksum.size(), checksum);
+        return result;
+      }
+
+     private:
+      std::uint32_t m_crc;
+    };
+
+    std::string checksum(std::istream& is, size_t bufferSize)
+    {
+      ChecksumAccumulator accumulator;
+      std::vector<char> buffer(bufferSize);
+      do{
+        is.read(buffer.data(), buffer.size());
+        accumulator.process(buffer.data(), static_cast<size_t>(is.gcount()));
+      } while ( is );
+      return accumulator.result();
     }
   }
 
   /// return 8 character hex checksum of string
   std::string checksum(const std::string& s)
   {
-    std::stringstream ss(s);
-    return checksum(ss);
+    openstudio::detail::ChecksumAccumulator accumulator;
+    accumulator.process(s.data(), s.size());
+    return accumulator.result();
   }
 
   /// return 8 character hex checksum of istream
   std::string checksum(std::istream& is)
   {
-    boost::crc_32_type  crc;
-    do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
-      is.read(buffer, n);
-      std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
-
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
-
-      crc.process_bytes(str.c_str(), stringSize);
-    } while ( is );
-
-    std::stringstream ss;
-    ss << std::hex << std::uppercase << crc.checksum();
-    std::string result = "00000000";
-    std::string checksum = ss.str();
-    result.replace(8-checksum.size(), checksum.size(), checksum);
-
-    return result;
+    return openstudio::detail::checksum(is, 64 * 1024);
   }
 
   /// return 8 character hex checksum of file contents
@@ -92,13 +171,26 @@ namespace openstudio {
     try{
       openstudio::filesystem::ifstream  ifs(p, std::ios_base::binary );
       if ( ifs ){
-        result = checksum(ifs);
+        // read files in large blocks, most measure files and models fit in a single read
+        result = openstudio::detail::checksum(ifs, 1024 * 1024);
       }
     }catch(...){
     }
     return result;
   }
 
+  std::vector<std::string> checksums(const std::vector<path>& paths)
+  {
+    std::vector<std::string> result(paths.size());
+
+    // file sizes vary a lot, parallelFor hands out files one at a time
+    parallelFor(paths.size(), [&paths, &result](size_t i) {
+      result[i] = checksum(paths[i]);
+    });
+
+    return result;
+  }
+
   int crc16(const char *ptr, int count) {
     // Simulate CRC-CCITT
     boost::crc_basic<16>  crc_ccitt1(0x1021, 0xFFFF, 0, false, false);
@@ -35,6 +35,7 @@
 
 #include <string>
 #include <ostream>
+#include <vector>
 
 namespace openstudio {
 
@@ -47,6 +48,9 @@ namespace openstudio {
   /// return 8 character hex checksum of file contents
   UTILITIES_API std::string checksum(const path& p);
 
+  /// return 8 character hex checksums of the contents of each file, files are read in parallel
+  UTILITIES_API std::vector<std::string> checksums(const std::vector<path>& paths);
+
   /// returns the CRC-16 checksum of the first len bytes of data.  Replaces Qt implementation qChecksum.
   UTILITIES_API int crc16(const char *ptr, int count);
 
@@ -57,6 +57,7 @@
 // DLM@20110107: this is causing issues for C#
 #if defined(SWIGRUBY) || defined(SWIGJAVASCRIPT)
 %include <utilities/core/System.i>
+%include <utilities/core/Tracing.i>
 #endif
 
 %template(FileReferenceTypeVector) std::vector<openstudio::FileReferenceType>;
@@ -52,6 +52,7 @@ namespace openstudio{
 
     LogSink_Impl::~LogSink_Impl()
     {
+      LoggerSingleton::removeSinkLogLevel(m_sink);
     }
 
     bool LogSink_Impl::isEnabled() const
@@ -209,6 +210,7 @@ namespace openstudio{
       if (m_logLevel){
         filterLogLevel = *m_logLevel;
       }
+      LoggerSingleton::setSinkLogLevel(m_sink, filterLogLevel);
 
       boost::regex filterChannelRegex(".*");
       if (m_channelRegex){
@@ -34,17 +34,97 @@
 
 #include <boost/core/null_deleter.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
 namespace sinks = boost::log::sinks;
 namespace keywords = boost::log::keywords;
 
 namespace openstudio{
 
+  namespace {
+
+    // Tracks the lowest level accepted by any enabled sink so that LOG_FREE can skip formatting
+    // messages nobody will see. Channel and thread filters are left to the sinks, so this is only
+    // a lower bound. Kept apart from LoggerSingleton because sinks are configured while the
+    // singleton is being constructed, and never destroyed so sinks may outlive static destruction.
+    class LogLevelGate {
+     public:
+
+      void setSinkLogLevel(const LogSinkBackend* sink, LogLevel logLevel)
+      {
+        std::lock_guard<std::mutex> l{m_mutex};
+        m_sinkLogLevels[sink] = logLevel;
+        update();
+      }
+
+      void removeSinkLogLevel(const LogSinkBackend* sink)
+      {
+        std::lock_guard<std::mutex> l{m_mutex};
+        // a sink that is still enabled lives on in the logging core with its last filter
+        if (m_enabledSinks.find(sink) == m_enabledSinks.end()) {
+          m_sinkLogLevels.erase(sink);
+        }
+      }
+
+      void setSinkEnabled(const LogSinkBackend* sink, bool enabled)
+      {
+        std::lock_guard<std::mutex> l{m_mutex};
+        if (enabled) {
+          m_enabledSinks.insert(sink);
+        } else {
+          m_enabledSinks.erase(sink);
+        }
+        update();
+      }
+
+      bool enabled(LogLevel level) const
+      {
+        return level >= m_minLogLevel.load(std::memory_order_relaxed);
+      }
+
+     private:
+
+      void update()
+      {
+        // sinks without a level accept everything, and so does the logging core when it has no sinks
+        int minLogLevel = m_enabledSinks.empty() ? Trace : Fatal;
+        for (const LogSinkBackend* sink : m_enabledSinks) {
+          auto it = m_sinkLogLevels.find(sink);
+          minLogLevel = std::min<int>(minLogLevel, (it == m_sinkLogLevels.end()) ? Trace : it->second);
+        }
+        m_minLogLevel.store(minLogLevel, std::memory_order_relaxed);
+      }
+
+      std::mutex m_mutex;
+      std::map<const LogSinkBackend*, LogLevel> m_sinkLogLevels;
+      std::set<const LogSinkBackend*> m_enabledSinks;
+      std::atomic<int> m_minLogLevel{Trace};
+    };
+
+    LogLevelGate& logLevelGate()
+    {
+      static auto* gate = new LogLevelGate();
+      return *gate;
+    }
+
+  }
+
   /// convenience function for SWIG, prefer macros in C++
   void logFree(LogLevel level, const std::string& channel, const std::string& message)
   {
     BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
   }
 
+  bool logLevelEnabled(LogLevel level)
+  {
+    // the singleton adds the standard out sink when it is constructed
+    static const bool loggerConstructed = (Logger::instance(), true);
+    (void)loggerConstructed;
+    return logLevelGate().enabled(level);
+  }
+
   LoggerSingleton::LoggerSingleton()
   {
     // Make current thread id attribute available to logging
@@ -130,6 +210,7 @@ namespace openstudio{
       std::unique_lock l2{m_mutex};
 
       m_sinks.insert(sink);
+      logLevelGate().setSinkEnabled(sink.get(), true);
 
       // Register the sink in the logging core
       boost::log::core::get()->add_sink(sink);
@@ -152,7 +233,18 @@ namespace openstudio{
 
       // Register the sink in the logging core
       boost::log::core::get()->remove_sink(sink);
+      logLevelGate().setSinkEnabled(sink.get(), false);
     }
   }
 
+  void LoggerSingleton::setSinkLogLevel(const boost::shared_ptr<LogSinkBackend>& sink, LogLevel logLevel)
+  {
+    logLevelGate().setSinkLogLevel(sink.get(), logLevel);
+  }
+
+  void LoggerSingleton::removeSinkLogLevel(const boost::shared_ptr<LogSinkBackend>& sink)
+  {
+    logLevelGate().removeSinkLogLevel(sink.get());
+  }
+
 } // openstudio
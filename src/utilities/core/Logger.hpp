@@ -56,12 +56,19 @@
 #define LOG_AND_THROW(__message__) \
   LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
+/// messages below this level are compiled out of LOG and LOG_FREE, e.g. define as -1 to strip Trace and Debug
+#ifndef OPENSTUDIO_MIN_LOG_LEVEL
+#define OPENSTUDIO_MIN_LOG_LEVEL -3
+#endif
+
+/// log a message from outside a registered class, the message is only formatted if some sink may accept it
 #define LOG_FREE(__level__, __channel__, __message__) \
   { \
-    std::stringstream _ss1; \
-    _ss1 << __message__; \
-    openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    if (((__level__) >= OPENSTUDIO_MIN_LOG_LEVEL) && openstudio::logLevelEnabled(__level__)) { \
+      std::stringstream _ss1; \
+      _ss1 << __message__; \
+      openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    } \
   }
 
 /// log a message from outside a registered class and throw an exception
@@ -78,6 +85,9 @@ namespace openstudio{
   /// convenience function for SWIG, prefer macros in C++
   UTILITIES_API void logFree(LogLevel level, const std::string& channel, const std::string& message);
 
+  /// false if no enabled sink accepts messages at level, checked by the LOG macros before formatting
+  UTILITIES_API bool logLevelEnabled(LogLevel level);
+
   /** Singleton logger class.  Singleton Logger object maintains logging state throughout
    *   program execution.
    */
@@ -113,6 +123,12 @@ namespace openstudio{
     /// removes a sink to the logging core, equivalent to logSink.disable()
     void removeSink(boost::shared_ptr<LogSinkBackend> sink);
 
+    /// records the lowest level sink accepts, static so sinks may be configured while the singleton is constructed
+    static void setSinkLogLevel(const boost::shared_ptr<LogSinkBackend>& sink, LogLevel logLevel);
+
+    /// forgets the level of sink unless it is still enabled, called when the sink is destroyed
+    static void removeSinkLogLevel(const boost::shared_ptr<LogSinkBackend>& sink);
+
    private:
 
     /// private constructor
@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ParallelFor.hpp"
+#include "System.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace openstudio {
+
+  void parallelFor(size_t n, const std::function<void (size_t)>& f, unsigned numThreads)
+  {
+    if (numThreads == 0) {
+      numThreads = System::numberOfProcessors();
+    }
+    size_t numWorkers = std::min(static_cast<size_t>(numThreads), n);
+    if (numWorkers <= 1) {
+      for (size_t i = 0; i < n; ++i) {
+        f(i);
+      }
+      return;
+    }
+
+    std::atomic<size_t> next(0);
+    std::mutex errorMutex;
+    size_t errorIndex = n;
+    std::exception_ptr error;
+
+    auto work = [&]() {
+      for (size_t i = next++; i < n; i = next++) {
+        try {
+          f(i);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(errorMutex);
+          if (i < errorIndex) {
+            errorIndex = i;
+            error = std::current_exception();
+          }
+          next = n;
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    try {
+      threads.reserve(numWorkers - 1);
+      for (size_t t = 1; t < numWorkers; ++t) {
+        threads.emplace_back(work);
+      }
+    } catch (...) {
+      // joinable threads must not be destroyed, stop handing out indices and wait for the started ones
+      next = n;
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+      throw;
+    }
+
+    work();
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+} // openstudio
@@ -0,0 +1,164 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_PARALLELLOADER_HPP
+#define UTILITIES_CORE_PARALLELLOADER_HPP
+
+#include "Path.hpp"
+#include "System.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace openstudio
+{
+  /** ParallelLoader calls a load function for each path in a list on a fixed number of worker threads, and
+   *  provides the results as futures in the order of the paths. Loading starts on construction. The load function
+   *  is called concurrently from several threads, so it may only share immutable data between calls. Exceptions
+   *  thrown by the load function are rethrown by the corresponding future. The destructor waits for all loads
+   *  to finish, futures obtained from the loader remain valid after that.
+   */
+  template<typename T>
+  class ParallelLoader
+  {
+    public:
+
+      typedef std::function<T (const openstudio::path&)> LoadFunction;
+
+      /// start loading paths on numThreads worker threads, 0 uses the number of processors
+      ParallelLoader(const std::vector<openstudio::path>& paths, const LoadFunction& load, unsigned numThreads = 0)
+        : m_state(std::make_shared<State>(paths, load))
+      {
+        for (std::promise<T>& promise : m_state->promises) {
+          m_futures.push_back(promise.get_future().share());
+        }
+
+        if (numThreads == 0) {
+          numThreads = System::numberOfProcessors();
+        }
+        size_t n = std::min(static_cast<size_t>(numThreads), paths.size());
+        try {
+          m_threads.reserve(n);
+          for (size_t i = 0; i < n; ++i) {
+            m_threads.emplace_back(&ParallelLoader::work, m_state);
+          }
+        } catch (...) {
+          // the destructor does not run if construction fails, joinable threads must not be destroyed
+          wait();
+          throw;
+        }
+      }
+
+      ParallelLoader(ParallelLoader&& other) = default;
+
+      ParallelLoader(const ParallelLoader& other) = delete;
+      ParallelLoader& operator=(const ParallelLoader& other) = delete;
+      ParallelLoader& operator=(ParallelLoader&& other) = delete;
+
+      /// waits for all loads to finish
+      ~ParallelLoader()
+      {
+        wait();
+      }
+
+      /// number of paths
+      size_t size() const
+      {
+        return m_futures.size();
+      }
+
+      /// number of worker threads
+      size_t numThreads() const
+      {
+        return m_threads.size();
+      }
+
+      /// futures of the results, in the order of the paths
+      std::vector<std::shared_future<T> > futures() const
+      {
+        return m_futures;
+      }
+
+      /// future of the result for the path at index
+      std::shared_future<T> future(size_t index) const
+      {
+        return m_futures.at(index);
+      }
+
+      /// blocks until all paths are loaded
+      void wait()
+      {
+        for (std::thread& thread : m_threads) {
+          if (thread.joinable()) {
+            thread.join();
+          }
+        }
+      }
+
+    private:
+
+      // shared with the worker threads so that the loader can be moved while they run
+      struct State
+      {
+        State(const std::vector<openstudio::path>& t_paths, const LoadFunction& t_load)
+          : paths(t_paths), load(t_load), promises(t_paths.size()), next(0)
+        {}
+
+        std::vector<openstudio::path> paths;
+        LoadFunction load;
+        std::vector<std::promise<T> > promises;
+        std::atomic<size_t> next;
+      };
+
+      // each worker takes the next path until all are taken
+      static void work(std::shared_ptr<State> state)
+      {
+        for (size_t i = state->next++; i < state->paths.size(); i = state->next++) {
+          try {
+            state->promises[i].set_value(state->load(state->paths[i]));
+          } catch (...) {
+            state->promises[i].set_exception(std::current_exception());
+          }
+        }
+      }
+
+      std::shared_ptr<State> m_state;
+      std::vector<std::shared_future<T> > m_futures;
+      std::vector<std::thread> m_threads;
+  };
+
+} // openstudio
+
+#endif // UTILITIES_CORE_PARALLELLOADER_HPP
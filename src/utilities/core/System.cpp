@@ -33,6 +33,10 @@
 #include <boost/thread.hpp>
 #include <boost/numeric/ublas/lu.hpp>
 
+#if !(defined (_WIN32) || defined (_WIN64))
+  #include <sys/resource.h>
+#endif
+
 
 namespace openstudio{
 
@@ -41,6 +45,7 @@ namespace openstudio{
   #define _WIN32_WINNT 0x0500
 
   #include <windows.h>
+  #include <psapi.h>
 
   /// return the amount of time that the system has been idle
   boost::optional<Time> System::systemIdleTime()
@@ -151,6 +156,28 @@ namespace openstudio{
     return numberOfProcessors;
   }
 
+  size_t System::peakMemoryUsage()
+  {
+#if (defined (_WIN32) || defined (_WIN64))
+    PROCESS_MEMORY_COUNTERS counters;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))){
+      return counters.PeakWorkingSetSize;
+    }
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0){
+#if defined(__APPLE__)
+      // bytes on macOS
+      return static_cast<size_t>(usage.ru_maxrss);
+#else
+      // kilobytes on Linux
+      return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+    }
+#endif
+    return 0;
+  }
+
 
   void System::testExceptions1()
   {
@@ -49,6 +49,9 @@ namespace openstudio {
     /// Returns the number of processors on this computer
     static unsigned numberOfProcessors();
 
+    /// Returns the peak resident memory of this process in bytes, or 0 if it is not available
+    static size_t peakMemoryUsage();
+
     /// \note not using string_view because we need null terminated strings
     static boost::optional<std::string> getenv(const std::string &name) noexcept;
 
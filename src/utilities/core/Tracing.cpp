@@ -0,0 +1,294 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "Tracing.hpp"
+#include "Filesystem.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#if (defined (_WIN32) || defined (_WIN64))
+  #include <process.h>
+#else
+  #include <unistd.h>
+#endif
+
+namespace openstudio {
+
+  namespace {
+
+    struct TraceEvent {
+      const char* category;
+      std::string name;
+      std::string detail;
+      int64_t start;
+      int64_t duration;
+      unsigned threadIndex;
+    };
+
+    // checked by every trace scope, constant initialized so it is safe to use during static initialization
+    std::atomic<bool> tracingEnabled{false};
+
+    // never destroyed so events can be recorded and written during static destruction
+    class TraceRecorder {
+     public:
+
+      static TraceRecorder& instance() {
+        static auto* recorder = new TraceRecorder();
+        return *recorder;
+      }
+
+      void add(TraceEvent&& event) {
+        std::lock_guard<std::mutex> l{m_mutex};
+        m_events.push_back(std::move(event));
+      }
+
+      void clear() {
+        std::lock_guard<std::mutex> l{m_mutex};
+        m_events.clear();
+      }
+
+      size_t size() {
+        std::lock_guard<std::mutex> l{m_mutex};
+        return m_events.size();
+      }
+
+      std::vector<TraceEvent> events() {
+        std::lock_guard<std::mutex> l{m_mutex};
+        return m_events;
+      }
+
+     private:
+
+      std::mutex m_mutex;
+      std::vector<TraceEvent> m_events;
+    };
+
+    std::chrono::steady_clock::time_point traceEpoch() {
+      static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+      return epoch;
+    }
+
+    // small stable thread ids read better in trace viewers than native thread ids
+    unsigned currentThreadIndex() {
+      static std::atomic<unsigned> nextThreadIndex{1};
+      thread_local unsigned threadIndex = nextThreadIndex++;
+      return threadIndex;
+    }
+
+    int currentProcessId() {
+#if (defined (_WIN32) || defined (_WIN64))
+      return _getpid();
+#else
+      return static_cast<int>(getpid());
+#endif
+    }
+
+    void appendJsonString(std::string& result, const std::string& str) {
+      result += '"';
+      for (char c : str) {
+        switch (c) {
+          case '"':
+            result += "\\\"";
+            break;
+          case '\\':
+            result += "\\\\";
+            break;
+          case '\n':
+            result += "\\n";
+            break;
+          case '\r':
+            result += "\\r";
+            break;
+          case '\t':
+            result += "\\t";
+            break;
+          default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+              char buffer[8];
+              std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+              result += buffer;
+            } else {
+              result += c;
+            }
+        }
+      }
+      result += '"';
+    }
+
+    // trace event times are in microseconds
+    void appendMicroseconds(std::string& result, int64_t nanoseconds) {
+      char buffer[32];
+      std::snprintf(buffer, sizeof(buffer), "%lld.%03lld", static_cast<long long>(nanoseconds / 1000),
+                    static_cast<long long>(nanoseconds % 1000));
+      result += buffer;
+    }
+
+    // writes the trace requested by OPENSTUDIO_TRACE_FILE when the process exits
+    class TraceFileWriter {
+     public:
+
+      TraceFileWriter() {
+        const char* traceFile = std::getenv("OPENSTUDIO_TRACE_FILE");
+        if (traceFile && *traceFile) {
+          m_path = toPath(traceFile);
+          Tracer::enable();
+        }
+      }
+
+      ~TraceFileWriter() {
+        if (!m_path.empty()) {
+          Tracer::saveChromeTrace(m_path);
+        }
+      }
+
+     private:
+
+      openstudio::path m_path;
+    };
+
+    TraceFileWriter traceFileWriter;
+
+  }
+
+  void Tracer::enable() {
+    // start the clock before any event is recorded
+    traceEpoch();
+    tracingEnabled = true;
+  }
+
+  void Tracer::disable() {
+    tracingEnabled = false;
+  }
+
+  bool Tracer::enabled() {
+    return tracingEnabled.load(std::memory_order_relaxed);
+  }
+
+  void Tracer::clear() {
+    TraceRecorder::instance().clear();
+  }
+
+  size_t Tracer::numEvents() {
+    return TraceRecorder::instance().size();
+  }
+
+  int64_t Tracer::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - traceEpoch()).count();
+  }
+
+  void Tracer::addEvent(const char* category, const std::string& name, int64_t start, int64_t duration,
+                        const std::string& detail) {
+    TraceRecorder::instance().add(TraceEvent{category, name, detail, start, duration, currentThreadIndex()});
+  }
+
+  std::string Tracer::chromeTrace() {
+    std::vector<TraceEvent> events = TraceRecorder::instance().events();
+    std::string pid = std::to_string(currentProcessId());
+
+    std::string result;
+    result.reserve(128 * (events.size() + 1));
+    result += "{\"traceEvents\":[";
+    bool first = true;
+    for (const TraceEvent& event : events) {
+      if (!first) {
+        result += ',';
+      }
+      first = false;
+      result += "\n{\"name\":";
+      appendJsonString(result, event.name);
+      result += ",\"cat\":";
+      appendJsonString(result, event.category ? event.category : "");
+      result += ",\"ph\":\"X\",\"ts\":";
+      appendMicroseconds(result, event.start);
+      result += ",\"dur\":";
+      appendMicroseconds(result, event.duration);
+      result += ",\"pid\":";
+      result += pid;
+      result += ",\"tid\":";
+      result += std::to_string(event.threadIndex);
+      if (!event.detail.empty()) {
+        result += ",\"args\":{\"detail\":";
+        appendJsonString(result, event.detail);
+        result += '}';
+      }
+      result += '}';
+    }
+    result += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return result;
+  }
+
+  bool Tracer::saveChromeTrace(const openstudio::path& path) {
+    openstudio::filesystem::ofstream file(path, std::ios_base::binary);
+    if (!file.is_open()) {
+      return false;
+    }
+    std::string trace = chromeTrace();
+    file.write(trace.data(), trace.size());
+    file.close();
+    return !file.fail();
+  }
+
+  TraceScope::TraceScope(const char* category)
+    : m_category(category), m_start(0), m_active(Tracer::enabled())
+  {
+    if (m_active) {
+      m_start = Tracer::now();
+    }
+  }
+
+  TraceScope::TraceScope(const char* category, const std::string& name)
+    : TraceScope(category)
+  {
+    if (m_active) {
+      m_name = name;
+    }
+  }
+
+  TraceScope::~TraceScope() {
+    if (m_active) {
+      int64_t end = Tracer::now();
+      Tracer::addEvent(m_category, m_name, m_start, end - m_start, m_detail);
+    }
+  }
+
+  void TraceScope::setName(const std::string& name) {
+    m_name = name;
+  }
+
+  void TraceScope::setDetail(const std::string& detail) {
+    m_detail = detail;
+  }
+
+} // openstudio
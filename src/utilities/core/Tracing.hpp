@@ -0,0 +1,133 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef UTILITIES_CORE_TRACING_HPP
+#define UTILITIES_CORE_TRACING_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "Path.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace openstudio {
+
+  /** Tracer records timed events from any thread and writes them in the Chrome trace event format,
+   *  which can be opened in chrome://tracing or https://ui.perfetto.dev. Tracing is disabled by default,
+   *  in which case a trace scope only checks a flag. Setting the OPENSTUDIO_TRACE_FILE environment variable
+   *  enables tracing at startup and writes the trace to that path when the process exits. */
+  class UTILITIES_API Tracer {
+  public:
+
+    /// Start recording events
+    static void enable();
+
+    /// Stop recording events, events already recorded are kept
+    static void disable();
+
+    /// Returns true if events are being recorded
+    static bool enabled();
+
+    /// Remove all recorded events
+    static void clear();
+
+    /// Returns the number of recorded events
+    static size_t numEvents();
+
+    /// Returns the number of nanoseconds since tracing was first used, on a monotonic clock
+    static int64_t now();
+
+    /// Record an event named name in category that started at start and lasted duration nanoseconds,
+    /// detail is shown as an argument of the event if not empty
+    static void addEvent(const char* category, const std::string& name, int64_t start, int64_t duration,
+                         const std::string& detail = std::string());
+
+    /// Returns the recorded events in the Chrome trace event format
+    static std::string chromeTrace();
+
+    /// Write the recorded events in the Chrome trace event format to path, returns false if the file cannot be written
+    static bool saveChromeTrace(const openstudio::path& path);
+  };
+
+  /** TraceScope records an event in the Tracer covering its own lifetime. If tracing is disabled when
+   *  the scope is constructed nothing is recorded, use the OS_TRACE_SCOPE macros so that event names
+   *  are only built when tracing is enabled. */
+  class UTILITIES_API TraceScope {
+  public:
+
+    /// starts the event if tracing is enabled, category must be a string literal
+    explicit TraceScope(const char* category);
+
+    /// starts the event if tracing is enabled, category must be a string literal
+    TraceScope(const char* category, const std::string& name);
+
+    /// records the event
+    ~TraceScope();
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    /// true if this scope will record an event
+    bool active() const { return m_active; }
+
+    void setName(const std::string& name);
+
+    void setDetail(const std::string& detail);
+
+  private:
+
+    const char* m_category;
+    std::string m_name;
+    std::string m_detail;
+    int64_t m_start;
+    bool m_active;
+  };
+
+} // openstudio
+
+#define OS_TRACE_CONCAT_IMPL(__a__, __b__) __a__##__b__
+#define OS_TRACE_CONCAT(__a__, __b__) OS_TRACE_CONCAT_IMPL(__a__, __b__)
+
+/// Trace the rest of the enclosing block, __name__ is only evaluated if tracing is enabled
+#define OS_TRACE_SCOPE(__category__, __name__) \
+  openstudio::TraceScope OS_TRACE_CONCAT(_osTraceScope, __LINE__)(__category__); \
+  if (OS_TRACE_CONCAT(_osTraceScope, __LINE__).active()) { \
+    OS_TRACE_CONCAT(_osTraceScope, __LINE__).setName(__name__); \
+  }
+
+/// Trace the rest of the enclosing block with a detail argument, __name__ and __detail__ are only evaluated if tracing is enabled
+#define OS_TRACE_SCOPE_DETAIL(__category__, __name__, __detail__) \
+  openstudio::TraceScope OS_TRACE_CONCAT(_osTraceScope, __LINE__)(__category__); \
+  if (OS_TRACE_CONCAT(_osTraceScope, __LINE__).active()) { \
+    OS_TRACE_CONCAT(_osTraceScope, __LINE__).setName(__name__); \
+    OS_TRACE_CONCAT(_osTraceScope, __LINE__).setDetail(__detail__); \
+  }
+
+#endif // UTILITIES_CORE_TRACING_HPP
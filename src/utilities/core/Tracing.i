@@ -0,0 +1,13 @@
+#ifndef UTILITIES_CORE_TRACING_I
+#define UTILITIES_CORE_TRACING_I
+
+%{
+  #include <utilities/core/Tracing.hpp>
+%}
+
+// trace scopes are only useful from C++
+%ignore openstudio::TraceScope;
+
+%include <utilities/core/Tracing.hpp>
+
+#endif //UTILITIES_CORE_TRACING_I
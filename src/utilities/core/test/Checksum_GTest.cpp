@@ -35,6 +35,11 @@
 
 #include <resources.hxx>
 
+#include <boost/crc.hpp>
+
+#include <iomanip>
+#include <random>
+
 using openstudio::path;
 using openstudio::toPath;
 using openstudio::checksum;
@@ -113,6 +118,48 @@ TEST(Checksum, Paths)
   EXPECT_EQ("00000000", checksum(p));
 }
 
+TEST(Checksum, MultiplePaths)
+{
+  std::vector<path> paths;
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/Checksum.txt"));
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/NotAFile.txt"));
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/Checksum2.txt"));
+  paths.push_back(resourcesPath() / toPath("utilities/Checksum/"));
+
+  std::vector<string> result = openstudio::checksums(paths);
+  ASSERT_EQ(4u, result.size());
+  EXPECT_EQ("1AD514BA", result[0]);
+  EXPECT_EQ("00000000", result[1]);
+  EXPECT_EQ("17B88D3A", result[2]);
+  EXPECT_EQ("00000000", result[3]);
+
+  EXPECT_TRUE(openstudio::checksums(std::vector<path>()).empty());
+}
+
+TEST(Checksum, MatchesBoostCrc)
+{
+  // checksum must stay identical to boost's bytewise crc_32_type with carriage returns stripped
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dist(0, 255);
+  for (size_t n : {1u, 7u, 8u, 9u, 1023u, 1024u, 1025u, 100000u}) {
+    string s;
+    for (size_t i = 0; i < n; ++i) {
+      s.push_back(static_cast<char>(dist(gen)));
+    }
+
+    string stripped(s);
+    stripped.erase(std::remove(stripped.begin(), stripped.end(), '\r'), stripped.end());
+    boost::crc_32_type crc;
+    crc.process_bytes(stripped.data(), stripped.size());
+    stringstream expected;
+    expected << std::hex << std::uppercase << std::setw(8) << std::setfill('0') << crc.checksum();
+
+    EXPECT_EQ(expected.str(), checksum(s));
+    stringstream ss(s);
+    EXPECT_EQ(expected.str(), checksum(ss));
+  }
+}
+
 TEST(Checksum, UUIDs) {
   StringVector checksums;
   for (unsigned i = 0, n = 1000; i < n; ++i) {
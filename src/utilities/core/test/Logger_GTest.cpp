@@ -343,4 +343,62 @@ namespace
 
     EXPECT_NO_THROW(openstudio::filesystem::remove(path));
   }
+
+  TEST(LoggerTest, log_level_gate)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    StringStreamLogSink sink;
+    sink.setLogLevel(Info);
+    EXPECT_TRUE(openstudio::logLevelEnabled(Info));
+    EXPECT_TRUE(openstudio::logLevelEnabled(Error));
+    EXPECT_FALSE(openstudio::logLevelEnabled(Debug));
+
+    // messages below the gate are never formatted
+    int numFormatted = 0;
+    auto format = [&numFormatted]() { return ++numFormatted; };
+    LOG_FREE(Debug, "gate.channel", "Formatted " << format());
+    EXPECT_EQ(0, numFormatted);
+    LOG_FREE(Info, "gate.channel", "Formatted " << format());
+    EXPECT_EQ(1, numFormatted);
+    ASSERT_EQ(1u, sink.logMessages().size());
+    EXPECT_EQ("Formatted 1", sink.logMessages()[0].logMessage());
+
+    sink.setLogLevel(Trace);
+    EXPECT_TRUE(openstudio::logLevelEnabled(Trace));
+    LOG_FREE(Debug, "gate.channel", "Formatted " << format());
+    EXPECT_EQ(2, numFormatted);
+
+    sink.resetLogLevel();
+    EXPECT_TRUE(openstudio::logLevelEnabled(Trace));
+
+    sink.setLogLevel(Warn);
+    EXPECT_FALSE(openstudio::logLevelEnabled(Info));
+    sink.disable();
+  }
+
+  TEST(LoggerTest, disabled_log_not_formatted)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    StringStreamLogSink sink;
+    sink.setLogLevel(Warn);
+
+    // the streamed expression of a message below every enabled sink's level is never evaluated,
+    // the cost of a disabled message is measured in utilities/benchmark/Logger_Benchmark.cpp
+    int numEvaluated = 0;
+    for (int i = 0; i < 100; ++i) {
+      LOG_FREE(Trace, "disabled.channel", "Item " << ++numEvaluated);
+      LOG_FREE(Debug, "disabled.channel", "Item " << ++numEvaluated);
+      LOG_FREE(Info, "disabled.channel", "Item " << ++numEvaluated);
+    }
+    EXPECT_EQ(0, numEvaluated);
+    EXPECT_TRUE(sink.logMessages().empty());
+
+    LOG_FREE(Warn, "disabled.channel", "Item " << ++numEvaluated);
+    EXPECT_EQ(1, numEvaluated);
+    ASSERT_EQ(1u, sink.logMessages().size());
+    EXPECT_EQ("Item 1", sink.logMessages()[0].logMessage());
+    sink.disable();
+  }
 }
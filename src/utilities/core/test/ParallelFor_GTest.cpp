@@ -0,0 +1,98 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../ParallelFor.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace openstudio;
+
+TEST(ParallelFor, CallsEachIndexOnce)
+{
+  std::vector<unsigned> calls(1000, 0);
+  parallelFor(calls.size(), [&calls](size_t i) {
+    calls[i] += 1;
+  }, 4);
+
+  for (unsigned count : calls){
+    EXPECT_EQ(1u, count);
+  }
+
+  // no calls and no threads for an empty range
+  parallelFor(0, [](size_t i) {
+    ADD_FAILURE() << "called with " << i;
+  }, 4);
+}
+
+TEST(ParallelFor, SingleThreadCallsInOrderOnCallingThread)
+{
+  std::thread::id callingThreadId = std::this_thread::get_id();
+  std::vector<size_t> order;
+  parallelFor(10, [&order, callingThreadId](size_t i) {
+    EXPECT_EQ(callingThreadId, std::this_thread::get_id());
+    order.push_back(i);
+  }, 1);
+
+  ASSERT_EQ(10u, order.size());
+  for (size_t i = 0; i < order.size(); ++i){
+    EXPECT_EQ(i, order[i]);
+  }
+}
+
+TEST(ParallelFor, RethrowsLowestIndexException)
+{
+  std::atomic<unsigned> numCalls(0);
+  try {
+    parallelFor(100, [&numCalls](size_t i) {
+      ++numCalls;
+      if (i == 10 || i == 20){
+        throw std::runtime_error(std::to_string(i));
+      }
+    }, 4);
+    FAIL() << "expected an exception";
+  } catch (const std::runtime_error& e) {
+    EXPECT_EQ("10", std::string(e.what()));
+  }
+  EXPECT_LE(11u, numCalls.load());
+
+  // a single thread stops at the first exception
+  numCalls = 0;
+  EXPECT_THROW(parallelFor(100, [&numCalls](size_t i) {
+    ++numCalls;
+    if (i == 10){
+      throw std::runtime_error(std::to_string(i));
+    }
+  }, 1), std::runtime_error);
+  EXPECT_EQ(11u, numCalls.load());
+}
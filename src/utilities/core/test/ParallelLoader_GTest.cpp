@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../ParallelLoader.hpp"
+
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace openstudio;
+
+TEST(ParallelLoader, ResultsInOrder)
+{
+  std::vector<openstudio::path> paths;
+  for (unsigned i = 0; i < 50; ++i){
+    paths.push_back(toPath(std::to_string(i)));
+  }
+
+  ParallelLoader<std::string> loader(paths, [](const openstudio::path& p) {
+    return toString(p) + ".loaded";
+  }, 4);
+  EXPECT_EQ(50u, loader.size());
+  EXPECT_EQ(4u, loader.numThreads());
+
+  std::vector<std::shared_future<std::string> > futures = loader.futures();
+  ASSERT_EQ(50u, futures.size());
+  for (unsigned i = 0; i < 50; ++i){
+    EXPECT_EQ(std::to_string(i) + ".loaded", futures[i].get());
+  }
+}
+
+TEST(ParallelLoader, Exceptions)
+{
+  std::vector<openstudio::path> paths{toPath("good"), toPath("bad"), toPath("good")};
+
+  ParallelLoader<int> loader(paths, [](const openstudio::path& p) {
+    if (p == toPath("bad")) {
+      throw std::runtime_error("bad path");
+    }
+    return 1;
+  }, 2);
+
+  EXPECT_EQ(1, loader.future(0).get());
+  EXPECT_THROW(loader.future(1).get(), std::runtime_error);
+  EXPECT_EQ(1, loader.future(2).get());
+}
+
+TEST(ParallelLoader, Threads)
+{
+  std::vector<openstudio::path> paths(20, toPath("path"));
+
+  // futures remain valid after the loader is destroyed
+  std::vector<std::shared_future<std::thread::id> > futures;
+  {
+    ParallelLoader<std::thread::id> loader(paths, [](const openstudio::path&) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      return std::this_thread::get_id();
+    }, 3);
+    futures = loader.futures();
+  }
+
+  std::set<std::thread::id> ids;
+  for (const auto& future : futures){
+    ids.insert(future.get());
+  }
+  EXPECT_GE(3u, ids.size());
+  EXPECT_EQ(0u, ids.count(std::this_thread::get_id()));
+
+  // no more threads than paths
+  ParallelLoader<int> small(std::vector<openstudio::path>(1, toPath("path")), [](const openstudio::path&) { return 1; }, 8);
+  EXPECT_EQ(1u, small.numThreads());
+  EXPECT_EQ(1, small.future(0).get());
+}
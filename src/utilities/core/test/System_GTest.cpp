@@ -31,6 +31,8 @@
 
 #include "../System.hpp"
 
+#include <vector>
+
 using openstudio::System;
 using openstudio::Time;
 
@@ -60,3 +62,16 @@ TEST(System, MSleep)
   // make sure this doesn't timeout
   System::msleep(10);
 }
+
+TEST(System, PeakMemoryUsage)
+{
+  size_t before = System::peakMemoryUsage();
+  EXPECT_LT(0u, before);
+
+  // the peak never decreases
+  {
+    std::vector<char> buffer(64 * 1024 * 1024, 'x');
+    EXPECT_EQ('x', buffer.back());
+  }
+  EXPECT_LE(before, System::peakMemoryUsage());
+}
@@ -0,0 +1,171 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "../Tracing.hpp"
+#include "../Filesystem.hpp"
+
+#include <json/json.h>
+
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace openstudio;
+
+namespace {
+
+  std::string tracedName(int& evaluations) {
+    ++evaluations;
+    return "traced";
+  }
+
+  Json::Value parseChromeTrace(const std::string& trace) {
+    Json::CharReaderBuilder rbuilder;
+    std::istringstream ss(trace);
+    Json::Value root;
+    std::string formattedErrors;
+    EXPECT_TRUE(Json::parseFromStream(rbuilder, ss, &root, &formattedErrors)) << formattedErrors;
+    return root;
+  }
+
+}
+
+TEST(Tracing, Disabled)
+{
+  Tracer::disable();
+  Tracer::clear();
+
+  int evaluations = 0;
+  {
+    OS_TRACE_SCOPE("test", tracedName(evaluations));
+  }
+
+  // names are not built and nothing is recorded when tracing is disabled
+  EXPECT_EQ(0, evaluations);
+  EXPECT_EQ(0u, Tracer::numEvents());
+}
+
+TEST(Tracing, Scopes)
+{
+  Tracer::clear();
+  Tracer::enable();
+
+  int evaluations = 0;
+  {
+    OS_TRACE_SCOPE("test", "outer");
+    {
+      OS_TRACE_SCOPE_DETAIL("test", tracedName(evaluations), "select \"Value\"\nfrom Table");
+    }
+  }
+
+  Tracer::disable();
+  EXPECT_EQ(1, evaluations);
+  ASSERT_EQ(2u, Tracer::numEvents());
+
+  Json::Value root = parseChromeTrace(Tracer::chromeTrace());
+  Json::Value events = root["traceEvents"];
+  ASSERT_EQ(2u, events.size());
+
+  // events are recorded when they end, so the inner scope comes first
+  EXPECT_EQ("traced", events[0]["name"].asString());
+  EXPECT_EQ("test", events[0]["cat"].asString());
+  EXPECT_EQ("X", events[0]["ph"].asString());
+  EXPECT_EQ("select \"Value\"\nfrom Table", events[0]["args"]["detail"].asString());
+  EXPECT_EQ("outer", events[1]["name"].asString());
+  EXPECT_FALSE(events[1].isMember("args"));
+
+  // the outer scope covers the inner scope
+  EXPECT_LE(events[1]["ts"].asDouble(), events[0]["ts"].asDouble());
+  EXPECT_GE(events[1]["ts"].asDouble() + events[1]["dur"].asDouble(), events[0]["ts"].asDouble() + events[0]["dur"].asDouble());
+  EXPECT_EQ(events[0]["tid"].asInt(), events[1]["tid"].asInt());
+
+  Tracer::clear();
+  EXPECT_EQ(0u, Tracer::numEvents());
+}
+
+TEST(Tracing, Threads)
+{
+  Tracer::clear();
+  Tracer::enable();
+
+  const unsigned numThreads = 4;
+  const unsigned numScopes = 100;
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < numThreads; ++i) {
+    threads.emplace_back([numScopes]() {
+      for (unsigned j = 0; j < numScopes; ++j) {
+        OS_TRACE_SCOPE("test", "work");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  Tracer::disable();
+  EXPECT_EQ(numThreads * numScopes, Tracer::numEvents());
+
+  Json::Value root = parseChromeTrace(Tracer::chromeTrace());
+  std::set<int> threadIds;
+  for (const Json::Value& event : root["traceEvents"]) {
+    threadIds.insert(event["tid"].asInt());
+  }
+  EXPECT_EQ(numThreads, threadIds.size());
+
+  Tracer::clear();
+}
+
+TEST(Tracing, SaveChromeTrace)
+{
+  Tracer::clear();
+  Tracer::enable();
+  {
+    OS_TRACE_SCOPE("test", "saved");
+  }
+  Tracer::disable();
+
+  openstudio::path p = openstudio::filesystem::temp_directory_path() / toPath("Tracing_SaveChromeTrace.json");
+  if (openstudio::filesystem::exists(p)) {
+    openstudio::filesystem::remove(p);
+  }
+  ASSERT_TRUE(Tracer::saveChromeTrace(p));
+
+  openstudio::filesystem::ifstream file(p, std::ios_base::binary);
+  std::stringstream ss;
+  ss << file.rdbuf();
+  Json::Value root = parseChromeTrace(ss.str());
+  ASSERT_EQ(1u, root["traceEvents"].size());
+  EXPECT_EQ("saved", root["traceEvents"][0]["name"].asString());
+
+  Tracer::clear();
+}
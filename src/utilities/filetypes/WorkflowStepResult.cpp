@@ -35,6 +35,8 @@
 
 #include <json/json.h>
 
+#include <unordered_map>
+
 namespace openstudio {
 namespace detail {
 
@@ -715,6 +717,27 @@ namespace detail {
     m_stepValues.push_back(value);
   }
 
+  void WorkflowStepResult_Impl::addStepValues(const std::vector<WorkflowStepValue>& values)
+  {
+    // the last value with each name wins, as if each value had been added in turn
+    std::unordered_map<std::string, size_t> lastIndices;
+    lastIndices.reserve(values.size());
+    for (size_t i = 0; i < values.size(); ++i){
+      lastIndices[values[i].name()] = i;
+    }
+
+    m_stepValues.erase(std::remove_if(m_stepValues.begin(), m_stepValues.end(),
+      [&lastIndices](const WorkflowStepValue& x) {return lastIndices.find(x.name()) != lastIndices.end(); }),
+      m_stepValues.end());
+
+    m_stepValues.reserve(m_stepValues.size() + lastIndices.size());
+    for (size_t i = 0; i < values.size(); ++i){
+      if (lastIndices[values[i].name()] == i){
+        m_stepValues.push_back(values[i]);
+      }
+    }
+  }
+
   void WorkflowStepResult_Impl::resetStepValues()
   {
     m_stepValues.clear();
@@ -1413,6 +1436,11 @@ void WorkflowStepResult::addStepValue(const WorkflowStepValue& value)
   getImpl<detail::WorkflowStepResult_Impl>()->addStepValue(value);
 }
 
+void WorkflowStepResult::addStepValues(const std::vector<WorkflowStepValue>& values)
+{
+  getImpl<detail::WorkflowStepResult_Impl>()->addStepValues(values);
+}
+
 void WorkflowStepResult::resetStepValues()
 {
   getImpl<detail::WorkflowStepResult_Impl>()->resetStepValues();
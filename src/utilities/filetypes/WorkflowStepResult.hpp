@@ -305,6 +305,10 @@ class UTILITIES_API WorkflowStepResult {
   void resetStepInfo();
 
   void addStepValue(const WorkflowStepValue& value);
+
+  /** Adds values in order, equivalent to calling addStepValue for each value but with a single pass over existing values. */
+  void addStepValues(const std::vector<WorkflowStepValue>& values);
+
   void resetStepValues();
 
   void addStepFile(const openstudio::path& path);
@@ -215,6 +215,7 @@ class UTILITIES_API WorkflowStepResult_Impl {
   void resetStepInfo();
 
   void addStepValue(const WorkflowStepValue& value);
+  void addStepValues(const std::vector<WorkflowStepValue>& values);
   void resetStepValues();
 
   void addStepFile(const openstudio::path& path);
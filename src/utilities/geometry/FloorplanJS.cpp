@@ -294,21 +294,9 @@ namespace openstudio{
     return result;
   }
 
-  size_t getVertexIndex(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001)
-  {
-    size_t n = allPoints.size();
-    for (size_t i = 0; i < n; ++i){
-      if (std::sqrt(std::pow(point3d.x()-allPoints[i].x(), 2) + std::pow(point3d.y()-allPoints[i].y(), 2) + std::pow(point3d.z()-allPoints[i].z(), 2)) < tol){
-        return i;
-      }
-    }
-    allPoints.push_back(point3d);
-    return (allPoints.size() - 1);
-  }
-
   std::string FloorplanJS::makeSurface(const Json::Value& story, const Json::Value& spaceOrShading, const std::string& parentSurfaceName, const std::string& parentSubSurfaceName,
     bool belowFloorPlenum, bool aboveCeilingPlenum, const std::string& surfaceType, const Point3dVectorVector& finalFaceVertices, size_t faceFormat,
-    std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, double illuminanceSetpoint, bool airWall) const
+    std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, double illuminanceSetpoint, bool airWall, IdIndices& idIndices) const
   {
     std::string finalSurfaceType = surfaceType;
 
@@ -339,19 +327,19 @@ namespace openstudio{
     std::string geometryId = std::string("Geometry ") + std::to_string(geometries.size());
     std::string faceId = std::string("Face ") + std::to_string(geometries.size());
 
-    Point3dVector allVertices;
+    VertexWelder allVertices;
     std::vector<size_t> faceIndices;
     for (const auto& finalFaceVerts : finalFaceVertices) {
       faceIndices.push_back(faceFormat);
       for (const auto& vert: finalFaceVerts){
-        faceIndices.push_back(getVertexIndex(vert, allVertices));
+        faceIndices.push_back(allVertices.index(vert));
       }
     }
 
     {
       std::string uuid = geometryId;
       std::string type = "Geometry";
-      ThreeGeometryData data(toThreeVector(allVertices), faceIndices);
+      ThreeGeometryData data(toThreeVector(allVertices.vertices()), faceIndices);
       ThreeGeometry geometry(uuid, type, data);
       geometries.push_back(geometry);
     }
@@ -406,7 +394,7 @@ namespace openstudio{
       // building unit
       if (checkKeyAndType(spaceOrShading, "building_unit_id", Json::stringValue)){
         id = spaceOrShading.get("building_unit_id", "").asString();
-        if (const Json::Value* buildingUnit = findById(m_value["building_units"], id)){
+        if (const Json::Value* buildingUnit = findById(m_value["building_units"], id, idIndices)){
           assertKeyAndType(*buildingUnit, "name", Json::stringValue);
           s = buildingUnit->get("name", "").asString();
           userData.setBuildingUnitName(s);
@@ -424,7 +412,7 @@ namespace openstudio{
       // thermal zone
       if (checkKeyAndType(spaceOrShading, "thermal_zone_id", Json::stringValue)){
         id = spaceOrShading.get("thermal_zone_id", "").asString();
-        if (const Json::Value* thermalZone = findById(m_value["thermal_zones"], id)){
+        if (const Json::Value* thermalZone = findById(m_value["thermal_zones"], id, idIndices)){
           assertKeyAndType(*thermalZone, "name", Json::stringValue);
           s = thermalZone->get("name", "").asString();
           std::string thermalZoneName = s + spaceOrShadingNamePostFix;
@@ -455,7 +443,7 @@ namespace openstudio{
       } else {
         if (checkKeyAndType(spaceOrShading, "space_type_id", Json::stringValue)){
           id = spaceOrShading.get("space_type_id", "").asString();
-          if (const Json::Value* spaceType = findById(m_value["space_types"], id)){
+          if (const Json::Value* spaceType = findById(m_value["space_types"], id, idIndices)){
             assertKeyAndType(*spaceType, "name", Json::stringValue);
             s = spaceType->get("name", "").asString();
             userData.setSpaceTypeName(s);
@@ -474,7 +462,7 @@ namespace openstudio{
       // construction set
       if (checkKeyAndType(spaceOrShading, "construction_set_id", Json::stringValue)){
         id = spaceOrShading.get("construction_set_id", "").asString();
-        if (const Json::Value* constructionSet = findById(m_value["construction_sets"], id)){
+        if (const Json::Value* constructionSet = findById(m_value["construction_sets"], id, idIndices)){
           assertKeyAndType(*constructionSet, "name", Json::stringValue);
           s = constructionSet->get("name", "").asString();
           userData.setConstructionSetName(s);
@@ -506,7 +494,7 @@ namespace openstudio{
   void FloorplanJS::makeGeometries(const Json::Value& story, const Json::Value& spaceOrShading,
     bool belowFloorPlenum, bool aboveCeilingPlenum, double lengthToMeters, double minZ, double maxZ,
     const Json::Value& vertices, const Json::Value& edges, const Json::Value& faces, const std::string& faceId,
-    bool openstudioFormat, std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, bool openToBelow) const
+    bool openstudioFormat, std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, bool openToBelow, IdIndices& idIndices) const
   {
     std::vector<Point3d> faceVertices;
     std::vector<Point3d> windowCenterVertices;
@@ -515,9 +503,9 @@ namespace openstudio{
     std::vector<Point3d> doorCenterVertices;
     std::vector<std::string> doorDefinitionIds;
 
-    const Json::Value windowDefinitions = m_value.get("window_definitions", Json::arrayValue);
-    const Json::Value daylightingControlDefinitions = m_value.get("daylighting_control_definitions", Json::arrayValue);
-    const Json::Value doorDefinitions = m_value.get("door_definitions", Json::arrayValue);
+    const Json::Value& windowDefinitions = m_value["window_definitions"];
+    const Json::Value& daylightingControlDefinitions = m_value["daylighting_control_definitions"];
+    const Json::Value& doorDefinitions = m_value["door_definitions"];
 
     // get all the windows on this story
     std::map<std::string, std::vector<Json::Value> > edgeIdToWindowsMap;
@@ -544,7 +532,7 @@ namespace openstudio{
     }
 
     // get the face
-    const Json::Value* face = findById(faces, faceId);
+    const Json::Value* face = findById(faces, faceId, idIndices);
     if (face){
 
       // get the edges
@@ -559,18 +547,18 @@ namespace openstudio{
         unsigned edgeOrder = edgeOrders[edgeIdx].asUInt();
 
         // get the edge
-        const Json::Value* edge = findById(edges, edgeId);
+        const Json::Value* edge = findById(edges, edgeId, idIndices);
         if (edge){
           Json::Value vertexIds = edge->get("vertex_ids", Json::arrayValue);
           OS_ASSERT(2u == vertexIds.size());
 
           // get the vertices
           const Json::Value* nextVertex;
-          const Json::Value* vertex1 = findById(vertices, vertexIds[0].asString());
-          const Json::Value* vertex2 = findById(vertices, vertexIds[1].asString());
+          const Json::Value* vertex1 = findById(vertices, vertexIds[0].asString(), idIndices);
+          const Json::Value* vertex2 = findById(vertices, vertexIds[1].asString(), idIndices);
 
-          vertex1 = findById(vertices, vertexIds[0].asString());
-          vertex2 = findById(vertices, vertexIds[1].asString());
+          vertex1 = findById(vertices, vertexIds[0].asString(), idIndices);
+          vertex2 = findById(vertices, vertexIds[1].asString(), idIndices);
 
           if (edgeOrder == 1){
             nextVertex = vertex1;
@@ -704,8 +692,8 @@ namespace openstudio{
       allFinalfloorVertices.push_back(finalfloorVertices);
       allFinalRoofCeilingVertices.push_back(finalRoofCeilingVertices);
     }
-    makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "Floor", allFinalfloorVertices, roofCeilingFaceFormat, geometries, sceneChildren, 0, openToBelow);
-    makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "RoofCeiling", allFinalRoofCeilingVertices, roofCeilingFaceFormat, geometries, sceneChildren, 0, false);
+    makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "Floor", allFinalfloorVertices, roofCeilingFaceFormat, geometries, sceneChildren, 0, openToBelow, idIndices);
+    makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "RoofCeiling", allFinalRoofCeilingVertices, roofCeilingFaceFormat, geometries, sceneChildren, 0, false, idIndices);
 
     // create each wall
     std::set<unsigned> mappedWindows;
@@ -740,7 +728,7 @@ namespace openstudio{
 
             // get window definition
 
-            const Json::Value* windowDefinition = findById(windowDefinitions, windowDefinitionIds[windowIdx]);
+            const Json::Value* windowDefinition = findById(windowDefinitions, windowDefinitionIds[windowIdx], idIndices);
             if (windowDefinition){
               std::string windowDefinitionMode;
               if (checkKeyAndType(*windowDefinition, "window_definition_type", Json::stringValue)){
@@ -889,7 +877,7 @@ namespace openstudio{
 
             // get door definition
 
-            const Json::Value* doorDefinition = findById(doorDefinitions, doorDefinitionIds[doorIdx]);
+            const Json::Value* doorDefinition = findById(doorDefinitions, doorDefinitionIds[doorIdx], idIndices);
             if (doorDefinition){
 
               // "Door","Glass Door","Overhead Door"
@@ -964,14 +952,14 @@ namespace openstudio{
       }
 
       std::string parentSurfaceName;
-      parentSurfaceName = makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "Wall", allFinalWallVertices, finalWallFaceFormat, geometries, sceneChildren, 0, false);
+      parentSurfaceName = makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "Wall", allFinalWallVertices, finalWallFaceFormat, geometries, sceneChildren, 0, false, idIndices);
 
       std::vector<std::string> parentSubSurfaceNames;
       size_t finalWindowN = allFinalWindowVertices.size();
       OS_ASSERT(finalWindowN == allFinalWindowTypes.size());
       for (size_t finalWindowIdx = 0; finalWindowIdx < finalWindowN; ++finalWindowIdx){
         const auto& finalWindowVertices = allFinalWindowVertices[finalWindowIdx];
-        std::string parentSubSurfaceName = makeSurface(story, spaceOrShading, parentSurfaceName, "", belowFloorPlenum, aboveCeilingPlenum, allFinalWindowTypes[finalWindowIdx], Point3dVectorVector(1,finalWindowVertices), wallFaceFormat, geometries, sceneChildren, 0, false);
+        std::string parentSubSurfaceName = makeSurface(story, spaceOrShading, parentSurfaceName, "", belowFloorPlenum, aboveCeilingPlenum, allFinalWindowTypes[finalWindowIdx], Point3dVectorVector(1,finalWindowVertices), wallFaceFormat, geometries, sceneChildren, 0, false, idIndices);
         parentSubSurfaceNames.push_back(parentSubSurfaceName);
       }
 
@@ -979,7 +967,7 @@ namespace openstudio{
       OS_ASSERT(finalDoorN == allFinalDoorTypes.size());
       for (size_t finalDoorIdx = 0; finalDoorIdx < finalDoorN; ++finalDoorIdx){
         const auto& finalDoorVertices = allFinalDoorVertices[finalDoorIdx];
-        std::string parentSubSurfaceName = makeSurface(story, spaceOrShading, parentSurfaceName, "", belowFloorPlenum, aboveCeilingPlenum, allFinalDoorTypes[finalDoorIdx], Point3dVectorVector(1,finalDoorVertices), wallFaceFormat, geometries, sceneChildren, 0, false);
+        std::string parentSubSurfaceName = makeSurface(story, spaceOrShading, parentSurfaceName, "", belowFloorPlenum, aboveCeilingPlenum, allFinalDoorTypes[finalDoorIdx], Point3dVectorVector(1,finalDoorVertices), wallFaceFormat, geometries, sceneChildren, 0, false, idIndices);
         parentSubSurfaceNames.push_back(parentSubSurfaceName);
       }
 
@@ -987,7 +975,7 @@ namespace openstudio{
       OS_ASSERT(shadeN == allFinalShadeParentSubSurfaceIndices.size());
       for (size_t shadeIdx = 0; shadeIdx < shadeN; ++shadeIdx){
         std::string parentSubSurfaceName = parentSubSurfaceNames[allFinalShadeParentSubSurfaceIndices[shadeIdx]];
-        makeSurface(story, spaceOrShading, "", parentSubSurfaceName, belowFloorPlenum, aboveCeilingPlenum, "SpaceShading", Point3dVectorVector(1,allFinalShadeVertices[shadeIdx]), wallFaceFormat, geometries, sceneChildren, 0, false);
+        makeSurface(story, spaceOrShading, "", parentSubSurfaceName, belowFloorPlenum, aboveCeilingPlenum, "SpaceShading", Point3dVectorVector(1,allFinalShadeVertices[shadeIdx]), wallFaceFormat, geometries, sceneChildren, 0, false, idIndices);
       }
     }
 
@@ -996,7 +984,7 @@ namespace openstudio{
       assertKeyAndType(daylightingControl, "vertex_id", Json::stringValue);
       std::string vertexId = daylightingControl.get("vertex_id", "").asString();
 
-      const Json::Value* vertex = findById(vertices, vertexId);
+      const Json::Value* vertex = findById(vertices, vertexId, idIndices);
       if (vertex){
         assertKeyAndType(daylightingControl, "daylighting_control_definition_id", Json::stringValue);
         std::string daylightingControlDefinitionId = daylightingControl.get("daylighting_control_definition_id", "").asString();
@@ -1005,7 +993,7 @@ namespace openstudio{
         assertKeyAndType(*vertex, "y", Json::realValue);
 
 
-        const Json::Value* daylightingControlDefinition = findById(daylightingControlDefinitions, daylightingControlDefinitionId);
+        const Json::Value* daylightingControlDefinition = findById(daylightingControlDefinitions, daylightingControlDefinitionId, idIndices);
         if (daylightingControlDefinition){
           assertKey(*daylightingControlDefinition, "height");
           assertKey(*daylightingControlDefinition, "illuminance_setpoint");
@@ -1019,7 +1007,7 @@ namespace openstudio{
           dcVertices.push_back(Point3d(lengthToMeters * vertex->get("x", 0.0).asDouble() + 0.1, lengthToMeters * vertex->get("y", 0.0).asDouble() - 0.1, minZ + height));
           dcVertices.push_back(Point3d(lengthToMeters * vertex->get("x", 0.0).asDouble() - 0.1, lengthToMeters * vertex->get("y", 0.0).asDouble() - 0.1, minZ + height));
 
-          makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "DaylightingControl", Point3dVectorVector(1,dcVertices), wallFaceFormat, geometries, sceneChildren, illuminanceSetpoint, false);
+          makeSurface(story, spaceOrShading, "", "", belowFloorPlenum, aboveCeilingPlenum, "DaylightingControl", Point3dVectorVector(1,dcVertices), wallFaceFormat, geometries, sceneChildren, illuminanceSetpoint, false, idIndices);
         }
       }
     }
@@ -1066,6 +1054,7 @@ namespace openstudio{
   {
     m_plenumThermalZoneNames.clear();
     m_boundingBox = BoundingBox();
+    IdIndices idIndices;
 
     std::vector<ThreeGeometry> geometries;
     std::vector<ThreeSceneChild> children;
@@ -1110,7 +1099,7 @@ namespace openstudio{
     bool anyPlenums = false;
 
     // loop over stories
-    Json::Value stories = m_value.get("stories", Json::arrayValue);
+    const Json::Value& stories = m_value["stories"];
     Json::ArrayIndex storyN = stories.size();
     for (Json::ArrayIndex storyIdx = 0; storyIdx < storyN; ++storyIdx){
 
@@ -1177,10 +1166,10 @@ namespace openstudio{
 
       // get the geometry
       assertKeyAndType(stories[storyIdx], "geometry", Json::objectValue);
-      Json::Value geometry = stories[storyIdx].get("geometry", Json::arrayValue);
-      Json::Value vertices = geometry.get("vertices", Json::arrayValue);
-      Json::Value edges = geometry.get("edges", Json::arrayValue);
-      Json::Value faces = geometry.get("faces", Json::arrayValue);
+      const Json::Value& geometry = stories[storyIdx]["geometry"];
+      const Json::Value& vertices = geometry["vertices"];
+      const Json::Value& edges = geometry["edges"];
+      const Json::Value& faces = geometry["faces"];
 
       // loop over spaces
       Json::Value spaces = stories[storyIdx].get("spaces", Json::arrayValue);
@@ -1240,7 +1229,7 @@ namespace openstudio{
             spaceMetadata.setMultiplier(spaceMultiplier);
             spaceMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(spaceMetadata);
-            makeGeometries(stories[storyIdx], spaces[spaceIdx], true, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            makeGeometries(stories[storyIdx], spaces[spaceIdx], true, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow, idIndices);
             openToBelow = false; // no longer open
           }
 
@@ -1251,7 +1240,7 @@ namespace openstudio{
             spaceMetadata.setMultiplier(spaceMultiplier);
             spaceMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(spaceMetadata);
-            makeGeometries(stories[storyIdx], spaces[spaceIdx], false, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            makeGeometries(stories[storyIdx], spaces[spaceIdx], false, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow, idIndices);
             openToBelow = false; // no longer open
           }
 
@@ -1263,7 +1252,7 @@ namespace openstudio{
             spaceMetadata.setMultiplier(spaceMultiplier);
             spaceMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(spaceMetadata);
-            makeGeometries(stories[storyIdx], spaces[spaceIdx], false, true, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            makeGeometries(stories[storyIdx], spaces[spaceIdx], false, true, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow, idIndices);
             openToBelow = false; // no longer open
           }
         }
@@ -1328,7 +1317,7 @@ namespace openstudio{
             shadingMetadata.setMultiplier(shadingMultiplier);
             shadingMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(shadingMetadata);
-            makeGeometries(stories[storyIdx], shading[shadingdx], true, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            makeGeometries(stories[storyIdx], shading[shadingdx], true, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow, idIndices);
             openToBelow = false; // no longer open
           }
 
@@ -1339,7 +1328,7 @@ namespace openstudio{
             shadingMetadata.setMultiplier(shadingMultiplier);
             shadingMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(shadingMetadata);
-            makeGeometries(stories[storyIdx], shading[shadingdx], false, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            makeGeometries(stories[storyIdx], shading[shadingdx], false, false, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow, idIndices);
             openToBelow = false; // no longer open
           }
 
@@ -1351,7 +1340,7 @@ namespace openstudio{
             shadingMetadata.setMultiplier(shadingMultiplier);
             shadingMetadata.setOpenToBelow(openToBelow);
             modelObjectMetadata.push_back(shadingMetadata);
-            makeGeometries(stories[storyIdx], shading[shadingdx], false, true, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow);
+            makeGeometries(stories[storyIdx], shading[shadingdx], false, true, lengthToMeters, minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children, openToBelow, idIndices);
             openToBelow = false; // no longer open
           }
         }
@@ -1644,58 +1633,73 @@ namespace openstudio{
     return nullptr;
   }
 
-  Json::Value* FloorplanJS::findByName(Json::Value& value, const std::string& key, const std::string& name, bool requireEmptyHandle)
+  const Json::Value* FloorplanJS::findById(const Json::Value& values, const std::string& id, IdIndices& idIndices)
   {
-    if (name.empty()){
+    if (id.empty()){
       return nullptr;
     }
 
-    Json::Value& values = value[key];
+    // values always refers into m_value, which is not modified during toThreeScene
+    auto it = idIndices.find(&values);
+    if (it == idIndices.end()){
+      it = idIndices.insert(std::make_pair(&values, makeMemberIndex(values, "id"))).first;
+    }
+
+    auto indexIt = it->second.find(id);
+    if (indexIt == it->second.end() || indexIt->second.empty()){
+      return nullptr;
+    }
+
+    return &values[indexIt->second.front()];
+  }
+
+  FloorplanJS::MemberIndex FloorplanJS::makeMemberIndex(const Json::Value& values, const std::string& member)
+  {
+    MemberIndex result;
     Json::ArrayIndex n = values.size();
     for (Json::ArrayIndex i = 0; i < n; ++i){
-      if (getName(values[i]) == name){
-        if (requireEmptyHandle && getHandleString(values[i]).empty()){
-          return &values[i];
-        } else{
-          return &values[i];
-        }
+      std::string value = values[i].get(member, "").asString();
+      if (!value.empty()){
+        result[value].push_back(i);
       }
     }
-
-    return nullptr;
+    return result;
   }
 
-  Json::Value* FloorplanJS::findById(Json::Value& value, const std::string& key, const std::string& id)
+  void FloorplanJS::updateMemberIndex(MemberIndex& index, Json::ArrayIndex i, const std::string& oldValue, const std::string& newValue)
   {
-    if (id.empty()){
-      return nullptr;
+    if (oldValue == newValue){
+      return;
     }
 
-    Json::Value& values = value[key];
-    Json::ArrayIndex n = values.size();
-    for (Json::ArrayIndex i = 0; i < n; ++i){
-      if (getId(values[i]) == id){
-        return &values[i];
+    if (!oldValue.empty()){
+      auto it = index.find(oldValue);
+      if (it != index.end()){
+        auto indexIt = std::lower_bound(it->second.begin(), it->second.end(), i);
+        if (indexIt != it->second.end() && *indexIt == i){
+          it->second.erase(indexIt);
+        }
       }
     }
 
-    return nullptr;
+    if (!newValue.empty()){
+      std::vector<Json::ArrayIndex>& indices = index[newValue];
+      indices.insert(std::lower_bound(indices.begin(), indices.end(), i), i);
+    }
   }
 
-  const Json::Value* FloorplanJS::findById(const Json::Value& values, const std::string& id) const
+  Json::Value* FloorplanJS::findInMemberIndex(Json::Value& values, const MemberIndex& index, const std::string& value)
   {
-    if (id.empty()){
+    if (value.empty()){
       return nullptr;
     }
 
-    Json::ArrayIndex n = values.size();
-    for (Json::ArrayIndex i = 0; i < n; ++i){
-      if (getId(values[i]) == id){
-        return &values[i];
-      }
+    auto it = index.find(value);
+    if (it == index.end() || it->second.empty()){
+      return nullptr;
     }
 
-    return nullptr;
+    return &values[it->second.front()];
   }
 
   void FloorplanJS::updateObjects(Json::Value& value, const std::string& key, const std::vector<FloorplanObject>& objects, bool removeMissingObjects)
@@ -1750,19 +1754,28 @@ namespace openstudio{
       }
     }
 
-    // now update names and data
+    // now update names and data, indices are kept current as objects are renamed or added
+    Json::Value& values = value[key];
+    MemberIndex handleIndex = makeMemberIndex(values, "handle");
+    MemberIndex nameIndex = makeMemberIndex(values, "name");
+    std::map<std::string, ReferenceIndex> referenceIndices;
+
     for (const auto& object : objects){
 
-      Json::Value* v = findByHandleString(value, key, object.handleString());
+      Json::Value* v = findInMemberIndex(values, handleIndex, object.handleString());
       if (v){
         // ensure name is the same
+        Json::ArrayIndex i = handleIndex[object.handleString()].front();
+        updateMemberIndex(nameIndex, i, getName(*v), object.name());
         (*v)["name"] = object.name();
       } else {
         // find object by name only if handle is empty
-        v = findByName(value, key, object.name(), true);
+        v = findInMemberIndex(values, nameIndex, object.name());
 
         if (v){
           // set handle
+          Json::ArrayIndex i = nameIndex[object.name()].front();
+          updateMemberIndex(handleIndex, i, getHandleString(*v), object.handleString());
           (*v)["handle"] = object.handleString();
         } else{
           // create new object
@@ -1770,7 +1783,10 @@ namespace openstudio{
           newObject["id"] = getNextId();
           newObject["name"] = object.name();
           newObject["handle"] = object.handleString();
-          v = &(value[key].append(newObject));
+          Json::ArrayIndex i = values.size();
+          v = &(values.append(newObject));
+          updateMemberIndex(handleIndex, i, "", object.handleString());
+          updateMemberIndex(nameIndex, i, "", object.name());
         }
       }
 
@@ -1783,13 +1799,19 @@ namespace openstudio{
 
         // update references
         for (const auto& p : object.objectReferenceMap()){
-          updateObjectReference(*v, p.first, p.second, removeMissingObjects);
+          updateObjectReference(*v, p.first, p.second, removeMissingObjects, referenceIndices);
         }
       }
+
+      // objects of this type may reference each other
+      if (&value == &m_value){
+        referenceIndices.erase(key);
+      }
     }
   }
 
-  void FloorplanJS::updateObjectReference(Json::Value& value, const std::string& key, const FloorplanObject& objectReference, bool removeMissingObjects)
+  void FloorplanJS::updateObjectReference(Json::Value& value, const std::string& key, const FloorplanObject& objectReference, bool removeMissingObjects,
+    std::map<std::string, ReferenceIndex>& referenceIndices)
   {
     std::string searchKey;
     if (key == "thermal_zone_id"){
@@ -1807,19 +1829,30 @@ namespace openstudio{
       return;
     }
 
-    Json::Value* v = findByHandleString(m_value, searchKey, objectReference.handleString());
+    // referenced objects are not modified while updating the referencing objects, index them once per update
+    Json::Value& values = m_value[searchKey];
+    auto it = referenceIndices.find(searchKey);
+    if (it == referenceIndices.end()){
+      ReferenceIndex referenceIndex;
+      referenceIndex.handles = makeMemberIndex(values, "handle");
+      referenceIndex.ids = makeMemberIndex(values, "id");
+      referenceIndex.names = makeMemberIndex(values, "name");
+      it = referenceIndices.insert(std::make_pair(searchKey, referenceIndex)).first;
+    }
+
+    Json::Value* v = findInMemberIndex(values, it->second.handles, objectReference.handleString());
     if (v){
       value[key] = v->get("id", "").asString();
       return;
     }
 
-    v = findById(m_value, searchKey, objectReference.id());
+    v = findInMemberIndex(values, it->second.ids, objectReference.id());
     if (v){
       value[key] = v->get("id", "").asString();
       return;
     }
 
-    v = findByName(m_value, searchKey, objectReference.name(), true);
+    v = findInMemberIndex(values, it->second.names, objectReference.name());
     if (v){
       value[key] = v->get("id", "").asString();
       return;
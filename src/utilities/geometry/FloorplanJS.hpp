@@ -43,6 +43,8 @@
 
 #include <vector>
 #include <set>
+#include <map>
+#include <unordered_map>
 #include <boost/optional.hpp>
 
 namespace openstudio{
@@ -177,13 +179,19 @@ namespace openstudio{
 
     ThreeModelObjectMetadata makeModelObjectMetadata(const std::string& iddObjectType, const Json::Value& object) const;
 
+    // maps a member value (e.g. id, handle, or name) to the indices of array elements with that value, in ascending order
+    typedef std::unordered_map<std::string, std::vector<Json::ArrayIndex> > MemberIndex;
+
+    // id indices of the arrays searched by findById during one toThreeScene call, keyed by array address
+    typedef std::map<const Json::Value*, MemberIndex> IdIndices;
+
     void makeGeometries(const Json::Value& story, const Json::Value& spaceOrShading, bool belowFloorPlenum, bool aboveCeilingPlenum,
       double lengthToMeters, double minZ, double maxZ, const Json::Value& vertices, const Json::Value& edges, const Json::Value& faces, const std::string& faceId,
-      bool openstudioFormat, std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, bool openToBelow) const;
+      bool openstudioFormat, std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, bool openToBelow, IdIndices& idIndices) const;
 
     std::string makeSurface(const Json::Value& story, const Json::Value& spaceOrShading, const std::string& parentSurfaceName, const std::string& parentSubSurfaceName,
       bool belowFloorPlenum, bool aboveCeilingPlenum, const std::string& surfaceType, const Point3dVectorVector& finalFaceVertices, size_t faceFormat,
-      std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, double illuminanceSetpoint, bool airWall) const;
+      std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren, double illuminanceSetpoint, bool airWall, IdIndices& idIndices) const;
 
     void makeMaterial(const Json::Value& object, const std::string& iddObjectType, std::vector<ThreeMaterial>& materials, std::map<std::string, std::string>& materialMap) const;
 
@@ -198,13 +206,22 @@ namespace openstudio{
     void setLastId(const Json::Value& value);
 
     Json::Value* findByHandleString(Json::Value& value, const std::string& key, const std::string& handleString);
-    Json::Value* findByName(Json::Value& value, const std::string& key, const std::string& name, bool requireEmptyHandle);
-    Json::Value* findById(Json::Value& value, const std::string& key, const std::string& id);
 
-    const Json::Value* findById(const Json::Value& values, const std::string& id) const;
+    static const Json::Value* findById(const Json::Value& values, const std::string& id, IdIndices& idIndices);
+
+    struct ReferenceIndex {
+      MemberIndex handles;
+      MemberIndex ids;
+      MemberIndex names;
+    };
+
+    static MemberIndex makeMemberIndex(const Json::Value& values, const std::string& member);
+    static void updateMemberIndex(MemberIndex& index, Json::ArrayIndex i, const std::string& oldValue, const std::string& newValue);
+    static Json::Value* findInMemberIndex(Json::Value& values, const MemberIndex& index, const std::string& value);
 
     void updateObjects(Json::Value& value, const std::string& key, const std::vector<FloorplanObject>& objects, bool removeMissingObjects);
-    void updateObjectReference(Json::Value& value, const std::string& key, const FloorplanObject& objectReference, bool removeMissingObjects);
+    void updateObjectReference(Json::Value& value, const std::string& key, const FloorplanObject& objectReference, bool removeMissingObjects,
+      std::map<std::string, ReferenceIndex>& referenceIndices);
 
     void removeFaces(Json::Value& value, const std::set<std::string>& faceIdsToRemove);
     void removeEdges(Json::Value& value, const std::set<std::string>& edgeIdsToRemove);
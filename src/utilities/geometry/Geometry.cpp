@@ -35,6 +35,9 @@
 #include "../core/Assert.hpp"
 
 #include <boost/math/constants/constants.hpp>
+#include <boost/functional/hash.hpp>
+
+#include <cmath>
 
 #include <polypartition/polypartition.h>
 
@@ -466,6 +469,76 @@ namespace openstudio{
     return point3d;
   }
 
+  VertexWelder::VertexWelder(double tol)
+    : m_tol(tol), m_cellSize(2.0*tol)
+  {
+  }
+
+  size_t VertexWelder::CellHash::operator()(const std::array<long long, 3>& cell) const
+  {
+    size_t result = 0;
+    for (long long c : cell){
+      boost::hash_combine(result, c);
+    }
+    return result;
+  }
+
+  size_t VertexWelder::index(const Point3d& point)
+  {
+    // cells are twice the tolerance so any vertex within tol is in the same or an adjacent cell
+    bool hashable = (m_tol > 0) && std::isfinite(point.x()) && std::isfinite(point.y()) && std::isfinite(point.z());
+    if (!hashable){
+      m_vertices.push_back(point);
+      return (m_vertices.size() - 1);
+    }
+
+    long long cx = static_cast<long long>(std::floor(point.x() / m_cellSize));
+    long long cy = static_cast<long long>(std::floor(point.y() / m_cellSize));
+    long long cz = static_cast<long long>(std::floor(point.z() / m_cellSize));
+
+    size_t result = m_vertices.size();
+    std::array<long long, 3> cell;
+    for (long long dx = -1; dx <= 1; ++dx){
+      for (long long dy = -1; dy <= 1; ++dy){
+        for (long long dz = -1; dz <= 1; ++dz){
+          cell[0] = cx + dx;
+          cell[1] = cy + dy;
+          cell[2] = cz + dz;
+          auto it = m_cells.find(cell);
+          if (it == m_cells.end()){
+            continue;
+          }
+          for (size_t i : it->second){
+            if (i >= result){
+              break;
+            }
+            const Point3d& other = m_vertices[i];
+            if (std::sqrt(std::pow(point.x()-other.x(), 2) + std::pow(point.y()-other.y(), 2) + std::pow(point.z()-other.z(), 2)) < m_tol){
+              result = i;
+              break;
+            }
+          }
+        }
+      }
+    }
+
+    if (result < m_vertices.size()){
+      return result;
+    }
+
+    cell[0] = cx;
+    cell[1] = cy;
+    cell[2] = cz;
+    m_cells[cell].push_back(m_vertices.size());
+    m_vertices.push_back(point);
+    return (m_vertices.size() - 1);
+  }
+
+  const std::vector<Point3d>& VertexWelder::vertices() const
+  {
+    return m_vertices;
+  }
+
   std::vector<std::vector<Point3d> > computeTriangulation(const Point3dVector& vertices, const std::vector<std::vector<Point3d> >& holes, double tol)
   {
     std::vector<std::vector<Point3d> > result;
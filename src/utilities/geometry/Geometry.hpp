@@ -32,7 +32,11 @@
 
 #include "../UtilitiesAPI.hpp"
 
+#include "Point3d.hpp"
+
 #include <vector>
+#include <array>
+#include <unordered_map>
 #include <boost/optional.hpp>
 
 namespace openstudio{
@@ -94,6 +98,32 @@ namespace openstudio{
   /// otherwise adds point3d to allPoints and returns point3d
   UTILITIES_API Point3d getCombinedPoint(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001);
 
+  /** VertexWelder assigns an index to each distinct vertex, a vertex within tol of a previously added vertex
+   *  gets the index of the first such vertex.  The result is the same as a linear search over all previous
+   *  vertices, but vertices are bucketed in a spatial hash so each lookup only checks nearby vertices. */
+  class UTILITIES_API VertexWelder {
+  public:
+
+    explicit VertexWelder(double tol = 0.001);
+
+    /// returns the index of the first vertex within tol of point, adds point if there is none
+    size_t index(const Point3d& point);
+
+    /// all distinct vertices in the order they were added
+    const std::vector<Point3d>& vertices() const;
+
+  private:
+
+    struct CellHash {
+      size_t operator()(const std::array<long long, 3>& cell) const;
+    };
+
+    double m_tol;
+    double m_cellSize;
+    std::vector<Point3d> m_vertices;
+    std::unordered_map<std::array<long long, 3>, std::vector<size_t>, CellHash> m_cells;
+  };
+
   /// compute triangulation of vertices, holes are removed in the triangulation
   /// requires that vertices and holes are in clockwise order on the z = 0 plane (i.e. in face coordinates but reversed)
   UTILITIES_API std::vector<std::vector<Point3d> > computeTriangulation(const std::vector<Point3d>& vertices, const std::vector<std::vector<Point3d> >& holes, double tol = 0.001);
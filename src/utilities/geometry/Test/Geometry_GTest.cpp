@@ -1090,4 +1090,39 @@ TEST_F(GeometryFixture, PointLatLon_Elevation)
   EXPECT_NEAR(-42.521429845143913, test.x(), 0.001);
   EXPECT_NEAR(0.0, test.y(), 0.001);
   EXPECT_NEAR(30.0, test.z(), 0.001);
-}
\ No newline at end of file
+}
+
+TEST_F(GeometryFixture, VertexWelder)
+{
+  double tol = 0.001;
+  VertexWelder welder(tol);
+  EXPECT_EQ(0u, welder.index(Point3d(0, 0, 0)));
+  EXPECT_EQ(1u, welder.index(Point3d(1, 0, 0)));
+  EXPECT_EQ(0u, welder.index(Point3d(0.0005, 0, 0)));
+  EXPECT_EQ(0u, welder.index(Point3d(-0.0005, -0.0005, 0)));
+  EXPECT_EQ(1u, welder.index(Point3d(1, 0.0009, 0)));
+  EXPECT_EQ(2u, welder.index(Point3d(1, 0.0011, 0)));
+  ASSERT_EQ(3u, welder.vertices().size());
+  EXPECT_EQ(Point3d(1, 0.0011, 0), welder.vertices()[2]);
+
+  // compare to a linear search on a grid with spacing close to the tolerance
+  std::vector<Point3d> allPoints;
+  VertexWelder welder2(tol);
+  for (unsigned i = 0; i < 2000; ++i){
+    Point3d point(0.0007*(i % 13), 0.0009*((i / 13) % 11), 0.0004*(i % 7) - 10.0);
+
+    size_t expected = allPoints.size();
+    for (size_t j = 0; j < allPoints.size(); ++j){
+      if (getDistance(point, allPoints[j]) < tol){
+        expected = j;
+        break;
+      }
+    }
+    if (expected == allPoints.size()){
+      allPoints.push_back(point);
+    }
+
+    EXPECT_EQ(expected, welder2.index(point));
+  }
+  EXPECT_EQ(allPoints.size(), welder2.vertices().size());
+}
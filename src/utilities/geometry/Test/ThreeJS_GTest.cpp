@@ -60,3 +60,22 @@ TEST_F(GeometryFixture, ThreeJS)
   scene = ThreeScene::load(toString(p));
   ASSERT_TRUE(scene);
 }
+
+TEST_F(GeometryFixture, ThreeJS_WriteJSON)
+{
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/threejs.json");
+  ASSERT_TRUE(exists(p));
+
+  boost::optional<ThreeScene> scene = ThreeScene::load(toString(p));
+  ASSERT_TRUE(scene);
+
+  std::stringstream ss;
+  scene->writeJSON(ss);
+  EXPECT_EQ(scene->toJSON(false), ss.str());
+
+  boost::optional<ThreeScene> scene2 = ThreeScene::load(ss.str());
+  ASSERT_TRUE(scene2);
+  EXPECT_EQ(scene->geometries().size(), scene2->geometries().size());
+  EXPECT_EQ(scene->materials().size(), scene2->materials().size());
+  EXPECT_EQ(scene->object().children().size(), scene2->object().children().size());
+}
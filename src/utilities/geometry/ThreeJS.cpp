@@ -38,10 +38,20 @@
 #include <json/json.h>
 
 #include <iostream>
+#include <set>
 #include <string>
 
 namespace openstudio{
 
+  /// builder matching the compact output of ThreeScene::toJSON
+  static Json::StreamWriterBuilder compactThreeJSWriterBuilder()
+  {
+    Json::StreamWriterBuilder wbuilder;
+    wbuilder["commentStyle"] = "None";
+    wbuilder["indentation"] = "";
+    return wbuilder;
+  }
+
   unsigned openstudioFaceFormatId()
   {
     return 1024;
@@ -390,6 +400,39 @@ namespace openstudio{
     return result;
   }
 
+  void ThreeScene::writeJSON(std::ostream& os) const
+  {
+    Json::StreamWriterBuilder wbuilder = compactThreeJSWriterBuilder();
+
+    // keys are written in the sorted order Json::Value uses for objects
+    os << "{\"geometries\":[";
+    bool first = true;
+    for (const auto& g : m_geometries) {
+      if (!first){
+        os << ",";
+      }
+      first = false;
+      os << Json::writeString(wbuilder, g.toJsonValue());
+    }
+
+    os << "],\"materials\":[";
+    first = true;
+    for (const auto& m : m_materials){
+      if (!first){
+        os << ",";
+      }
+      first = false;
+      os << Json::writeString(wbuilder, m.toJsonValue());
+    }
+
+    os << "],\"metadata\":" << Json::writeString(wbuilder, m_metadata.toJsonValue());
+
+    os << ",\"object\":";
+    m_sceneObject.writeJsonValue(os);
+
+    os << "}";
+  }
+
   ThreeSceneMetadata ThreeScene::metadata() const
   {
     return m_metadata;
@@ -430,6 +473,152 @@ namespace openstudio{
     return m_sceneObject;
   }
 
+  ThreeSceneDelta::ThreeSceneDelta(const std::vector<ThreeGeometry>& addedGeometries, const std::vector<ThreeSceneChild>& addedChildren,
+                                   const std::vector<ThreeGeometry>& modifiedGeometries, const std::vector<ThreeSceneChild>& modifiedChildren,
+                                   const std::vector<std::string>& removedGeometryIds, const std::vector<ThreeMaterial>& materials)
+    : m_addedGeometries(addedGeometries), m_addedChildren(addedChildren), m_modifiedGeometries(modifiedGeometries), m_modifiedChildren(modifiedChildren),
+      m_removedGeometryIds(removedGeometryIds), m_materials(materials)
+  {
+    OS_ASSERT(m_addedGeometries.size() == m_addedChildren.size());
+    OS_ASSERT(m_modifiedGeometries.size() == m_modifiedChildren.size());
+  }
+
+  bool ThreeSceneDelta::empty() const
+  {
+    return (m_addedGeometries.empty() && m_modifiedGeometries.empty() && m_removedGeometryIds.empty());
+  }
+
+  std::vector<ThreeGeometry> ThreeSceneDelta::addedGeometries() const
+  {
+    return m_addedGeometries;
+  }
+
+  std::vector<ThreeSceneChild> ThreeSceneDelta::addedChildren() const
+  {
+    return m_addedChildren;
+  }
+
+  std::vector<ThreeGeometry> ThreeSceneDelta::modifiedGeometries() const
+  {
+    return m_modifiedGeometries;
+  }
+
+  std::vector<ThreeSceneChild> ThreeSceneDelta::modifiedChildren() const
+  {
+    return m_modifiedChildren;
+  }
+
+  std::vector<std::string> ThreeSceneDelta::removedGeometryIds() const
+  {
+    return m_removedGeometryIds;
+  }
+
+  std::vector<ThreeMaterial> ThreeSceneDelta::materials() const
+  {
+    return m_materials;
+  }
+
+  ThreeScene ThreeSceneDelta::apply(const ThreeScene& scene) const
+  {
+    std::set<std::string> removedIds(m_removedGeometryIds.begin(), m_removedGeometryIds.end());
+
+    std::map<std::string, size_t> modifiedIndices;
+    for (size_t i = 0; i < m_modifiedGeometries.size(); ++i){
+      modifiedIndices[m_modifiedGeometries[i].uuid()] = i;
+    }
+
+    std::vector<ThreeGeometry> geometries;
+    for (const auto& geometry : scene.geometries()){
+      std::string uuid = geometry.uuid();
+      if (removedIds.find(uuid) != removedIds.end()){
+        continue;
+      }
+      auto it = modifiedIndices.find(uuid);
+      if (it != modifiedIndices.end()){
+        geometries.push_back(m_modifiedGeometries[it->second]);
+      } else{
+        geometries.push_back(geometry);
+      }
+    }
+    geometries.insert(geometries.end(), m_addedGeometries.begin(), m_addedGeometries.end());
+
+    ThreeSceneObject sceneObject = scene.object();
+    std::vector<ThreeSceneChild> children;
+    for (const auto& child : sceneObject.children()){
+      std::string geometryId = child.geometry();
+      if (removedIds.find(geometryId) != removedIds.end()){
+        continue;
+      }
+      auto it = modifiedIndices.find(geometryId);
+      if (it != modifiedIndices.end()){
+        children.push_back(m_modifiedChildren[it->second]);
+      } else{
+        children.push_back(child);
+      }
+    }
+    children.insert(children.end(), m_addedChildren.begin(), m_addedChildren.end());
+
+    std::vector<ThreeMaterial> materials = m_materials;
+    if (materials.empty()){
+      materials = scene.materials();
+    }
+
+    return ThreeScene(scene.metadata(), geometries, materials, ThreeSceneObject(sceneObject.uuid(), children));
+  }
+
+  std::string ThreeSceneDelta::toJSON(bool prettyPrint) const
+  {
+    Json::Value delta(Json::objectValue);
+
+    Json::Value addedGeometries(Json::arrayValue);
+    for (const auto& g : m_addedGeometries) {
+      addedGeometries.append(g.toJsonValue());
+    }
+    delta["addedGeometries"] = addedGeometries;
+
+    Json::Value addedChildren(Json::arrayValue);
+    for (const auto& c : m_addedChildren) {
+      addedChildren.append(c.toJsonValue());
+    }
+    delta["addedChildren"] = addedChildren;
+
+    Json::Value modifiedGeometries(Json::arrayValue);
+    for (const auto& g : m_modifiedGeometries) {
+      modifiedGeometries.append(g.toJsonValue());
+    }
+    delta["modifiedGeometries"] = modifiedGeometries;
+
+    Json::Value modifiedChildren(Json::arrayValue);
+    for (const auto& c : m_modifiedChildren) {
+      modifiedChildren.append(c.toJsonValue());
+    }
+    delta["modifiedChildren"] = modifiedChildren;
+
+    Json::Value removedGeometryIds(Json::arrayValue);
+    for (const auto& id : m_removedGeometryIds) {
+      removedGeometryIds.append(id);
+    }
+    delta["removedGeometryIds"] = removedGeometryIds;
+
+    Json::Value materials(Json::arrayValue);
+    for (const auto& m : m_materials){
+      materials.append(m.toJsonValue());
+    }
+    delta["materials"] = materials;
+
+    // write to string
+    Json::StreamWriterBuilder wbuilder;
+
+    if (prettyPrint) {
+      wbuilder["commentStyle"] = "All";
+      wbuilder["indentation"] = "   ";
+    } else {
+      wbuilder = compactThreeJSWriterBuilder();
+    }
+
+    return Json::writeString(wbuilder, delta);
+  }
+
   ThreeGeometryData::ThreeGeometryData(const std::vector<double>& vertices, const std::vector<size_t>& faces)
     : m_vertices(vertices), m_normals(), m_uvs(), m_faces(faces), m_scale(1.0), m_visible(true), m_castShadow(true), m_receiveShadow(true), m_doubleSided(true)
   {}
@@ -1417,6 +1606,31 @@ namespace openstudio{
     return result;
   }
 
+  void ThreeSceneObject::writeJsonValue(std::ostream& os) const
+  {
+    Json::StreamWriterBuilder wbuilder = compactThreeJSWriterBuilder();
+
+    os << "{\"children\":[";
+    bool first = true;
+    for (const auto& c : m_children){
+      if (!first){
+        os << ",";
+      }
+      first = false;
+      os << Json::writeString(wbuilder, c.toJsonValue());
+    }
+
+    Json::Value sceneMatrix(Json::arrayValue);
+    for (const auto& d : m_matrix){
+      sceneMatrix.append(d);
+    }
+
+    os << "],\"matrix\":" << Json::writeString(wbuilder, sceneMatrix);
+    os << ",\"type\":" << Json::writeString(wbuilder, Json::Value(m_type));
+    os << ",\"uuid\":" << Json::writeString(wbuilder, Json::Value(m_uuid));
+    os << "}";
+  }
+
   std::string ThreeSceneObject::uuid() const
   {
     return m_uuid;
@@ -39,6 +39,7 @@
 
 #include <vector>
 #include <map>
+#include <iosfwd>
 #include <boost/optional.hpp>
 
 namespace Json{
@@ -136,6 +137,7 @@ namespace openstudio{
 
   private:
     friend class ThreeScene;
+    friend class ThreeSceneDelta;
     ThreeGeometry(const Json::Value& json);
     Json::Value toJsonValue() const;
 
@@ -165,6 +167,7 @@ namespace openstudio{
 
   private:
     friend class ThreeScene;
+    friend class ThreeSceneDelta;
     ThreeMaterial(const Json::Value& json);
     Json::Value toJsonValue() const;
 
@@ -364,6 +367,7 @@ namespace openstudio{
 
   private:
     friend class ThreeSceneObject;
+    friend class ThreeSceneDelta;
     ThreeSceneChild(const Json::Value& json);
     Json::Value toJsonValue() const;
 
@@ -389,6 +393,7 @@ namespace openstudio{
     friend class ThreeScene;
     ThreeSceneObject(const Json::Value& json);
     Json::Value toJsonValue() const;
+    void writeJsonValue(std::ostream& os) const;
 
     std::string m_uuid;
     std::string m_type;
@@ -542,6 +547,10 @@ namespace openstudio{
     /// print to JSON
     std::string toJSON(bool prettyPrint = false) const;
 
+    /// write JSON to a stream one geometry and child at a time, never building the whole document in memory
+    /// output is identical to toJSON(false)
+    void writeJSON(std::ostream& os) const;
+
     ThreeSceneMetadata metadata() const;
     std::vector<ThreeGeometry> geometries() const;
     boost::optional<ThreeGeometry> getGeometry(const std::string& geometryId) const;
@@ -560,6 +569,45 @@ namespace openstudio{
     ThreeSceneObject m_sceneObject;
   };
 
+  /** ThreeSceneDelta holds the geometries and scene children which were added, modified, or removed since a previous ThreeScene.
+  *   Geometries are matched by uuid and scene children are matched to geometries by geometry id, added and modified geometries
+  *   and children are stored in parallel vectors.  Materials are carried in full as they are few and cheap to translate.
+  */
+  class UTILITIES_API ThreeSceneDelta{
+  public:
+
+    /// constructor
+    ThreeSceneDelta(const std::vector<ThreeGeometry>& addedGeometries, const std::vector<ThreeSceneChild>& addedChildren,
+                    const std::vector<ThreeGeometry>& modifiedGeometries, const std::vector<ThreeSceneChild>& modifiedChildren,
+                    const std::vector<std::string>& removedGeometryIds, const std::vector<ThreeMaterial>& materials);
+
+    /// true if there are no added, modified, or removed geometries
+    bool empty() const;
+
+    std::vector<ThreeGeometry> addedGeometries() const;
+    std::vector<ThreeSceneChild> addedChildren() const;
+    std::vector<ThreeGeometry> modifiedGeometries() const;
+    std::vector<ThreeSceneChild> modifiedChildren() const;
+    std::vector<std::string> removedGeometryIds() const;
+    std::vector<ThreeMaterial> materials() const;
+
+    /// apply this delta to a scene, scene metadata is not changed
+    ThreeScene apply(const ThreeScene& scene) const;
+
+    /// print to JSON
+    std::string toJSON(bool prettyPrint = false) const;
+
+  private:
+    REGISTER_LOGGER("openstudio.utilities.ThreeSceneDelta");
+
+    std::vector<ThreeGeometry> m_addedGeometries;
+    std::vector<ThreeSceneChild> m_addedChildren;
+    std::vector<ThreeGeometry> m_modifiedGeometries;
+    std::vector<ThreeSceneChild> m_modifiedChildren;
+    std::vector<std::string> m_removedGeometryIds;
+    std::vector<ThreeMaterial> m_materials;
+  };
+
 } // openstudio
 
 #endif //UTILITIES_GEOMETRY_THREEJS_HPP
@@ -100,16 +100,10 @@ namespace detail {
   }
 
   boost::optional<IddObject> IddFile_Impl::versionObject() const {
-    if (m_versionObject) {
-      return m_versionObject;
-    }
-
     OptionalIddObject result;
-    IddObjectVector candidates = getObjects(iddRegex::versionObjectName());
-    if (candidates.size() == 1u) {
-      result = candidates[0];
+    if (m_versionObjectCandidates.size() == 1u) {
+      result = m_versionObjectCandidates[0];
     }
-    m_versionObject = result;
     return result;
   }
 
@@ -183,7 +177,7 @@ namespace detail {
 
   void IddFile_Impl::addObject(const IddObject& object)
   {
-    m_objects.push_back(object);
+    pushObject(object);
   }
 
   // SERIALIZATION
@@ -220,6 +214,14 @@ namespace detail {
 
   // PRIVATE
 
+  void IddFile_Impl::pushObject(const IddObject& object)
+  {
+    m_objects.push_back(object);
+    if (boost::regex_match(object.name(), iddRegex::versionObjectName())) {
+      m_versionObjectCandidates.push_back(object);
+    }
+  }
+
   void IddFile_Impl::parse(std::istream& is)
   {
 
@@ -243,7 +245,7 @@ namespace detail {
                                                           iddRegex::commentOnlyObjectText(),
                                                           IddObjectType::CommentOnly);
     OS_ASSERT(commentOnlyObject);
-    m_objects.push_back(*commentOnlyObject);
+    pushObject(*commentOnlyObject);
 
     // temp string to read file
     std::string line;
@@ -365,7 +367,7 @@ namespace detail {
         OptionalIddObject object = IddObject::load(objectName, currentGroup, text);
 
         // construct a new object and put it in the object vector
-        if (object) { m_objects.push_back(*object); }
+        if (object) { pushObject(*object); }
         else {
           LOG_AND_THROW("Unable to construct IddObject from text: " << std::endl << text);
         }
@@ -120,6 +120,9 @@ namespace detail{
 
    private:
 
+    /// Append object to m_objects, and to m_versionObjectCandidates if it may be the Version object.
+    void pushObject(const IddObject& object);
+
     /// Parse file text to populate this IddFile.
     void parse(std::istream& is);
 
@@ -135,8 +138,9 @@ namespace detail{
     /// The vector of IddObjects that constitute this IddFile.
     std::vector<IddObject> m_objects;
 
-    /// Cache the Version IddObject
-    mutable boost::optional<IddObject> m_versionObject;
+    /// The IddObjects in m_objects whose names match iddRegex::versionObjectName(). Kept up to date by
+    /// pushObject rather than computed lazily, so that const access is thread safe.
+    std::vector<IddObject> m_versionObjectCandidates;
 
     /// Configure logging.
     REGISTER_LOGGER("utilities.idd.IddFile");
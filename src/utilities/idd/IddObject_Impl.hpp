@@ -195,7 +195,8 @@ namespace detail {
                                        // extensible field group
     std::vector<unsigned> m_urlIdx;
     // .first = hasNameField(); .second = nameFieldIndex
-    mutable boost::optional< std::pair<bool,unsigned> > m_nameFieldCache;
+    // kept up to date when m_fields changes rather than computed lazily, so that const access is thread safe
+    std::pair<bool,unsigned> m_nameFieldCache;
 
     // partial constructor used by load
     IddObject_Impl(const std::string& name, const std::string& group, IddObjectType type);
@@ -203,6 +204,9 @@ namespace detail {
     // parse
     void parse(const std::string& text);
 
+    // set m_nameFieldCache from m_fields
+    void updateNameFieldCache();
+
     void parseObject(const std::string& text);
     void parseProperty(const std::string& text);
     void parseFields(const std::string& text);
@@ -9,10 +9,12 @@
   #include <utilities/idf/IdfObject.hpp>
   #include <utilities/idf/IdfObjectWatcher.hpp>
   #include <utilities/idf/IdfFile.hpp>
+  #include <utilities/idf/IdfFileIndex.hpp>
   #include <utilities/idf/ImfFile.hpp>
   #include <utilities/idf/Workspace.hpp>
   #include <utilities/idf/Workspace_Impl.hpp>
   #include <utilities/idf/WorkspaceWatcher.hpp>
+  #include <utilities/idf/WorkspaceChangeTracker.hpp>
   #include <utilities/idf/WorkspaceExtensibleGroup.hpp>
   #include <utilities/idf/WorkspaceObject.hpp>
   #include <utilities/idf/WorkspaceObjectOrder.hpp>
@@ -72,6 +74,9 @@
 %template(OptionalIdfObject) boost::optional<openstudio::IdfObject>;
 %template(OptionalIdfFile) boost::optional<openstudio::IdfFile>;
 %template(OptionalImfFile) boost::optional<openstudio::ImfFile>;
+%template(OptionalIdfFileIndex) boost::optional<openstudio::IdfFileIndex>;
+%template(OptionalIdfObjectIndexEntry) boost::optional<openstudio::IdfObjectIndexEntry>;
+%template(IdfObjectIndexEntryVector) std::vector<openstudio::IdfObjectIndexEntry>;
 %template(OptionalWorkspace) boost::optional<openstudio::Workspace>;
 %template(OptionalWorkspaceObject) boost::optional<openstudio::WorkspaceObject>;
 %template(OptionalWorkspaceExtensibleGroup) boost::optional<openstudio::WorkspaceExtensibleGroup>;
@@ -135,6 +140,7 @@
 %include <utilities/idf/IdfExtensibleGroup.hpp>
 %include <utilities/idf/ImfFile.hpp>
 %include <utilities/idf/IdfFile.hpp>
+%include <utilities/idf/IdfFileIndex.hpp>
 %include <utilities/idf/ObjectOrderBase.hpp>
 %include <utilities/idf/WorkspaceObjectOrder.hpp>
 %include <utilities/idf/WorkspaceExtensibleGroup.hpp>
@@ -150,6 +156,8 @@
 %feature("director") WorkspaceWatcher;
 %include <utilities/idf/WorkspaceWatcher.hpp>
 
+%include <utilities/idf/WorkspaceChangeTracker.hpp>
+
 %extend openstudio::IdfObject{
   std::string __str__() const {
     std::ostringstream os;
@@ -41,12 +41,15 @@
 #include "../plot/ProgressBar.hpp"
 #include "../core/PathHelpers.hpp"
 #include "../core/Assert.hpp"
+#include "../core/ParallelFor.hpp"
 
 
 
 #include <boost/iostreams/filter/newline.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <algorithm>
+
 
 namespace openstudio {
 
@@ -472,12 +475,30 @@ boost::optional<VersionString> IdfFile::loadVersionOnly(const path& p) {
 }
 
 std::ostream& IdfFile::print(std::ostream& os) const {
+  std::string header;
   if (!m_header.empty()) {
-    os << m_header << std::endl;
+    header += m_header;
+    header += '\n';
   }
-  os << std::endl;
-  for (const IdfObject& object : m_objects){
-    object.print(os);
+  header += '\n';
+  os.write(header.data(),header.size());
+
+  // objects are formatted into text in contiguous chunks, in parallel for large files, and the
+  // chunks are then written in order
+  const size_t chunkSize = 256;
+  size_t numChunks = (m_objects.size() + chunkSize - 1) / chunkSize;
+  std::vector<std::string> chunks(numChunks);
+
+  parallelFor(numChunks, [this, &chunks, chunkSize](size_t i) {
+    size_t end = std::min(m_objects.size(), (i + 1) * chunkSize);
+    for (size_t j = i * chunkSize; j < end; ++j){
+      m_objects[j].getImpl<detail::IdfObject_Impl>()->print(chunks[i]);
+    }
+  });
+
+  for (size_t i = 0; i < numChunks; ++i){
+    os.write(chunks[i].data(),chunks[i].size());
+    std::string().swap(chunks[i]);
   }
   return os;
 }
@@ -0,0 +1,314 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "IdfFileIndex.hpp"
+
+#include "../idd/IddField.hpp"
+#include <utilities/idd/IddEnums.hxx>
+#include "../core/Assert.hpp"
+#include "../core/Filesystem.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+
+namespace openstudio{
+
+namespace {
+
+  // maximum number of tokens, object type included, needed to read the handle and name of an object
+  const unsigned maxIndexTokens = 4;
+
+  bool isBlank(const std::string& line) {
+    return line.find_first_not_of(" \t\r") == std::string::npos;
+  }
+
+  bool isCommentOnly(const std::string& line) {
+    std::string::size_type i = line.find_first_not_of(" \t\r");
+    return (i != std::string::npos) && (line[i] == '!');
+  }
+
+  // scans the non-comment part of line, appending completed tokens to tokens,
+  // returns true once the terminating semicolon is found
+  bool scanLine(const std::string& line, std::string& token, std::vector<std::string>& tokens) {
+    for (char c : line) {
+      if (c == '!') {
+        break;
+      }
+      if (c == ',' || c == ';') {
+        if (tokens.size() < maxIndexTokens) {
+          boost::trim(token);
+          tokens.push_back(token);
+        }
+        token.clear();
+        if (c == ';') {
+          return true;
+        }
+      } else if (tokens.size() < maxIndexTokens) {
+        token += c;
+      }
+    }
+    return false;
+  }
+
+}
+
+IdfFileIndex::IdfFileIndex(const openstudio::path& p, const IddFileType& iddFileType)
+  : m_path(p), m_iddFileAndFactoryWrapper(iddFileType)
+{}
+
+boost::optional<IdfFileIndex> IdfFileIndex::load(const openstudio::path& p, const IddFileType& iddFileType)
+{
+  boost::optional<IdfFileIndex> result;
+  if (!openstudio::filesystem::is_regular_file(p)) {
+    LOG(Error, "Path '" << toString(p) << "' is not a file.");
+    return result;
+  }
+
+  IdfFileIndex index(p, iddFileType);
+  if (index.m_index()) {
+    result = index;
+  }
+  return result;
+}
+
+openstudio::path IdfFileIndex::path() const {
+  return m_path;
+}
+
+IddFileType IdfFileIndex::iddFileType() const {
+  return m_iddFileAndFactoryWrapper.iddFileType();
+}
+
+const std::vector<IdfObjectIndexEntry>& IdfFileIndex::entries() const {
+  return m_entries;
+}
+
+std::vector<IdfObjectIndexEntry> IdfFileIndex::entriesByType(const IddObjectType& iddObjectType) const {
+  std::vector<IdfObjectIndexEntry> result;
+  auto it = m_typeIndex.find(iddObjectType.value());
+  if (it != m_typeIndex.end()) {
+    for (size_t i : it->second) {
+      result.push_back(m_entries[i]);
+    }
+  }
+  return result;
+}
+
+boost::optional<IdfObjectIndexEntry> IdfFileIndex::entryByHandle(const Handle& handle) const {
+  auto it = m_handleIndex.find(handle);
+  if (it != m_handleIndex.end()) {
+    return m_entries[it->second];
+  }
+  return boost::none;
+}
+
+unsigned IdfFileIndex::numParsedObjects() const {
+  return m_parsedObjects.size();
+}
+
+boost::optional<IdfObject> IdfFileIndex::getObject(const IdfObjectIndexEntry& entry) const {
+  // entries are copies, find the original by offset
+  auto it = std::lower_bound(m_entries.begin(), m_entries.end(), entry.offset,
+    [](const IdfObjectIndexEntry& e, long long offset) { return e.offset < offset; });
+  if ((it == m_entries.end()) || (it->offset != entry.offset)) {
+    LOG(Warn, "No object at offset " << entry.offset << " in '" << toString(m_path) << "'.");
+    return boost::none;
+  }
+
+  size_t i = it - m_entries.begin();
+  auto cached = m_parsedObjects.find(i);
+  if (cached != m_parsedObjects.end()) {
+    return cached->second;
+  }
+
+  boost::optional<IdfObject> result = m_parse(*it);
+  if (result) {
+    m_parsedObjects.insert(std::make_pair(i, *result));
+  }
+  return result;
+}
+
+boost::optional<IdfObject> IdfFileIndex::getObject(const Handle& handle) const {
+  boost::optional<IdfObjectIndexEntry> entry = entryByHandle(handle);
+  if (entry) {
+    return getObject(*entry);
+  }
+  return boost::none;
+}
+
+std::vector<IdfObject> IdfFileIndex::getObjectsByType(const IddObjectType& iddObjectType) const {
+  std::vector<IdfObject> result;
+  for (const IdfObjectIndexEntry& entry : entriesByType(iddObjectType)) {
+    if (boost::optional<IdfObject> object = getObject(entry)) {
+      result.push_back(*object);
+    }
+  }
+  return result;
+}
+
+boost::optional<IdfObject> IdfFileIndex::getObjectByTypeAndName(const IddObjectType& iddObjectType, const std::string& name) const {
+  for (const IdfObjectIndexEntry& entry : entriesByType(iddObjectType)) {
+    if (boost::iequals(entry.name, name)) {
+      return getObject(entry);
+    }
+  }
+  return boost::none;
+}
+
+std::vector<IdfObject> IdfFileIndex::getTargets(const Handle& handle) const {
+  std::vector<IdfObject> result;
+  boost::optional<IdfObject> object = getObject(handle);
+  if (!object) {
+    return result;
+  }
+
+  IddObject iddObject = object->iddObject();
+  for (unsigned i = 0, n = object->numFields(); i < n; ++i) {
+    boost::optional<IddField> iddField = iddObject.getField(i);
+    if (!iddField || !iddField->isObjectListField()) {
+      continue;
+    }
+    boost::optional<std::string> value = object->getString(i);
+    if (!value || value->empty()) {
+      continue;
+    }
+    Handle target = toUUID(*value);
+    if (target.isNull()) {
+      continue;
+    }
+    if (boost::optional<IdfObject> targetObject = getObject(target)) {
+      result.push_back(*targetObject);
+    }
+  }
+  return result;
+}
+
+bool IdfFileIndex::m_index() {
+  openstudio::filesystem::ifstream is(m_path, std::ios_base::binary);
+  if (!is.is_open()) {
+    LOG(Error, "Unable to open '" << toString(m_path) << "' for reading.");
+    return false;
+  }
+
+  std::string line;
+  long long position = 0;
+  long long commentStart = -1;
+
+  while (std::getline(is, line)) {
+    long long lineStart = position;
+    position += static_cast<long long>(line.size()) + 1;
+
+    if (isBlank(line)) {
+      // comment blocks separated from the next object belong to the header or to a CommentOnly object
+      commentStart = -1;
+      continue;
+    }
+    if (isCommentOnly(line)) {
+      if (commentStart < 0) {
+        commentStart = lineStart;
+      }
+      continue;
+    }
+
+    IdfObjectIndexEntry entry;
+    entry.offset = (commentStart < 0) ? lineStart : commentStart;
+    commentStart = -1;
+
+    std::string token;
+    std::vector<std::string> tokens;
+    bool foundEnd = scanLine(line, token, tokens);
+    while (!foundEnd && std::getline(is, line)) {
+      position += static_cast<long long>(line.size()) + 1;
+      foundEnd = scanLine(line, token, tokens);
+    }
+    if (!foundEnd) {
+      LOG(Warn, "Object at offset " << entry.offset << " in '" << toString(m_path) << "' is not terminated, ignoring it.");
+      break;
+    }
+    entry.length = position - entry.offset;
+
+    std::string objectType = tokens.empty() ? std::string() : tokens[0];
+    boost::optional<IddObject> iddObject = m_iddFileAndFactoryWrapper.getObject(objectType);
+    if (iddObject) {
+      entry.iddObjectType = iddObject->type();
+      // tokens[0] is the object type, field i is token i + 1
+      if (iddObject->hasHandleField() && tokens.size() > 1) {
+        entry.handle = toUUID(tokens[1]);
+      }
+      boost::optional<unsigned> nameIndex = iddObject->nameFieldIndex();
+      if (nameIndex && (*nameIndex + 1 < tokens.size())) {
+        entry.name = tokens[*nameIndex + 1];
+      }
+    } else {
+      LOG(Warn, "Cannot find object type '" << objectType << "' in Idd. Indexing it as a Catchall object.");
+      entry.iddObjectType = IddObjectType::Catchall;
+    }
+
+    size_t i = m_entries.size();
+    m_entries.push_back(entry);
+    m_typeIndex[entry.iddObjectType.value()].push_back(i);
+    if (!entry.handle.isNull()) {
+      m_handleIndex.insert(std::make_pair(entry.handle, i));
+    }
+  }
+
+  if (m_entries.empty()) {
+    LOG(Error, "Could not index a single object in '" << toString(m_path) << "'.");
+    return false;
+  }
+  return true;
+}
+
+boost::optional<IdfObject> IdfFileIndex::m_parse(const IdfObjectIndexEntry& entry) const {
+  openstudio::filesystem::ifstream is(m_path, std::ios_base::binary);
+  if (!is.is_open()) {
+    LOG(Error, "Unable to open '" << toString(m_path) << "' for reading.");
+    return boost::none;
+  }
+
+  std::string text(static_cast<size_t>(entry.length), '\0');
+  is.seekg(entry.offset);
+  is.read(&text[0], entry.length);
+  text.resize(static_cast<size_t>(is.gcount()));
+  boost::erase_all(text, "\r");
+
+  boost::optional<IddObject> iddObject = m_iddFileAndFactoryWrapper.getObject(entry.iddObjectType);
+  if (!iddObject) {
+    iddObject = IddObject();
+  }
+
+  boost::optional<IdfObject> result = IdfObject::load(text, *iddObject);
+  if (!result) {
+    LOG(Error, "Unable to construct IdfObject from text: " << std::endl << text);
+  }
+  return result;
+}
+
+} // openstudio
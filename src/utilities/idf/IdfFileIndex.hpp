@@ -0,0 +1,144 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef UTILITIES_IDF_IDFFILEINDEX_HPP
+#define UTILITIES_IDF_IDFFILEINDEX_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "IdfObject.hpp"
+#include "Handle.hpp"
+
+#include "../idd/IddObject.hpp"
+#include "../idd/IddFileAndFactoryWrapper.hpp"
+
+#include "../core/Path.hpp"
+#include "../core/Logger.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace openstudio{
+
+/** IdfObjectIndexEntry locates one object in the file indexed by an IdfFileIndex. */
+struct UTILITIES_API IdfObjectIndexEntry {
+  IddObjectType iddObjectType;
+  /// handle of the object, null if the object has no handle field
+  Handle handle;
+  /// name of the object, empty if the object has no name field
+  std::string name;
+  /// byte offset of the object text, including preceding comments, in the file
+  long long offset;
+  /// length in bytes of the object text
+  long long length;
+};
+
+/** IdfFileIndex indexes an IDF or OSM file by object type, handle and name in a single pass
+ *  without constructing any IdfObjects. Objects are parsed from the file only when first
+ *  requested and are then cached, so tools that only need a few object types from a large
+ *  file do not pay for loading the whole IdfFile or Workspace. Object pointers are resolved
+ *  on demand with getTargets. The file must not change while it is indexed. */
+class UTILITIES_API IdfFileIndex
+{
+ public:
+
+  /** @name Constructors */
+  //@{
+
+  /** Index the file at p using the IddFile for iddFileType. Returns boost::none if the file
+   *  cannot be read or contains no objects. */
+  static boost::optional<IdfFileIndex> load(const openstudio::path& p, const IddFileType& iddFileType);
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  openstudio::path path() const;
+
+  IddFileType iddFileType() const;
+
+  /** All entries in file order. */
+  const std::vector<IdfObjectIndexEntry>& entries() const;
+
+  /** Entries of iddObjectType in file order. */
+  std::vector<IdfObjectIndexEntry> entriesByType(const IddObjectType& iddObjectType) const;
+
+  boost::optional<IdfObjectIndexEntry> entryByHandle(const Handle& handle) const;
+
+  /** Number of objects parsed so far. */
+  unsigned numParsedObjects() const;
+
+  //@}
+  /** @name Queries */
+  //@{
+
+  /** Parse the object at entry, returns a cached object if it has already been parsed. */
+  boost::optional<IdfObject> getObject(const IdfObjectIndexEntry& entry) const;
+
+  boost::optional<IdfObject> getObject(const Handle& handle) const;
+
+  std::vector<IdfObject> getObjectsByType(const IddObjectType& iddObjectType) const;
+
+  /** Case insensitive name lookup, only parses the matching object. */
+  boost::optional<IdfObject> getObjectByTypeAndName(const IddObjectType& iddObjectType, const std::string& name) const;
+
+  /** Objects pointed to by the object with handle. Only supported for files whose pointers are
+   *  handles, i.e. OSM files; only the object and its targets are parsed. */
+  std::vector<IdfObject> getTargets(const Handle& handle) const;
+
+  //@}
+ private:
+
+  IdfFileIndex(const openstudio::path& p, const IddFileType& iddFileType);
+
+  bool m_index();
+
+  boost::optional<IdfObject> m_parse(const IdfObjectIndexEntry& entry) const;
+
+  openstudio::path m_path;
+  IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper;
+  std::vector<IdfObjectIndexEntry> m_entries;
+  std::unordered_map<Handle, size_t, boost::hash<boost::uuids::uuid> > m_handleIndex;
+  std::unordered_map<int, std::vector<size_t> > m_typeIndex;
+  // parsed objects by entry index
+  mutable std::unordered_map<size_t, IdfObject> m_parsedObjects;
+
+  REGISTER_LOGGER("openstudio.IdfFileIndex");
+};
+
+/** \relates IdfFileIndex */
+typedef boost::optional<IdfFileIndex> OptionalIdfFileIndex;
+
+} // openstudio
+
+#endif //UTILITIES_IDF_IDFFILEINDEX_HPP
@@ -51,13 +51,31 @@
 
 #include <boost/lexical_cast.hpp>
 
-#include <iomanip>
+#include <unordered_map>
 
 using std::cout;
 using std::endl;
 
 namespace openstudio {
 
+namespace {
+
+  // makeIdfEditorComment is regex based and the same field names are printed over and over, so
+  // cache the result per thread, keyed by the field name alone
+  const std::string& cachedIdfEditorComment(const std::string& fieldName) {
+    thread_local std::unordered_map<std::string, std::string> comments;
+    auto it = comments.find(fieldName);
+    if (it == comments.end()) {
+      if (comments.size() >= 65536) {
+        comments.clear();
+      }
+      it = comments.emplace(fieldName, makeIdfEditorComment(fieldName)).first;
+    }
+    return it->second;
+  }
+
+}
+
 namespace detail {
 
   // CONSTRUCTORS
@@ -170,20 +188,7 @@ namespace detail {
     }
 
     if (returnDefault && result.empty()) {
-      if (OptionalIddField iddField = m_iddObject.getField(index)) {
-        std::stringstream ss;
-        ss << makeIdfEditorComment(iddField->name());
-        if (m_iddObject.isExtensibleField(index)) {
-          ExtensibleIndex ei = m_iddObject.extensibleIndex(index);
-          ss << " " << ei.group + 1;
-        }
-        if (OptionalString units = iddField->properties().units) {
-          if (units) {
-            ss << " {" << *units << "}";
-          }
-        }
-        result = ss.str();
-      }
+      appendDefaultFieldComment(result,index);
     }
     return result;
   }
@@ -1008,6 +1013,124 @@ namespace detail {
     return rollbackValues;
   }
 
+  bool IdfObject_Impl::setNumericExtensibleGroups(const std::vector<double>& values) {
+    bool result = setNumericExtensibleGroups(values,true);
+    if (result) {
+      this->emitChangeSignals();
+    }
+    return result;
+  }
+
+  bool IdfObject_Impl::setNumericExtensibleGroups(const std::vector<double>& values, bool checkValidity) {
+    unsigned groupSize = m_iddObject.properties().numExtensible;
+    if ((groupSize == 0) || (values.size() % groupSize != 0)) {
+      return false;
+    }
+
+    // every field in the group must hold plain numeric data
+    const std::vector<IddField>& groupFields = m_iddObject.extensibleGroup();
+    OS_ASSERT(groupFields.size() == groupSize);
+    for (const IddField& iddField : groupFields) {
+      IddFieldType fieldType = iddField.properties().type;
+      if (((fieldType != IddFieldType::RealType) && (fieldType != IddFieldType::IntegerType)) ||
+          iddField.isObjectListField())
+      {
+        return false;
+      }
+    }
+
+    unsigned iddn = m_iddObject.numFields();
+    unsigned newNumFields = iddn + values.size();
+    OptionalUnsigned mf = maxFields();
+    if (mf && (newNumFields > *mf)) {
+      return false;
+    }
+
+    // validate the whole block before touching any data
+    if (checkValidity) {
+      for (unsigned i = 0; i < groupSize; ++i) {
+        const IddField& iddField = groupFields[i];
+        bool isInteger = (iddField.properties().type == IddFieldType::IntegerType);
+        for (unsigned j = i, nv = values.size(); j < nv; j += groupSize) {
+          double value = values[j];
+          if (std::isnan(value) || std::isinf(value)) {
+            LOG(Warn, "Cannot set field '" << iddField.name() << "' of an object of type "
+                << m_iddObject.name() << " to " << value << ".");
+            return false;
+          }
+          if (isInteger && (value != std::floor(value))) {
+            return false;
+          }
+          if (!withinBounds(value,iddField)) {
+            return false;
+          }
+        }
+      }
+    }
+
+    unsigned n = numFields();
+    if ((n <= iddn) && values.empty()) {
+      // no extensible groups before or after
+      return true;
+    }
+
+    // push non-extensible fields as needed
+    unsigned diffSize = m_diffs.size();
+    if (n < iddn) {
+      bool ok = this->setString(iddn - 1,"",checkValidity);
+      if (!ok) {
+        // remove the diffs
+        m_diffs.resize(diffSize);
+
+        // resize the fields
+        m_fields.resize(n);
+        if (m_fieldComments.size() > n) {
+          m_fieldComments.resize(n);
+        }
+        return false;
+      }
+      n = numFields();
+    }
+    OS_ASSERT(n >= iddn);
+
+    // write the data, recording only the first actual change so that listeners are notified once
+    boost::optional<IdfObjectDiff> diff;
+    m_fields.reserve(newNumFields);
+    for (unsigned i = 0, nv = values.size(); i < nv; ++i) {
+      unsigned index = iddn + i;
+      std::string value = toString(values[i]);
+      if (index < n) {
+        if (!diff && (m_fields[index] != value)) {
+          diff = IdfObjectDiff(index, m_fields[index], value);
+        }
+        m_fields[index] = std::move(value);
+      }
+      else {
+        if (!diff) {
+          diff = IdfObjectDiff(index, boost::none, value);
+        }
+        m_fields.push_back(std::move(value));
+      }
+    }
+    if (newNumFields < n) {
+      if (!diff) {
+        diff = IdfObjectDiff(newNumFields, m_fields[newNumFields], boost::none);
+      }
+      m_fields.resize(newNumFields);
+    }
+
+    // comments on the old groups no longer apply
+    if (m_fieldComments.size() > iddn) {
+      m_fieldComments.resize(iddn);
+    }
+
+    if (diff) {
+      m_diffs.push_back(*diff);
+    }
+
+    return true;
+  }
+
   // QUERIES
 
   unsigned IdfObject_Impl::numFields() const
@@ -1271,113 +1394,168 @@ namespace detail {
   }
 
   std::ostream& IdfObject_Impl::print(std::ostream& os) const {
+    std::string text;
+    print(text);
+    os.write(text.data(),text.size());
+    return os;
+  }
+
+  std::ostream& IdfObject_Impl::printName(std::ostream& os, bool hasFields) const {
+    std::string text;
+    printName(text,hasFields);
+    os.write(text.data(),text.size());
+    return os;
+  }
+
+  std::ostream& IdfObject_Impl::printField(std::ostream& os,
+                                           unsigned index,
+                                           bool isLastField) const
+  {
+    std::string text;
+    printField(text,index,isLastField);
+    os.write(text.data(),text.size());
+    return os;
+  }
+
+  std::string& IdfObject_Impl::print(std::string& text) const {
     unsigned n = numFields();
     if (n == 0) {
-      printName(os,false);
+      printName(text,false);
     }
     else {
-      printName(os,true);
+      printName(text,true);
     }
 
     for (unsigned i = 0; i < n; ++i) {
       if (i < n-1) {
-        printField(os,i);
+        printField(text,i);
       }
       else {
-        printField(os,i,true);
+        printField(text,i,true);
       }
     }
 
-    os << std::endl;
+    text += '\n';
 
-    return os;
+    return text;
   }
 
-  std::ostream& IdfObject_Impl::printName(std::ostream& os, bool hasFields) const {
+  std::string& IdfObject_Impl::printName(std::string& text, bool hasFields) const {
     // print comment, if any
     if (!m_comment.empty()){
-      os << m_comment << std::endl;
+      text += m_comment;
+      text += '\n';
     }
 
     // if this is a comment only object, return
     // todo, tighten up handling of comments with comment only object type
-    if (boost::iequals(m_iddObject.name(), iddRegex::commentOnlyObjectName()) ){
-      return os;
+    const std::string& objectName = m_iddObject.name();
+    if (boost::iequals(objectName, iddRegex::commentOnlyObjectName()) ){
+      return text;
     }
 
-    os << m_iddObject.name();
+    text += objectName;
 
     if (hasFields) {
-      os << "," << std::endl;
+      text += ",\n";
     }
     else {
-      os << ";" << std::endl;
+      text += ";\n";
     }
 
-    return os;
+    return text;
   }
 
-  std::ostream& IdfObject_Impl::printField(std::ostream& os,
-                                           unsigned index,
-                                           bool isLastField) const
+  std::string& IdfObject_Impl::printField(std::string& text,
+                                          unsigned index,
+                                          bool isLastField) const
   {
     if (index < numFields()) {
+      const IddObjectProperties& properties = m_iddObject.properties();
       // different formatting for vertices
-      if ((m_iddObject.properties().format == "vertices") && (m_iddObject.isExtensibleField(index))) {
+      if ((properties.format == "vertices") && (m_iddObject.isExtensibleField(index))) {
         ExtensibleIndex eIndex = m_iddObject.extensibleIndex(index);
-        // making this static is a bad idea,
-        // it makes no sense in a threaded environment
-        static int textWidth(0);
         if (eIndex.field == 0) {
-          os << "  ";
-          textWidth = 0;
+          text += "  ";
         }
         else {
-          os << " ";
+          text += ' ';
         }
         // field value
-        os << m_fields[index];
+        text += m_fields[index];
         // delimiter
         if (isLastField) {
-          os << ";";
+          text += ';';
         }
         else {
-          os << ",";
+          text += ',';
         }
-        textWidth += m_fields[index].size();
         // comment
-        if (eIndex.field == m_iddObject.properties().numExtensible - 1) {
+        if (eIndex.field == properties.numExtensible - 1) {
+          // width of all values in this vertex, so fields can be printed independently
+          int textWidth = 0;
+          for (unsigned i = index - eIndex.field; i <= index; ++i) {
+            textWidth += int(m_fields[i].size());
+          }
           int numSpaces = IdfObject::printedFieldSpace() - textWidth - 4;
           if (numSpaces > 0) {
-            os << std::setw(numSpaces) << " ";
+            text.append(numSpaces,' ');
           }
-          os << " !- X,Y,Z Vertex " << eIndex.group + 1;
-          IddField iddField = m_iddObject.getField(index).get();
-          if (OptionalString units = iddField.properties().units) {
-            os << " {" << *units << "}";
+          text += " !- X,Y,Z Vertex ";
+          text += std::to_string(eIndex.group + 1);
+          if (OptionalIddField iddField = m_iddObject.getField(index)) {
+            if (const OptionalString& units = iddField->properties().units) {
+              text += " {";
+              text += *units;
+              text += '}';
+            }
           }
-          os << std::endl;
+          text += '\n';
         }
       }
       else {
         // field value
-        os << "  " << m_fields[index];
+        text += "  ";
+        text += m_fields[index];
         // delimiter
         if (isLastField) {
-          os << ";";
+          text += ';';
         }
         else {
-          os << ",";
+          text += ',';
         }
         // field comment
         int numSpaces = IdfObject::printedFieldSpace() - int(m_fields[index].size());
         if (numSpaces > 0) {
-          os << std::setw(numSpaces) << " ";
+          text.append(numSpaces,' ');
+        }
+        text += ' ';
+        if ((index < m_fieldComments.size()) && !m_fieldComments[index].empty()) {
+          text += m_fieldComments[index];
+        }
+        else {
+          appendDefaultFieldComment(text,index);
         }
-        os << " " << fieldComment(index,true) << std::endl;
+        text += '\n';
       }
     } // if index < numFields()
-    return os;
+    return text;
+  }
+
+  void IdfObject_Impl::appendDefaultFieldComment(std::string& text, unsigned index) const {
+    if (OptionalIddField iddField = m_iddObject.getField(index)) {
+      text += cachedIdfEditorComment(iddField->name());
+      if (m_iddObject.isExtensibleField(index)) {
+        ExtensibleIndex ei = m_iddObject.extensibleIndex(index);
+        text += ' ';
+        text += std::to_string(ei.group + 1);
+      }
+      if (const OptionalString& units = iddField->properties().units) {
+        text += " {";
+        text += *units;
+        text += '}';
+      }
+    }
   }
 
   void IdfObject_Impl::emitChangeSignals()
@@ -2256,6 +2434,10 @@ std::vector<std::vector<std::string> > IdfObject::clearExtensibleGroups() {
   return m_impl->clearExtensibleGroups();
 }
 
+bool IdfObject::setNumericExtensibleGroups(const std::vector<double>& values) {
+  return m_impl->setNumericExtensibleGroups(values);
+}
+
 // QUERIES
 
 unsigned IdfObject::numFields() const
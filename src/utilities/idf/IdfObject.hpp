@@ -270,6 +270,14 @@ class UTILITIES_API IdfObject {
    *  Returns popped data if successful. Otherwise, the returned vector will be empty. */
   std::vector<std::vector<std::string> > clearExtensibleGroups();
 
+  /** Replaces all extensible groups with the numeric data in values, which is ordered group by
+   *  group. All fields in the extensible group must be numeric, non-pointer fields. The whole block
+   *  is validated once and set as a single change, which makes this much faster than pushing
+   *  groups one at a time for large objects. Returns false, leaving the object unchanged, if the
+   *  data cannot be set for any reason (values.size() is not a multiple of the group size, a
+   *  value is out of bounds per IddField.properties(), maxFields() would be exceeded, etc.). */
+  bool setNumericExtensibleGroups(const std::vector<double>& values);
+
   //@}
   /** @name Queries */
   //@{
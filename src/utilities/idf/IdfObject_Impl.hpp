@@ -258,6 +258,15 @@ namespace detail {
     std::vector<std::vector<std::string> > clearExtensibleGroups();
     std::vector<std::vector<std::string> > clearExtensibleGroups(bool checkValidity);
 
+    /** Replaces all extensible groups with the numeric data in values, which is ordered group by
+     *  group and must hold a whole number of groups. Every field in the extensible group must be a
+     *  non-pointer RealType or IntegerType field. The block is validated once up front (field
+     *  types, finiteness and IddField bounds, if checkValidity), then written directly into the
+     *  field storage and recorded as a single change, so that at most one set of change signals is
+     *  emitted. Returns false and leaves the object untouched if the data cannot be set. */
+    virtual bool setNumericExtensibleGroups(const std::vector<double>& values);
+    virtual bool setNumericExtensibleGroups(const std::vector<double>& values, bool checkValidity);
+
     //@}
     /** @name Queries */
     //@{
@@ -348,6 +357,16 @@ namespace detail {
      *  field value is followed by a ','. Otherwise, the object is ended by using a ';'. */
     std::ostream& printField(std::ostream& os, unsigned index, bool isLastField=false) const;
 
+    /** Append the Idf text of this object to text. Produces the same output as print(std::ostream&),
+     *  and is safe to call for different objects from several threads at once. */
+    std::string& print(std::string& text) const;
+
+    /** Append the comments and name of this object to text, as in printName(std::ostream&,bool). */
+    std::string& printName(std::string& text, bool hasFields=true) const;
+
+    /** Append field index to text, as in printField(std::ostream&,unsigned,bool). */
+    std::string& printField(std::string& text, unsigned index, bool isLastField=false) const;
+
     //@}
     /** @name Type Casting */
     //@{
@@ -469,6 +488,11 @@ namespace detail {
     // convert a string in file to one the use sees
     std::string decodeString(const std::string& string) const;
 
+    // SERIALIZATION HELPERS
+
+    // append the default, IDF Editor style, comment for field index to text
+    void appendDefaultFieldComment(std::string& text, unsigned index) const;
+
     // configure logging
     REGISTER_LOGGER("utilities.idf.IdfObject");
   };
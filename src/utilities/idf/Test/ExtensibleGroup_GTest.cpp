@@ -631,4 +631,109 @@ TEST_F(IdfFixture, ExtensibleGroup_ErrorHandling) {
   values.push_back("Cool Stuff");
   group = zone.pushExtensibleGroup(values);
   EXPECT_TRUE(group.empty());
-}
\ No newline at end of file
+}
+
+class ExtensibleGroupChangeCounter : public Nano::Observer
+{
+public:
+  ExtensibleGroupChangeCounter()
+    : numChanges(0)
+  {}
+
+  void change() { ++numChanges; }
+  unsigned numChanges;
+};
+
+TEST_F(IdfFixture, ExtensibleGroup_SetNumericExtensibleGroups) {
+  // IdfObject
+  IdfObject surface(IddObjectType::BuildingSurface_Detailed);
+  unsigned iddn = surface.iddObject().numFields();
+
+  std::vector<double> values = { 0.0, 0.0, 3.0,
+                                 0.0, 0.0, 0.0,
+                                 10.5, 0.0, 0.0,
+                                 10.5, 0.0, 3.0 };
+  EXPECT_TRUE(surface.setNumericExtensibleGroups(values));
+  EXPECT_EQ(4u, surface.numExtensibleGroups());
+  EXPECT_EQ(iddn + 12u, surface.numFields());
+  ASSERT_TRUE(surface.getDouble(iddn + 6));
+  EXPECT_DOUBLE_EQ(10.5, surface.getDouble(iddn + 6).get());
+  IdfExtensibleGroup group = surface.getExtensibleGroup(3);
+  ASSERT_FALSE(group.empty());
+  ASSERT_TRUE(group.getDouble(BuildingSurface_DetailedExtensibleFields::VertexZcoordinate));
+  EXPECT_DOUBLE_EQ(3.0, group.getDouble(BuildingSurface_DetailedExtensibleFields::VertexZcoordinate).get());
+
+  // shrink
+  values.resize(9);
+  EXPECT_TRUE(surface.setNumericExtensibleGroups(values));
+  EXPECT_EQ(3u, surface.numExtensibleGroups());
+
+  // rejected without changes: partial group, NaN
+  values.pop_back();
+  EXPECT_FALSE(surface.setNumericExtensibleGroups(values));
+  values.push_back(std::numeric_limits<double>::quiet_NaN());
+  EXPECT_FALSE(surface.setNumericExtensibleGroups(values));
+  EXPECT_EQ(3u, surface.numExtensibleGroups());
+
+  // clear
+  EXPECT_TRUE(surface.setNumericExtensibleGroups(std::vector<double>()));
+  EXPECT_EQ(0u, surface.numExtensibleGroups());
+
+  // extensible groups with pointer fields are not numeric
+  IdfObject construction(IddObjectType::Construction);
+  EXPECT_FALSE(construction.setNumericExtensibleGroups(std::vector<double>(1, 1.0)));
+
+  // not extensible
+  IdfObject zone(IddObjectType::Zone);
+  EXPECT_FALSE(zone.setNumericExtensibleGroups(std::vector<double>(1, 1.0)));
+
+  // WorkspaceObject, integer fields and bounds
+  Workspace ws(StrictnessLevel::Draft, IddFileType::OpenStudio);
+  OptionalWorkspaceObject oDay = ws.addObject(IdfObject(IddObjectType::OS_Schedule_Day));
+  ASSERT_TRUE(oDay);
+  WorkspaceObject day = *oDay;
+  ExtensibleGroupChangeCounter counter;
+  day.getImpl<openstudio::detail::WorkspaceObject_Impl>()->openstudio::detail::WorkspaceObject_Impl::onChange.connect<ExtensibleGroupChangeCounter, &ExtensibleGroupChangeCounter::change>(counter);
+
+  // hour, minute, value
+  values = { 6, 0, 0.1,
+             18, 30, 1.0,
+             24, 0, 0.1 };
+  EXPECT_TRUE(day.setNumericExtensibleGroups(values));
+  EXPECT_EQ(3u, day.numExtensibleGroups());
+  EXPECT_EQ(1u, counter.numChanges);
+  group = day.getExtensibleGroup(1);
+  ASSERT_TRUE(group.getInt(0));
+  EXPECT_EQ(18, group.getInt(0).get());
+  ASSERT_TRUE(group.getInt(1));
+  EXPECT_EQ(30, group.getInt(1).get());
+  ASSERT_TRUE(group.getDouble(2));
+  EXPECT_DOUBLE_EQ(1.0, group.getDouble(2).get());
+
+  // setting the same data is not a change
+  EXPECT_TRUE(day.setNumericExtensibleGroups(values));
+  EXPECT_EQ(1u, counter.numChanges);
+
+  // minute out of bounds, fractional hour
+  std::vector<double> badValues = values;
+  badValues[4] = 60;
+  EXPECT_FALSE(day.setNumericExtensibleGroups(badValues));
+  badValues = values;
+  badValues[0] = 6.5;
+  EXPECT_FALSE(day.setNumericExtensibleGroups(badValues));
+  EXPECT_EQ(1u, counter.numChanges);
+  group = day.getExtensibleGroup(0);
+  ASSERT_TRUE(group.getInt(0));
+  EXPECT_EQ(6, group.getInt(0).get());
+
+  // large block
+  values.clear();
+  for (unsigned i = 0; i < 24*60; ++i) {
+    values.push_back((i + 1) / 60);
+    values.push_back((i + 1) % 60);
+    values.push_back(static_cast<double>(i));
+  }
+  EXPECT_TRUE(day.setNumericExtensibleGroups(values));
+  EXPECT_EQ(24u*60u, day.numExtensibleGroups());
+  EXPECT_EQ(2u, counter.numChanges);
+}
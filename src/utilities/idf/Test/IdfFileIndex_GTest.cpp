@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+
+#include "../IdfFileIndex.hpp"
+#include "../IdfFile.hpp"
+
+#include <resources.hxx>
+#include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/OS_Space_FieldEnums.hxx>
+
+#include <sstream>
+
+using namespace openstudio;
+
+TEST_F(IdfFixture, IdfFileIndex_EnergyPlus) {
+  openstudio::path p = resourcesPath()/toPath("energyplus/5ZoneAirCooled/in.idf");
+  OptionalIdfFileIndex index = IdfFileIndex::load(p, IddFileType::EnergyPlus);
+  ASSERT_TRUE(index);
+  EXPECT_EQ(0u, index->numParsedObjects());
+
+  std::vector<IdfObject> zones = epIdfFile.getObjectsByType(IddObjectType::Zone);
+  ASSERT_FALSE(zones.empty());
+  EXPECT_EQ(zones.size(), index->entriesByType(IddObjectType::Zone).size());
+
+  ASSERT_TRUE(zones[0].name());
+  OptionalIdfObject zone = index->getObjectByTypeAndName(IddObjectType::Zone, *zones[0].name());
+  ASSERT_TRUE(zone);
+  EXPECT_EQ(1u, index->numParsedObjects());
+
+  std::stringstream expected, actual;
+  expected << zones[0];
+  actual << *zone;
+  EXPECT_EQ(expected.str(), actual.str());
+
+  // objects are cached once parsed
+  EXPECT_EQ(index->entriesByType(IddObjectType::Zone).size(), index->getObjectsByType(IddObjectType::Zone).size());
+  EXPECT_EQ(zones.size(), index->numParsedObjects());
+}
+
+TEST_F(IdfFixture, IdfFileIndex_OpenStudio) {
+  IdfFile idfFile(IddFileType::OpenStudio);
+  IdfObject zone(IddObjectType::OS_ThermalZone);
+  EXPECT_TRUE(zone.setName("Zone 1"));
+  IdfObject space(IddObjectType::OS_Space);
+  EXPECT_TRUE(space.setName("Space 1"));
+  EXPECT_TRUE(space.setString(OS_SpaceFields::ThermalZoneName, toString(zone.handle())));
+  idfFile.addObject(zone);
+  idfFile.addObject(space);
+
+  openstudio::path p = toPath("./IdfFileIndex_OpenStudio.osm");
+  ASSERT_TRUE(idfFile.save(p, true));
+
+  OptionalIdfFileIndex index = IdfFileIndex::load(p, IddFileType::OpenStudio);
+  ASSERT_TRUE(index);
+
+  boost::optional<IdfObjectIndexEntry> entry = index->entryByHandle(space.handle());
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(IddObjectType(IddObjectType::OS_Space), entry->iddObjectType);
+  EXPECT_EQ("Space 1", entry->name);
+  EXPECT_EQ(0u, index->numParsedObjects());
+
+  // resolving the pointer parses the space and its zone only
+  std::vector<IdfObject> targets = index->getTargets(space.handle());
+  ASSERT_EQ(1u, targets.size());
+  EXPECT_EQ(zone.handle(), targets[0].handle());
+  EXPECT_EQ("Zone 1", targets[0].nameString());
+  EXPECT_EQ(2u, index->numParsedObjects());
+
+  EXPECT_FALSE(index->getObject(createUUID()));
+}
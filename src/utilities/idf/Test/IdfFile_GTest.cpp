@@ -31,6 +31,7 @@
 #include "IdfFixture.hpp"
 
 #include "../IdfFile.hpp"
+#include "../IdfExtensibleGroup.hpp"
 #include "../ValidityReport.hpp"
 
 #include "../../time/Time.hpp"
@@ -102,6 +103,54 @@ TEST_F(IdfFixture, IdfFile_Header) {
   file.setHeader(header);
   EXPECT_EQ("! Multi-line \n! Non-comment.",file.header());
 }
+
+TEST_F(IdfFixture, IdfFile_Print) {
+  std::stringstream ss;
+  epIdfFile.print(ss);
+  std::string text = ss.str();
+
+  // each object print appears in the file print, in order
+  std::string::size_type pos = 0;
+  for (const IdfObject& object : epIdfFile.objects()) {
+    std::stringstream objectText;
+    object.print(objectText);
+    pos = text.find(objectText.str(),pos);
+    ASSERT_NE(std::string::npos,pos);
+    pos += objectText.str().size();
+  }
+
+  // and the file round trips to the same text
+  OptionalIdfFile roundTrip = IdfFile::load(ss,IddFileType::EnergyPlus);
+  ASSERT_TRUE(roundTrip);
+  EXPECT_EQ(epIdfFile.objects().size(),roundTrip->objects().size());
+  std::stringstream ss2;
+  roundTrip->print(ss2);
+  EXPECT_EQ(text,ss2.str());
+}
+
+TEST_F(IdfFixture, IdfFile_PrintVertices) {
+  IdfObject surface(IddObjectType::BuildingSurface_Detailed);
+  unsigned n = surface.numFields();
+  ASSERT_FALSE(surface.pushExtensibleGroup(StringVector{"0.0","0.0","3.0"}).empty());
+  ASSERT_FALSE(surface.pushExtensibleGroup(StringVector{"10.25","0.0","0.0"}).empty());
+  ASSERT_EQ(n + 6,surface.numFields());
+
+  std::stringstream ss;
+  surface.printField(ss,n);
+  surface.printField(ss,n + 1);
+  surface.printField(ss,n + 2);
+  EXPECT_EQ("  0.0, 0.0, 3.0," + std::string(25,' ') + " !- X,Y,Z Vertex 1 {m}\n",ss.str());
+
+  // fields of a vertex can be printed independently of each other
+  std::stringstream ss2;
+  surface.printField(ss2,n + 5,true);
+  EXPECT_EQ(" 0.0;" + std::string(23,' ') + " !- X,Y,Z Vertex 2 {m}\n",ss2.str());
+
+  // the same fields in the full object print
+  std::stringstream ss3;
+  surface.print(ss3);
+  EXPECT_NE(std::string::npos,ss3.str().find("  10.25, 0.0, 0.0;" + std::string(23,' ') + " !- X,Y,Z Vertex 2 {m}\n\n"));
+}
 /*
 TEST_F(IdfFixture, IdfFile_UnixLineEndings) {
   OptionalIdfFile oFile = IdfFile::load(resourcesPath()/toPath("utilities/Idf/UnixLineEndingTest.idf"));
@@ -0,0 +1,110 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+#include "../WorkspaceChangeTracker.hpp"
+#include "../Workspace.hpp"
+#include "../WorkspaceObject.hpp"
+#include "../IdfExtensibleGroup.hpp"
+#include <utilities/idd/IddEnums.hxx>
+
+#include <resources.hxx>
+
+using namespace openstudio;
+
+TEST_F(IdfFixture,WorkspaceChangeTracker_ObjectChanges)
+{
+  Workspace workspace(epIdfFile);
+  WorkspaceChangeTracker tracker(workspace);
+
+  WorkspaceObjectVector result = workspace.getObjectsByName("C5-1");
+  ASSERT_EQ(1u, result.size());
+  EXPECT_FALSE(tracker.dirty());
+  EXPECT_TRUE(tracker.changedHandles().empty());
+
+  IdfExtensibleGroup eg = result[0].pushExtensibleGroup();
+  EXPECT_FALSE(eg.empty());
+  EXPECT_TRUE(tracker.dirty());
+  ASSERT_EQ(1u, tracker.changedHandles().size());
+  EXPECT_EQ(result[0].handle(), tracker.changedHandles()[0]);
+  EXPECT_TRUE(tracker.isChanged(result[0].handle()));
+  EXPECT_TRUE(tracker.removedHandles().empty());
+
+  // changing the same object again is only recorded once
+  EXPECT_TRUE(eg.setDouble(0,4.3));
+  EXPECT_EQ(1u, tracker.changedHandles().size());
+
+  tracker.clearState();
+  EXPECT_FALSE(tracker.dirty());
+  EXPECT_FALSE(tracker.isChanged(result[0].handle()));
+
+  EXPECT_TRUE(eg.setDouble(0,4.4));
+  EXPECT_TRUE(tracker.isChanged(result[0].handle()));
+}
+
+TEST_F(IdfFixture,WorkspaceChangeTracker_AddRemoveObjects)
+{
+  Workspace workspace(epIdfFile);
+  WorkspaceChangeTracker tracker(workspace);
+
+  OptionalWorkspaceObject owo = workspace.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(owo);
+  Handle addedHandle = owo->handle();
+  EXPECT_TRUE(tracker.isChanged(addedHandle));
+  tracker.clearState();
+
+  // objects added after construction are watched too
+  EXPECT_TRUE(owo->setName("New Lights"));
+  EXPECT_TRUE(tracker.isChanged(addedHandle));
+  tracker.clearState();
+
+  WorkspaceObjectVector result = workspace.getObjectsByName("C5-1");
+  ASSERT_EQ(1u, result.size());
+  Handle removedHandle = result[0].handle();
+  EXPECT_TRUE(workspace.removeObject(removedHandle));
+  EXPECT_TRUE(tracker.isChanged(removedHandle));
+  ASSERT_EQ(1u, tracker.removedHandles().size());
+  EXPECT_EQ(removedHandle, tracker.removedHandles()[0]);
+}
+
+TEST_F(IdfFixture,WorkspaceChangeTracker_DestroyedBeforeWorkspace)
+{
+  Workspace workspace(epIdfFile);
+  {
+    WorkspaceChangeTracker tracker(workspace);
+  }
+
+  // the destroyed tracker must not be notified
+  OptionalWorkspaceObject owo = workspace.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(owo);
+  EXPECT_TRUE(owo->setName("New Lights"));
+  EXPECT_TRUE(workspace.removeObject(owo->handle()));
+}
@@ -0,0 +1,96 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+
+#include "../WorkspaceLoader.hpp"
+#include "../Workspace.hpp"
+#include "../WorkspaceObject.hpp"
+
+#include <utilities/idd/IddFactory.hxx>
+#include <utilities/idd/IddEnums.hxx>
+
+#include <resources.hxx>
+
+using namespace openstudio;
+
+namespace {
+
+  std::vector<openstudio::path> workspaceLoaderPaths() {
+    std::vector<openstudio::path> paths;
+    for (unsigned i = 0; i < 2; ++i){
+      paths.push_back(resourcesPath() / toPath("energyplus/5ZoneAirCooled/in.idf"));
+      paths.push_back(resourcesPath() / toPath("energyplus/Daylighting_Office/in.idf"));
+      paths.push_back(resourcesPath() / toPath("energyplus/HospitalBaseline/in.idf"));
+      paths.push_back(resourcesPath() / toPath("energyplus/RefLargeOffice/RefBldgLargeOfficeNew2004_Chicago.idf"));
+    }
+    return paths;
+  }
+
+}
+
+TEST_F(IdfFixture, WorkspaceLoader_IddFileType)
+{
+  std::vector<openstudio::path> paths = workspaceLoaderPaths();
+  paths.push_back(resourcesPath() / toPath("energyplus/DoesNotExist.idf"));
+
+  WorkspaceLoader loader = loadWorkspaces(paths, IddFileType::EnergyPlus, 4);
+  ASSERT_EQ(paths.size(), loader.size());
+
+  for (unsigned i = 0; i < paths.size() - 1; ++i){
+    boost::optional<Workspace> expected = Workspace::load(paths[i], IddFileType::EnergyPlus);
+    ASSERT_TRUE(expected);
+    boost::optional<Workspace> loaded = loader.future(i).get();
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(IddFileType(IddFileType::EnergyPlus), loaded->iddFileType());
+    EXPECT_EQ(expected->numObjects(), loaded->numObjects());
+    EXPECT_EQ(expected->objects(true).back().nameString(), loaded->objects(true).back().nameString());
+  }
+  EXPECT_FALSE(loader.future(paths.size() - 1).get());
+}
+
+TEST_F(IdfFixture, WorkspaceLoader_SharedIddFile)
+{
+  std::vector<openstudio::path> paths = workspaceLoaderPaths();
+  IddFile iddFile = IddFactory::instance().getIddFile(IddFileType::EnergyPlus);
+
+  std::vector<std::shared_future<boost::optional<Workspace> > > futures = loadWorkspaces(paths, iddFile).futures();
+  ASSERT_EQ(paths.size(), futures.size());
+
+  for (unsigned i = 0; i < paths.size(); ++i){
+    boost::optional<Workspace> expected = Workspace::load(paths[i], iddFile);
+    ASSERT_TRUE(expected);
+    boost::optional<Workspace> loaded = futures[i].get();
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(expected->numObjects(), loaded->numObjects());
+    EXPECT_EQ(expected->objects(true).back().nameString(), loaded->objects(true).back().nameString());
+    ASSERT_TRUE(loaded->iddFile().versionObject());
+  }
+}
@@ -2149,3 +2149,76 @@ TEST_F(IdfFixture, Workspace_getObjects_Type_StringOverload) {
   }
 
 }
+
+TEST_F(IdfFixture, Workspace_RelationshipRevision) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  std::shared_ptr<detail::Workspace_Impl> impl = ws.getImpl<detail::Workspace_Impl>();
+
+  unsigned revision = impl->relationshipRevision();
+  OptionalWorkspaceObject owo = ws.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(owo);
+  WorkspaceObject lights = *owo;
+  EXPECT_NE(revision, impl->relationshipRevision());
+
+  owo = ws.addObject(IdfObject(IddObjectType::Schedule_Compact));
+  ASSERT_TRUE(owo);
+  WorkspaceObject schedule = *owo;
+
+  // data changes do not affect the revision
+  revision = impl->relationshipRevision();
+  EXPECT_TRUE(lights.setString(LightsFields::DesignLevelCalculationMethod, "Watts/Area"));
+  EXPECT_TRUE(schedule.setName("My Schedule"));
+  EXPECT_EQ(revision, impl->relationshipRevision());
+
+  // pointer changes do
+  EXPECT_TRUE(lights.setPointer(LightsFields::ScheduleName, schedule.handle()));
+  EXPECT_NE(revision, impl->relationshipRevision());
+
+  revision = impl->relationshipRevision();
+  EXPECT_TRUE(lights.setString(LightsFields::ScheduleName, ""));
+  EXPECT_NE(revision, impl->relationshipRevision());
+
+  revision = impl->relationshipRevision();
+  EXPECT_TRUE(schedule.remove().size() > 0);
+  EXPECT_NE(revision, impl->relationshipRevision());
+}
+
+TEST_F(IdfFixture, Workspace_BulkAddResolvesNames) {
+  // enough objects that names are resolved through the bulk name index
+  IdfObjectVector idfObjects;
+  for (unsigned i = 0; i < 300; ++i) {
+    IdfObject zone(IddObjectType::Zone);
+    zone.setName("Zone " + std::to_string(i));
+    idfObjects.push_back(zone);
+    IdfObject lights(IddObjectType::Lights);
+    lights.setName("Lights " + std::to_string(i));
+    lights.setString(LightsFields::ZoneorZoneListName, "ZONE " + std::to_string(i));
+    lights.setString(LightsFields::ScheduleName, "Lights Schedule");
+    idfObjects.push_back(lights);
+  }
+  IdfObject schedule(IddObjectType::Schedule_Compact);
+  schedule.setName("lights schedule");
+  idfObjects.push_back(schedule);
+
+  Workspace ws(StrictnessLevel::None, IddFileType::EnergyPlus);
+  WorkspaceObjectVector added = ws.addObjects(idfObjects);
+  ASSERT_EQ(idfObjects.size(), added.size());
+
+  for (unsigned i = 0; i < 300; ++i) {
+    WorkspaceObject lights = added[2 * i + 1];
+    OptionalWorkspaceObject zone = lights.getTarget(LightsFields::ZoneorZoneListName);
+    ASSERT_TRUE(zone);
+    EXPECT_EQ(added[2 * i].handle(), zone->handle());
+    OptionalWorkspaceObject target = lights.getTarget(LightsFields::ScheduleName);
+    ASSERT_TRUE(target);
+    EXPECT_EQ(added.back().handle(), target->handle());
+  }
+  EXPECT_EQ(300u, added.back().sources().size());
+
+  // names resolve as before once the add is complete
+  OptionalWorkspaceObject owo = ws.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(owo);
+  EXPECT_TRUE(owo->setString(LightsFields::ZoneorZoneListName, "zone 7"));
+  ASSERT_TRUE(owo->getTarget(LightsFields::ZoneorZoneListName));
+  EXPECT_EQ(added[14].handle(), owo->getTarget(LightsFields::ZoneorZoneListName)->handle());
+}
@@ -40,6 +40,7 @@
 
 #include "../core/Assert.hpp"
 #include "../core/StringHelpers.hpp"
+#include "../core/Tracing.hpp"
 
 #include <boost/lexical_cast.hpp>
 
@@ -57,6 +58,7 @@ namespace detail {
       m_strictnessLevel(level),
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
+      m_relationshipRevision(0),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -70,6 +72,7 @@ namespace detail {
       m_header(idfFile.header()),
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
+      m_relationshipRevision(0),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -82,6 +85,7 @@ namespace detail {
     m_header(other.m_header),
     m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
     m_fastNaming(other.fastNaming()),
+    m_relationshipRevision(0),
     m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -106,6 +110,7 @@ namespace detail {
       m_header(), // subset of original data--discard header
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_relationshipRevision(0),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -169,6 +174,10 @@ namespace detail {
     m_fastNaming = otherImpl->m_fastNaming;
     otherImpl->m_fastNaming = tfn;
 
+    // objects are exchanged, invalidate anything cached on either side
+    ++m_relationshipRevision;
+    ++otherImpl->m_relationshipRevision;
+
     WorkspaceObjectMap twop = m_workspaceObjectMap;
     m_workspaceObjectMap = otherImpl->m_workspaceObjectMap;
     otherImpl->m_workspaceObjectMap = twop;
@@ -450,6 +459,19 @@ namespace detail {
       std::string name,
       const std::vector<std::string>& referenceNames) const
   {
+    if (!m_nameReferenceIndex.empty()) {
+      boost::to_lower(name);
+      for (const std::string& referenceName : referenceNames) {
+        auto loc = m_nameReferenceIndex.find(referenceName);
+        if (loc != m_nameReferenceIndex.end()) {
+          auto it = loc->second.find(name);
+          if (it != loc->second.end()) {
+            return WorkspaceObject(it->second);
+          }
+        }
+      }
+      return boost::none;
+    }
     for (const WorkspaceObject& object : getObjectsByReference(referenceNames)) {
       OptionalString candidate = object.name();
       if (candidate && istringEqual(*candidate,name)) {
@@ -464,6 +486,16 @@ namespace detail {
     return m_fastNaming;
   }
 
+  unsigned Workspace_Impl::relationshipRevision() const
+  {
+    return m_relationshipRevision;
+  }
+
+  void Workspace_Impl::registerRelationshipChange()
+  {
+    ++m_relationshipRevision;
+  }
+
   // SETTERS
 
   bool Workspace_Impl::setStrictnessLevel(StrictnessLevel level) {
@@ -532,6 +564,20 @@ namespace detail {
 
     // step 2: replace string pointers
     if (ok){
+      // resolving a name scans every object in the field's reference lists, index names up front
+      // when adding many objects that point to each other by name
+      bool indexNames = (N >= 256) && !objectImplPtrs.front()->iddObject().hasHandleField();
+      if (indexNames) {
+        buildNameReferenceIndex();
+      }
+
+      // the index is only valid while these objects are initialized, getObjectByNameAndReference
+      // must not see it afterwards even if initializeOnAdd throws
+      struct NameReferenceIndexClearer {
+        NameReferenceIndex& index;
+        ~NameReferenceIndexClearer() { index.clear(); }
+      } nameReferenceIndexClearer{m_nameReferenceIndex};
+
       for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
         ptr->initializeOnAdd(expectToLosePointers);
         this->progressValue.nano_emit(++i);
@@ -2096,6 +2142,22 @@ namespace detail {
       m_idfReferencesMap[referenceName].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
     }
   }
+  void Workspace_Impl::buildNameReferenceIndex()
+  {
+    m_nameReferenceIndex.clear();
+    m_nameReferenceIndex.reserve(m_idfReferencesMap.size());
+    for (const auto& reference : m_idfReferencesMap) {
+      auto& names = m_nameReferenceIndex[reference.first];
+      names.reserve(reference.second.size());
+      for (const auto& object : reference.second) {
+        OptionalString name = object.second->name();
+        if (name && !name->empty()) {
+          names.emplace(boost::to_lower_copy(*name), object.second);
+        }
+      }
+    }
+  }
+
   bool Workspace_Impl::resolvePotentialNameConflicts(Workspace& other) {
     return resolvePotentialNameConflicts(other, std::vector<unsigned>());
   }
@@ -2335,6 +2397,7 @@ namespace detail {
     }
     ptr->disconnect();
     ptr.get()->onChange.disconnect<Workspace_Impl, &Workspace_Impl::change>(this);
+    ++m_relationshipRevision;
   }
 
   void Workspace_Impl::registerRemovalOfObjects(std::vector<SavedWorkspaceObject>& savedObjects,
@@ -2348,6 +2411,7 @@ namespace detail {
 
   void Workspace_Impl::registerAdditionOfObject(const WorkspaceObject& object) {
     object.getImpl<WorkspaceObject_Impl>().get()->WorkspaceObject_Impl::onChange.connect<Workspace_Impl, &Workspace_Impl::change>(this);
+    ++m_relationshipRevision;
     auto sh_ptr = object.getImpl<WorkspaceObject_Impl>();
     this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
     this->addWorkspaceObjectPtr.nano_emit(sh_ptr, object.iddObject().type(), object.handle());
@@ -2897,10 +2961,12 @@ bool Workspace::disconnectProgressBar(openstudio::ProgressBar& progressBar)
 // SERIALIZATION
 
 bool Workspace::save(const openstudio::path& p, bool overwrite) {
+  OS_TRACE_SCOPE_DETAIL("utilities", "Workspace::save", toString(p));
   return m_impl->save(p,overwrite);
 }
 
 boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
+  OS_TRACE_SCOPE_DETAIL("utilities", "Workspace::load", toString(p));
   OptionalIdfFile oIdfFile = IdfFile::load(p);
   if (oIdfFile) {
     return Workspace(*oIdfFile);
@@ -2911,6 +2977,7 @@ boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
 boost::optional<Workspace> Workspace::load(const openstudio::path& p,
                                            const IddFileType& iddFileType)
 {
+  OS_TRACE_SCOPE_DETAIL("utilities", "Workspace::load", toString(p));
   OptionalIdfFile oIdfFile = IdfFile::load(p,iddFileType);
   if (oIdfFile) {
     return Workspace(*oIdfFile);
@@ -2921,6 +2988,7 @@ boost::optional<Workspace> Workspace::load(const openstudio::path& p,
 boost::optional<Workspace> Workspace::load(const openstudio::path& p,
                                            const IddFile& iddFile)
 {
+  OS_TRACE_SCOPE_DETAIL("utilities", "Workspace::load", toString(p));
   OptionalIdfFile oIdfFile = IdfFile::load(p,iddFile);
   if (oIdfFile) {
     return Workspace(*oIdfFile);
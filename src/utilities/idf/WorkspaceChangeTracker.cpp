@@ -0,0 +1,150 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "WorkspaceChangeTracker.hpp"
+#include "Workspace_Impl.hpp"
+#include "WorkspaceObject_Impl.hpp"
+#include "../core/Assert.hpp"
+
+namespace openstudio {
+
+/// forwards the change signal of a single object, which carries no arguments, to the tracker with the object's handle
+class WorkspaceChangeTracker::ObjectObserver : public Nano::Observer
+{
+ public:
+
+  ObjectObserver(WorkspaceChangeTracker* tracker, const Handle& handle)
+    : m_tracker(tracker), m_handle(handle)
+  {}
+
+  void change()
+  {
+    m_tracker->objectChange(m_handle);
+  }
+
+ private:
+
+  WorkspaceChangeTracker* m_tracker;
+  Handle m_handle;
+};
+
+WorkspaceChangeTracker::WorkspaceChangeTracker(const Workspace& work)
+{
+  detail::Workspace_ImplPtr wsImpl = work.getImpl<detail::Workspace_Impl>();
+
+  wsImpl.get()->detail::Workspace_Impl::addWorkspaceObject.connect<WorkspaceChangeTracker, &WorkspaceChangeTracker::objectAdd>(this);
+
+  // this signal happens immediately
+  wsImpl.get()->detail::Workspace_Impl::removeWorkspaceObject.connect<WorkspaceChangeTracker, &WorkspaceChangeTracker::objectRemove>(this);
+
+  for (const WorkspaceObject& object : work.objects()){
+    watch(object);
+  }
+}
+
+WorkspaceChangeTracker::~WorkspaceChangeTracker()
+{
+}
+
+bool WorkspaceChangeTracker::dirty() const
+{
+  return !m_changedHandles.empty();
+}
+
+std::vector<Handle> WorkspaceChangeTracker::changedHandles() const
+{
+  return m_changedHandles;
+}
+
+bool WorkspaceChangeTracker::isChanged(const Handle& handle) const
+{
+  return (m_changedSet.find(handle) != m_changedSet.end());
+}
+
+std::vector<Handle> WorkspaceChangeTracker::removedHandles() const
+{
+  std::vector<Handle> result;
+  for (const Handle& handle : m_changedHandles){
+    if (m_removedSet.find(handle) != m_removedSet.end()){
+      result.push_back(handle);
+    }
+  }
+  return result;
+}
+
+void WorkspaceChangeTracker::clearState()
+{
+  m_changedHandles.clear();
+  m_changedSet.clear();
+  m_removedSet.clear();
+}
+
+void WorkspaceChangeTracker::objectAdd(const WorkspaceObject& addedObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid)
+{
+  // Note: Args 2 & 3 are simply to comply with Nano::Signal template parameters
+  if (!addedObject.handle().isNull()){
+    // an object restored after a failed remove is no longer removed
+    m_removedSet.erase(addedObject.handle());
+    watch(addedObject);
+    mark(addedObject.handle());
+  }
+}
+
+void WorkspaceChangeTracker::objectRemove(const WorkspaceObject& removedObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid)
+{
+  // Note: Args 2 & 3 are simply to comply with Nano::Signal template parameters
+  Handle handle = removedObject.handle();
+  m_observers.erase(handle);
+  m_removedSet.insert(handle);
+  mark(handle);
+}
+
+void WorkspaceChangeTracker::objectChange(const Handle& handle)
+{
+  mark(handle);
+}
+
+void WorkspaceChangeTracker::watch(const WorkspaceObject& object)
+{
+  std::unique_ptr<ObjectObserver>& observer = m_observers[object.handle()];
+  if (!observer){
+    observer = std::unique_ptr<ObjectObserver>(new ObjectObserver(this, object.handle()));
+    object.getImpl<detail::WorkspaceObject_Impl>().get()->detail::WorkspaceObject_Impl::onChange.connect<ObjectObserver, &ObjectObserver::change>(observer.get());
+  }
+}
+
+void WorkspaceChangeTracker::mark(const Handle& handle)
+{
+  if (m_changedSet.insert(handle).second){
+    m_changedHandles.push_back(handle);
+  }
+}
+
+} // openstudio
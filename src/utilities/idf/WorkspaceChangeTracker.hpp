@@ -0,0 +1,110 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef UTILITIES_IDF_WORKSPACECHANGETRACKER_HPP
+#define UTILITIES_IDF_WORKSPACECHANGETRACKER_HPP
+
+#include <utilities/UtilitiesAPI.hpp>
+#include <utilities/idf/Handle.hpp>
+#include <utilities/idf/Workspace.hpp>
+
+#include <nano/nano_signal_slot.hpp> // Signal-Slot replacement
+
+#include <boost/functional/hash.hpp>
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace openstudio{
+
+/** WorkspaceChangeTracker records the handles of all objects which are added to, changed in, or removed from
+ *  a Workspace.  Unlike WorkspaceWatcher, which only reports that the Workspace is dirty, this class can be used
+ *  to drive incremental updates of derived data (e.g. translations) that only touch the changed objects.
+ *
+ *  Like WorkspaceWatcher, WorkspaceChangeTracker is designed to be stack allocated.  Connecting to every object
+ *  in the Workspace has a cost, construct the tracker once and call clearState after each incremental update.
+ *  The tracker disconnects from the Workspace when destroyed, so it may be destroyed before the Workspace.
+ **/
+class UTILITIES_API WorkspaceChangeTracker : public Nano::Observer {
+
+ public:
+
+  WorkspaceChangeTracker(const Workspace& workspace);
+
+  virtual ~WorkspaceChangeTracker();
+
+  WorkspaceChangeTracker(const WorkspaceChangeTracker& other) = delete;
+
+  WorkspaceChangeTracker& operator=(const WorkspaceChangeTracker& other) = delete;
+
+  /// true if any object has been added, changed, or removed since construction or the last clearState
+  bool dirty() const;
+
+  /// handles of objects added, changed, or removed since construction or the last clearState, in order of first change
+  /// removed objects are no longer in the Workspace
+  std::vector<Handle> changedHandles() const;
+
+  /// true if the object with handle has been added, changed, or removed since construction or the last clearState
+  bool isChanged(const Handle& handle) const;
+
+  /// handles of objects removed since construction or the last clearState
+  std::vector<Handle> removedHandles() const;
+
+  /// forget all recorded changes
+  void clearState();
+
+ // public slots:
+
+  // Note: Args 2 & 3 are simply to comply with Nano::Signal template parameters
+  void objectAdd(const WorkspaceObject& addedObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+  // Note: Args 2 & 3 are simply to comply with Nano::Signal template parameters
+  void objectRemove(const WorkspaceObject& removedObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+  void objectChange(const Handle& handle);
+
+ private:
+
+  class ObjectObserver;
+
+  void watch(const WorkspaceObject& object);
+
+  void mark(const Handle& handle);
+
+  std::vector<Handle> m_changedHandles;
+  std::unordered_set<Handle, boost::hash<boost::uuids::uuid> > m_changedSet;
+  std::unordered_set<Handle, boost::hash<boost::uuids::uuid> > m_removedSet;
+  std::unordered_map<Handle, std::unique_ptr<ObjectObserver>, boost::hash<boost::uuids::uuid> > m_observers;
+};
+
+}
+#endif
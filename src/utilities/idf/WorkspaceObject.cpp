@@ -720,6 +720,30 @@ namespace detail {
     return result;
   }
 
+  bool WorkspaceObject_Impl::setNumericExtensibleGroups(const std::vector<double>& values) {
+    bool result = setNumericExtensibleGroups(values,true);
+    if (result) {
+      this->emitChangeSignals();
+    }
+    return result;
+  }
+
+  bool WorkspaceObject_Impl::setNumericExtensibleGroups(const std::vector<double>& values, bool checkValidity) {
+    if (m_handle.isNull()) { return false; }
+    StrictnessLevel level = m_workspace->strictnessLevel();
+
+    // check minFields in Final Strictness
+    if (checkValidity && (level == StrictnessLevel::Final)) {
+      unsigned numAfterSet = m_iddObject.numFields() + values.size();
+      if (numAfterSet < m_iddObject.properties().minFields) {
+        return false;
+      }
+    }
+
+    // extensible pointer fields are rejected by IdfObject_Impl, so no pointers need updating
+    return IdfObject_Impl::setNumericExtensibleGroups(values, checkValidity && (level > StrictnessLevel::None));
+  }
+
   // QUERIES
 
   bool WorkspaceObject_Impl::initialized() const {
@@ -1022,6 +1046,8 @@ namespace detail {
     std::pair<SourceData::pointer_set::iterator,bool> insertResult;
     insertResult = m_sourceData->pointers.insert(ForwardPointer(index,Handle()));
     OS_ASSERT(insertResult.second);
+
+    m_workspace->registerRelationshipChange();
   }
 
   // Pre-condition:  Object sourceHandle points to this object from field index.
@@ -1107,6 +1133,7 @@ namespace detail {
     std::pair<SourceData::pointer_set::iterator,bool> insertResult;
     insertResult = m_sourceData->pointers.insert(ForwardPointer(index,targetHandle));
     OS_ASSERT(insertResult.second);
+    m_workspace->registerRelationshipChange();
 
     // add reverse pointer
     if (!targetHandle.isNull()) {
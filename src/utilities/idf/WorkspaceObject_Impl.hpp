@@ -220,6 +220,11 @@ namespace detail {
     virtual std::vector<std::string> popExtensibleGroup() override;
     virtual std::vector<std::string> popExtensibleGroup(bool checkValidity) override;
 
+    /** Replaces all extensible groups with the numeric data in values, if possible. Validity is
+     *  checked against the Workspace's StrictnessLevel. */
+    virtual bool setNumericExtensibleGroups(const std::vector<double>& values) override;
+    virtual bool setNumericExtensibleGroups(const std::vector<double>& values, bool checkValidity) override;
+
     //@}
     /** @name Queries */
     //@{
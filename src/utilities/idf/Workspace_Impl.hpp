@@ -108,7 +108,9 @@ namespace detail {
     /** Swaps underlying data between this workspace and other. */
     virtual void swap(Workspace& other);
 
-    virtual ~Workspace_Impl() {}
+    // disconnects from object signals before the objects are released, otherwise each object
+    // searches this observer's connection list on destruction
+    virtual ~Workspace_Impl() { disconnectAll(); }
 
     //@}
     /** @name Type Casting */
@@ -212,6 +214,14 @@ namespace detail {
     /** Returns true if fast naming is enabled. */
     bool fastNaming() const;
 
+    /** Returns a counter that is incremented whenever an object is added or removed, or an object's
+     *  pointer field changes. Data derived from relationships between objects can be cached until
+     *  this value changes. */
+    unsigned relationshipRevision() const;
+
+    /** Called by WorkspaceObject_Impl whenever one of its pointer fields is set or nullified. */
+    void registerRelationshipChange();
+
     //@}
     /** @name Setters */
     //@{
@@ -511,6 +521,7 @@ namespace detail {
     std::string m_header;                                // header for the IdfFile
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper; // IDD file to be used for validity checking
     bool m_fastNaming;
+    unsigned m_relationshipRevision;
 
     typedef std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl>, boost::hash<boost::uuids::uuid> > WorkspaceObjectMap;
     WorkspaceObjectMap m_workspaceObjectMap;
@@ -526,6 +537,11 @@ namespace detail {
     typedef std::unordered_map<std::string, WorkspaceObjectMap> IdfReferencesMap; // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // map of reference to lower case name to object. only populated while a large number of objects
+    // is being added, so that string pointers can be resolved without scanning whole reference lists.
+    typedef std::unordered_map<std::string, std::unordered_map<std::string, std::shared_ptr<WorkspaceObject_Impl> > > NameReferenceIndex;
+    NameReferenceIndex m_nameReferenceIndex;
+
     // data object for undos
     struct SavedWorkspaceObject {
       Handle                   handle;
@@ -566,6 +582,9 @@ namespace detail {
 
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    // Populates m_nameReferenceIndex from m_idfReferencesMap.
+    void buildNameReferenceIndex();
+
     // note default parameter for toIgnore is empty vector
     bool resolvePotentialNameConflicts(Workspace& other,
                                        const std::vector<unsigned>& toIgnore);
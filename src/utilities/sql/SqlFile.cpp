@@ -1299,6 +1299,15 @@ boost::optional<double> SqlFile::runPeriodValue(const std::string& envPeriod, co
   return result;
 }
 
+boost::optional<double> SqlFile::componentSizingValue(const std::string& componentName, const std::string& description) const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->componentSizingValue(componentName, description);
+  }
+  return result;
+}
+
 boost::optional<double> SqlFile::execAndReturnFirstDouble(const std::string& statement) const
 {
   boost::optional<double> result;
@@ -645,6 +645,11 @@ class UTILITIES_API SqlFile {
   /// Energy plus version number
   std::string energyPlusVersion() const;
 
+  /// Returns the value from the Initialization Summary Component Sizing Information table in the first row
+  /// containing both componentName (as recorded by EnergyPlus, i.e. upper case) and description
+  /// (e.g. "Design Size Nominal Capacity [W]"). The table is read and indexed once, on first use.
+  boost::optional<double> componentSizingValue(const std::string& componentName, const std::string& description) const;
+
   //@}
   /** @name Generic TimeSeries Interface */
   //@{
@@ -35,8 +35,9 @@
 #include "../filetypes/EpwFile.hpp"
 #include "../core/Containers.hpp"
 #include "../core/Assert.hpp"
+#include "../core/Tracing.hpp"
 
-
+#include <algorithm>
 
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
@@ -56,7 +57,8 @@ namespace openstudio{
     }
 
     SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
-      : m_path(path), m_connectionOpen(false), m_supportedVersion(false), m_hasYear(true), m_hasIlluminanceMapYear(true)
+      : m_path(path), m_connectionOpen(false), m_supportedVersion(false), m_hasYear(true), m_hasIlluminanceMapYear(true),
+        m_componentSizingLoaded(false)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
@@ -67,7 +69,7 @@ namespace openstudio{
 
     SqlFile_Impl::SqlFile_Impl(const openstudio::path &t_path, const openstudio::EpwFile &t_epwFile, const openstudio::DateTime &t_simulationTime,
         const openstudio::Calendar &t_calendar, const bool createIndexes)
-      : m_path(t_path)
+      : m_path(t_path), m_componentSizingLoaded(false)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
@@ -419,6 +421,10 @@ namespace openstudio{
 
     bool SqlFile_Impl::close()
     {
+      m_componentSizingLoaded = false;
+      m_componentSizingRows.clear();
+      m_componentSizingRowsByCell.clear();
+
       if (m_connectionOpen)
       {
         sqlite3_close(m_db);
@@ -443,6 +449,8 @@ namespace openstudio{
 
     void SqlFile_Impl::init()
     {
+      OS_TRACE_SCOPE_DETAIL("sql", "SqlFile::open", toString(m_path));
+
       m_sqliteFilename = toString(m_path.make_preferred().native());
       std::string fileName = m_sqliteFilename;
 
@@ -838,6 +846,8 @@ namespace openstudio{
 
     void SqlFile_Impl::retrieveDataDictionary()
     {
+      OS_TRACE_SCOPE("sql", "SqlFile::retrieveDataDictionary");
+
       std::string table, name, keyValue, units, rf;
 
       if (m_db)
@@ -1937,8 +1947,85 @@ namespace openstudio{
       return execAndReturnFirstDouble(s.str());
     }
 
+    boost::optional<double> SqlFile_Impl::componentSizingValue(const std::string& componentName, const std::string& description) const
+    {
+      if (!m_componentSizingLoaded) {
+        loadComponentSizing();
+      }
+
+      auto it = m_componentSizingRowsByCell.find(componentName);
+      if (it == m_componentSizingRowsByCell.end()) {
+        return boost::none;
+      }
+
+      for (size_t rowIndex : it->second) {
+        const ComponentSizingRow& row = m_componentSizingRows[rowIndex];
+        if (row.value && (std::find(row.cells.begin(), row.cells.end(), description) != row.cells.end())) {
+          return row.value;
+        }
+      }
+      return boost::none;
+    }
+
+    void SqlFile_Impl::loadComponentSizing() const
+    {
+      OS_TRACE_SCOPE("sql", "SqlFile::loadComponentSizing");
+
+      m_componentSizingRows.clear();
+      m_componentSizingRowsByCell.clear();
+      m_componentSizingLoaded = true;
+
+      if (!m_db) {
+        return;
+      }
+
+      // one pass over the table replaces the per value queries made previously by ModelObject::getAutosizedValue
+      const std::string statement = "SELECT RowName, ColumnName, Value FROM tabulardatawithstrings "
+                                    "WHERE ReportName='Initialization Summary' "
+                                    "AND ReportForString='Entire Facility' "
+                                    "AND TableName = 'Component Sizing Information'";
+
+      sqlite3_stmt* sqlStmtPtr;
+      int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+      if (code != SQLITE_OK) {
+        LOG(Warn, "Could not read the Initialization Summary Component Sizing table.");
+        sqlite3_finalize(sqlStmtPtr);
+        return;
+      }
+
+      std::unordered_map<std::string, size_t> rowIndices;
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        std::string rowName = columnText(sqlite3_column_text(sqlStmtPtr, 0));
+        std::string columnName = columnText(sqlite3_column_text(sqlStmtPtr, 1));
+        std::string value = columnText(sqlite3_column_text(sqlStmtPtr, 2));
+
+        auto inserted = rowIndices.insert(std::make_pair(rowName, m_componentSizingRows.size()));
+        if (inserted.second) {
+          m_componentSizingRows.push_back(ComponentSizingRow());
+        }
+        size_t rowIndex = inserted.first->second;
+        ComponentSizingRow& row = m_componentSizingRows[rowIndex];
+
+        // the first Value column of the row, converted by sqlite as a query for a double would
+        if ((columnName == "Value") && !row.value) {
+          row.value = sqlite3_column_double(sqlStmtPtr, 2);
+        }
+
+        std::vector<size_t>& rows = m_componentSizingRowsByCell[value];
+        if (rows.empty() || (rows.back() != rowIndex)) {
+          rows.push_back(rowIndex);
+        }
+        row.cells.push_back(std::move(value));
+      }
+
+      // must finalize to prevent memory leaks
+      sqlite3_finalize(sqlStmtPtr);
+    }
+
     boost::optional<double> SqlFile_Impl::execAndReturnFirstDouble(const std::string& statement) const
     {
+      OS_TRACE_SCOPE_DETAIL("sql", "SqlFile::execAndReturnFirstDouble", statement);
+
       boost::optional<double> value;
       if (m_db)
       {
@@ -1960,6 +2047,8 @@ namespace openstudio{
 
     boost::optional<int> SqlFile_Impl::execAndReturnFirstInt(const std::string& statement) const
     {
+      OS_TRACE_SCOPE_DETAIL("sql", "SqlFile::execAndReturnFirstInt", statement);
+
       boost::optional<int> value;
       if (m_db)
       {
@@ -1981,6 +2070,8 @@ namespace openstudio{
 
     boost::optional<std::string> SqlFile_Impl::execAndReturnFirstString(const std::string& statement) const
     {
+      OS_TRACE_SCOPE_DETAIL("sql", "SqlFile::execAndReturnFirstString", statement);
+
       boost::optional<std::string> value;
       if (m_db)
       {
@@ -2002,6 +2093,8 @@ namespace openstudio{
 
     boost::optional<std::vector<double> > SqlFile_Impl::execAndReturnVectorOfDouble(const std::string& statement) const
     {
+      OS_TRACE_SCOPE_DETAIL("sql", "SqlFile::execAndReturnVectorOfDouble", statement);
+
       boost::optional<double> value;
       boost::optional<std::vector<double> > valueVector;
       if (m_db)
@@ -2037,6 +2130,8 @@ namespace openstudio{
 
     boost::optional<std::vector<int> > SqlFile_Impl::execAndReturnVectorOfInt(const std::string& statement) const
     {
+      OS_TRACE_SCOPE_DETAIL("sql", "SqlFile::execAndReturnVectorOfInt", statement);
+
       boost::optional<int> value;
       boost::optional<std::vector<int> > valueVector;
       if (m_db)
@@ -2072,6 +2167,8 @@ namespace openstudio{
 
     boost::optional<std::vector<std::string> > SqlFile_Impl::execAndReturnVectorOfString(const std::string& statement) const
     {
+      OS_TRACE_SCOPE_DETAIL("sql", "SqlFile::execAndReturnVectorOfString", statement);
+
       boost::optional<std::string> value;
       boost::optional<std::vector<std::string> > valueVector;
       if (m_db)
@@ -2107,6 +2204,9 @@ namespace openstudio{
     // execute a statement and return the error code, used for create/drop tables
     int SqlFile_Impl::execute(const std::string& statement)
     {
+      // the statement may change tabular data
+      m_componentSizingLoaded = false;
+
       int code = SQLITE_ERROR;
       if (m_db)
       {
@@ -2426,6 +2526,8 @@ namespace openstudio{
 
     openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const DataDictionaryItem& dataDictionary)
     {
+      OS_TRACE_SCOPE_DETAIL("sql", "SqlFile::timeSeries", dataDictionary.name + " " + dataDictionary.keyValue);
+
       openstudio::OptionalTimeSeries ts;
       std::string units = dataDictionary.units;
 
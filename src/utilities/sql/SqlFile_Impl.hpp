@@ -44,6 +44,7 @@
 #include <boost/optional.hpp>
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio{
@@ -738,6 +739,9 @@ namespace openstudio{
       /// value(i,j) is the illuminance at x(i), y(j) - returns x, y and illuminance
       void illuminanceMap(const int& hourlyReportIndex, std::vector<double>& x, std::vector<double>& y, std::vector<double>& illuminance) const  ;
 
+      // value from the Component Sizing Information table in the first row containing componentName and description
+      boost::optional<double> componentSizingValue(const std::string& componentName, const std::string& description) const;
+
       // execute a statement and return the first (if any) value as a double
       boost::optional<double> execAndReturnFirstDouble(const std::string& statement) const;
 
@@ -832,6 +836,14 @@ namespace openstudio{
 
       void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
+      // reads the Component Sizing Information table into m_componentSizingRows
+      void loadComponentSizing() const;
+
+      struct ComponentSizingRow {
+        std::vector<std::string> cells;
+        boost::optional<double> value;
+      };
+
       openstudio::path m_path;
       bool m_connectionOpen;
       DataDictionaryTable m_dataDictionary;
@@ -844,6 +856,11 @@ namespace openstudio{
 
       bool m_hasIlluminanceMapYear;
 
+      // Component Sizing Information table, rows in table order and rows containing each cell value
+      mutable bool m_componentSizingLoaded;
+      mutable std::vector<ComponentSizingRow> m_componentSizingRows;
+      mutable std::unordered_map<std::string, std::vector<size_t> > m_componentSizingRowsByCell;
+
       REGISTER_LOGGER("openstudio.energyplus.SqlFile");
     };
 
@@ -40,7 +40,10 @@
 #include "../../units/UnitFactory.hpp"
 
 #include <iostream>
+#include <map>
+#include <sstream>
 #include <boost/regex.hpp>
+#include <boost/algorithm/string/replace.hpp>
 #include <resources.hxx>
 
 using namespace std;
@@ -656,3 +659,73 @@ TEST_F(SqlFileFixture, SqlFile_LeapYear)
     EXPECT_EQ(original_datetimes, reloaded_datetimes);
   }
 }
+
+TEST_F(SqlFileFixture, ComponentSizingValue)
+{
+  openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileComponentSizing.sql");
+  if (openstudio::filesystem::exists(outfile))
+  {
+    openstudio::filesystem::remove(outfile);
+  }
+
+  openstudio::Calendar c(2012);
+
+  openstudio::SqlFile sql(outfile,
+      openstudio::EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")),
+      openstudio::DateTime::now(),
+      c);
+  ASSERT_TRUE(sql.connectionOpen());
+
+  std::map<std::string, int> stringIndices;
+  auto stringIndex = [&](const std::string& value) {
+    auto it = stringIndices.find(value);
+    if (it != stringIndices.end()) {
+      return it->second;
+    }
+    int index = int(stringIndices.size()) + 1;
+    std::string escaped = boost::replace_all_copy(value, "'", "''");
+    sql.execute("INSERT INTO Strings (StringIndex, StringTypeIndex, Value) VALUES (" + std::to_string(index) + ", 1, '" + escaped + "')");
+    stringIndices[value] = index;
+    return index;
+  };
+
+  int tabularDataIndex = 0;
+  auto insertRow = [&](const std::string& tableName, const std::string& rowName, const std::vector<std::pair<std::string, std::string>>& cells) {
+    for (const auto& cell : cells) {
+      std::stringstream ss;
+      ss << "INSERT INTO TabularData (TabularDataIndex, ReportNameIndex, ReportForStringIndex, TableNameIndex, RowNameIndex, ColumnNameIndex, UnitsIndex, SimulationIndex, RowId, ColumnId, Value) VALUES ("
+         << ++tabularDataIndex << ", " << stringIndex("Initialization Summary") << ", " << stringIndex("Entire Facility") << ", "
+         << stringIndex(tableName) << ", " << stringIndex(rowName) << ", " << stringIndex(cell.first) << ", " << stringIndex("") << ", 1, 0, 0, '"
+         << boost::replace_all_copy(cell.second, "'", "''") << "')";
+      sql.execute(ss.str());
+    }
+  };
+
+  const std::string sizing("Component Sizing Information");
+  insertRow(sizing, "1", {{"Component Type", "Coil:Cooling:DX:SingleSpeed"}, {"Component Name", "COIL 1"}, {"Description", "Design Size Rated Air Flow Rate [m3/s]"}, {"Value", "1.25"}});
+  insertRow(sizing, "2", {{"Component Type", "Coil:Cooling:DX:SingleSpeed"}, {"Component Name", "COIL 1"}, {"Description", "Design Size Gross Rated Total Cooling Capacity [W]"}, {"Value", "5000.0"}});
+  insertRow(sizing, "3", {{"Component Type", "Fan:ConstantVolume"}, {"Component Name", "SUPPLY FAN'S 1"}, {"Description", "Design Size Maximum Flow Rate [m3/s]"}, {"Value", "0.5"}});
+  insertRow("Another Table", "1", {{"Component Name", "COIL 1"}, {"Description", "Design Size Rated Air Flow Rate [m3/s]"}, {"Value", "99.0"}});
+
+  boost::optional<double> value = sql.componentSizingValue("COIL 1", "Design Size Rated Air Flow Rate [m3/s]");
+  ASSERT_TRUE(value);
+  EXPECT_DOUBLE_EQ(1.25, *value);
+
+  value = sql.componentSizingValue("COIL 1", "Design Size Gross Rated Total Cooling Capacity [W]");
+  ASSERT_TRUE(value);
+  EXPECT_DOUBLE_EQ(5000.0, *value);
+
+  // names that need quoting in a query are found as well
+  value = sql.componentSizingValue("SUPPLY FAN'S 1", "Design Size Maximum Flow Rate [m3/s]");
+  ASSERT_TRUE(value);
+  EXPECT_DOUBLE_EQ(0.5, *value);
+
+  EXPECT_FALSE(sql.componentSizingValue("COIL 1", "Design Size Maximum Flow Rate [m3/s]"));
+  EXPECT_FALSE(sql.componentSizingValue("COIL 2", "Design Size Rated Air Flow Rate [m3/s]"));
+
+  // executing a statement reloads the table
+  insertRow(sizing, "4", {{"Component Type", "Coil:Cooling:DX:SingleSpeed"}, {"Component Name", "COIL 2"}, {"Description", "Design Size Rated Air Flow Rate [m3/s]"}, {"Value", "2.5"}});
+  value = sql.componentSizingValue("COIL 2", "Design Size Rated Air Flow Rate [m3/s]");
+  ASSERT_TRUE(value);
+  EXPECT_DOUBLE_EQ(2.5, *value);
+}